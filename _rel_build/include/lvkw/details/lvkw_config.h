@@ -0,0 +1,25 @@
+#ifndef LVKW_CONFIG_H_INCLUDED
+#define LVKW_CONFIG_H_INCLUDED
+
+#define LVKW_VERSION_MAJOR 0
+#define LVKW_VERSION_MINOR 1
+#define LVKW_VERSION_PATCH 0
+
+/* Configuration options */
+#define LVKW_ENABLE_CONTROLLER
+#define LVKW_ENABLE_DIAGNOSTICS
+#define LVKW_GATHER_METRICS
+/* #undef LVKW_VALIDATE_API_CALLS */
+/* #undef LVKW_RECOVERABLE_API_CALLS */
+/* #undef LVKW_ENABLE_INTERNAL_CHECKS */
+/* #undef LVKW_ENABLE_FAULT_INJECTION */
+/* #undef LVKW_USE_FLOAT */
+
+/* Normalized numeric validation toggle for internal #if checks. */
+#ifdef LVKW_VALIDATE_API_CALLS
+#define LVKW_API_VALIDATION 1
+#else
+#define LVKW_API_VALIDATION 0
+#endif
+
+#endif  // LVKW_CONFIG_H_INCLUDED
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lvkw/common/context/context.c" "src/lvkw/common/CMakeFiles/lvkw_base_indirect_obj.dir/context/context.c.o" "gcc" "src/lvkw/common/CMakeFiles/lvkw_base_indirect_obj.dir/context/context.c.o.d"
+  "/root/repo/src/lvkw/common/core/string_cache.c" "src/lvkw/common/CMakeFiles/lvkw_base_indirect_obj.dir/core/string_cache.c.o" "gcc" "src/lvkw/common/CMakeFiles/lvkw_base_indirect_obj.dir/core/string_cache.c.o.d"
+  "/root/repo/src/lvkw/common/core/transient_pool.c" "src/lvkw/common/CMakeFiles/lvkw_base_indirect_obj.dir/core/transient_pool.c.o" "gcc" "src/lvkw/common/CMakeFiles/lvkw_base_indirect_obj.dir/core/transient_pool.c.o.d"
+  "/root/repo/src/lvkw/common/core/window_map.c" "src/lvkw/common/CMakeFiles/lvkw_base_indirect_obj.dir/core/window_map.c.o" "gcc" "src/lvkw/common/CMakeFiles/lvkw_base_indirect_obj.dir/core/window_map.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
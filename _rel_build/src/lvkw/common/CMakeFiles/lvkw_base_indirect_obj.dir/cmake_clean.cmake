@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lvkw_base_indirect_obj.dir/context/context.c.o"
+  "CMakeFiles/lvkw_base_indirect_obj.dir/context/context.c.o.d"
+  "CMakeFiles/lvkw_base_indirect_obj.dir/core/string_cache.c.o"
+  "CMakeFiles/lvkw_base_indirect_obj.dir/core/string_cache.c.o.d"
+  "CMakeFiles/lvkw_base_indirect_obj.dir/core/transient_pool.c.o"
+  "CMakeFiles/lvkw_base_indirect_obj.dir/core/transient_pool.c.o.d"
+  "CMakeFiles/lvkw_base_indirect_obj.dir/core/window_map.c.o"
+  "CMakeFiles/lvkw_base_indirect_obj.dir/core/window_map.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lvkw_base_indirect_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "liblvkw_linux.a"
+  "liblvkw_linux.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lvkw_linux.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lvkw/linux/dlib/linux_loader.c" "src/lvkw/linux/CMakeFiles/lvkw_linux_common_obj.dir/dlib/linux_loader.c.o" "gcc" "src/lvkw/linux/CMakeFiles/lvkw_linux_common_obj.dir/dlib/linux_loader.c.o.d"
+  "/root/repo/src/lvkw/linux/linux_keymap_cache.c" "src/lvkw/linux/CMakeFiles/lvkw_linux_common_obj.dir/linux_keymap_cache.c.o" "gcc" "src/lvkw/linux/CMakeFiles/lvkw_linux_common_obj.dir/linux_keymap_cache.c.o.d"
+  "/root/repo/src/lvkw/linux/linux_keys.c" "src/lvkw/linux/CMakeFiles/lvkw_linux_common_obj.dir/linux_keys.c.o" "gcc" "src/lvkw/linux/CMakeFiles/lvkw_linux_common_obj.dir/linux_keys.c.o.d"
+  "/root/repo/src/lvkw/linux/linux_utils.c" "src/lvkw/linux/CMakeFiles/lvkw_linux_common_obj.dir/linux_utils.c.o" "gcc" "src/lvkw/linux/CMakeFiles/lvkw_linux_common_obj.dir/linux_utils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lvkw_linux_common_obj.dir/dlib/linux_loader.c.o"
+  "CMakeFiles/lvkw_linux_common_obj.dir/dlib/linux_loader.c.o.d"
+  "CMakeFiles/lvkw_linux_common_obj.dir/linux_keymap_cache.c.o"
+  "CMakeFiles/lvkw_linux_common_obj.dir/linux_keymap_cache.c.o.d"
+  "CMakeFiles/lvkw_linux_common_obj.dir/linux_keys.c.o"
+  "CMakeFiles/lvkw_linux_common_obj.dir/linux_keys.c.o.d"
+  "CMakeFiles/lvkw_linux_common_obj.dir/linux_utils.c.o"
+  "CMakeFiles/lvkw_linux_common_obj.dir/linux_utils.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lvkw_linux_common_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lvkw_linux_obj.dir/linux_entry.c.o"
+  "CMakeFiles/lvkw_linux_obj.dir/linux_entry.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lvkw_linux_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
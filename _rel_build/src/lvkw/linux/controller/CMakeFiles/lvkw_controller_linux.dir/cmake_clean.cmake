@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lvkw_controller_linux.dir/controller_linux.c.o"
+  "CMakeFiles/lvkw_controller_linux.dir/controller_linux.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lvkw_controller_linux.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
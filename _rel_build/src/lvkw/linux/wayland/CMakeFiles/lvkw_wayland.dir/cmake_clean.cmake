@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "liblvkw_wayland.a"
+  "liblvkw_wayland.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lvkw_wayland.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lvkw/linux/wayland/dlib/loader.c" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/dlib/loader.c.o" "gcc" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/dlib/loader.c.o.d"
+  "/root/repo/src/lvkw/linux/wayland/wayland_context.c" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_context.c.o" "gcc" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_context.c.o.d"
+  "/root/repo/src/lvkw/linux/wayland/wayland_display.c" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_display.c.o" "gcc" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_display.c.o.d"
+  "/root/repo/src/lvkw/linux/wayland/wayland_entry.c" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_entry.c.o" "gcc" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_entry.c.o.d"
+  "/root/repo/src/lvkw/linux/wayland/wayland_events.c" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_events.c.o" "gcc" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_events.c.o.d"
+  "/root/repo/src/lvkw/linux/wayland/wayland_input.c" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_input.c.o" "gcc" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_input.c.o.d"
+  "/root/repo/src/lvkw/linux/wayland/wayland_misc.c" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_misc.c.o" "gcc" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_misc.c.o.d"
+  "/root/repo/src/lvkw/linux/wayland/wayland_monitor.c" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_monitor.c.o" "gcc" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_monitor.c.o.d"
+  "/root/repo/src/lvkw/linux/wayland/wayland_window.c" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_window.c.o" "gcc" "src/lvkw/linux/wayland/CMakeFiles/lvkw_wayland_indirect_obj.dir/wayland_window.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lvkw_wayland_obj.dir/dlib/loader.c.o"
+  "CMakeFiles/lvkw_wayland_obj.dir/dlib/loader.c.o.d"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_context.c.o"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_context.c.o.d"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_display.c.o"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_display.c.o.d"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_entry.c.o"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_entry.c.o.d"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_events.c.o"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_events.c.o.d"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_input.c.o"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_input.c.o.d"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_misc.c.o"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_misc.c.o.d"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_monitor.c.o"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_monitor.c.o.d"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_window.c.o"
+  "CMakeFiles/lvkw_wayland_obj.dir/wayland_window.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lvkw_wayland_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lvkw_wayland_protocols.dir/wl_protocols.c.o"
+  "CMakeFiles/lvkw_wayland_protocols.dir/wl_protocols.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lvkw_wayland_protocols.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
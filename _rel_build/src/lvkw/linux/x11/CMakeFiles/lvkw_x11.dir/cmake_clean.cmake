@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "liblvkw_x11.a"
+  "liblvkw_x11.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lvkw_x11.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
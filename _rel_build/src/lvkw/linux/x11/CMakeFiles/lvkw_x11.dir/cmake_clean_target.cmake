@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "liblvkw_x11.a"
+)
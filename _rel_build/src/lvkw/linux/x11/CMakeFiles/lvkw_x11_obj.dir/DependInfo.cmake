@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lvkw/linux/x11/dlib/loader.c" "src/lvkw/linux/x11/CMakeFiles/lvkw_x11_obj.dir/dlib/loader.c.o" "gcc" "src/lvkw/linux/x11/CMakeFiles/lvkw_x11_obj.dir/dlib/loader.c.o.d"
+  "/root/repo/src/lvkw/linux/x11/x11_context.c" "src/lvkw/linux/x11/CMakeFiles/lvkw_x11_obj.dir/x11_context.c.o" "gcc" "src/lvkw/linux/x11/CMakeFiles/lvkw_x11_obj.dir/x11_context.c.o.d"
+  "/root/repo/src/lvkw/linux/x11/x11_entry.c" "src/lvkw/linux/x11/CMakeFiles/lvkw_x11_obj.dir/x11_entry.c.o" "gcc" "src/lvkw/linux/x11/CMakeFiles/lvkw_x11_obj.dir/x11_entry.c.o.d"
+  "/root/repo/src/lvkw/linux/x11/x11_events.c" "src/lvkw/linux/x11/CMakeFiles/lvkw_x11_obj.dir/x11_events.c.o" "gcc" "src/lvkw/linux/x11/CMakeFiles/lvkw_x11_obj.dir/x11_events.c.o.d"
+  "/root/repo/src/lvkw/linux/x11/x11_input.c" "src/lvkw/linux/x11/CMakeFiles/lvkw_x11_obj.dir/x11_input.c.o" "gcc" "src/lvkw/linux/x11/CMakeFiles/lvkw_x11_obj.dir/x11_input.c.o.d"
+  "/root/repo/src/lvkw/linux/x11/x11_window.c" "src/lvkw/linux/x11/CMakeFiles/lvkw_x11_obj.dir/x11_window.c.o" "gcc" "src/lvkw/linux/x11/CMakeFiles/lvkw_x11_obj.dir/x11_window.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
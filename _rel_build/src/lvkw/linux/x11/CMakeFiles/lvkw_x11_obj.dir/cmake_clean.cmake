@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lvkw_x11_obj.dir/dlib/loader.c.o"
+  "CMakeFiles/lvkw_x11_obj.dir/dlib/loader.c.o.d"
+  "CMakeFiles/lvkw_x11_obj.dir/x11_context.c.o"
+  "CMakeFiles/lvkw_x11_obj.dir/x11_context.c.o.d"
+  "CMakeFiles/lvkw_x11_obj.dir/x11_entry.c.o"
+  "CMakeFiles/lvkw_x11_obj.dir/x11_entry.c.o.d"
+  "CMakeFiles/lvkw_x11_obj.dir/x11_events.c.o"
+  "CMakeFiles/lvkw_x11_obj.dir/x11_events.c.o.d"
+  "CMakeFiles/lvkw_x11_obj.dir/x11_input.c.o"
+  "CMakeFiles/lvkw_x11_obj.dir/x11_input.c.o.d"
+  "CMakeFiles/lvkw_x11_obj.dir/x11_window.c.o"
+  "CMakeFiles/lvkw_x11_obj.dir/x11_window.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lvkw_x11_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: Zlib
+// Copyright (c) 2026 François Chabot
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>  // types_internal.h includes it in C++, where it must not land inside extern "C".
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <linux/input-event-codes.h>
+
+extern "C" {
+#include "linux_internal.h"
+
+// context.c references the backend entry point and the platform clock; key
+// dispatch needs neither.
+LVKW_Status _lvkw_createContext_impl(const LVKW_ContextCreateInfo* create_info,
+                                     LVKW_Context** out_context) {
+  (void)create_info;
+  *out_context = nullptr;
+  return LVKW_ERROR;
+}
+
+uint64_t _lvkw_get_timestamp_ns(void) {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch())
+                                   .count());
+}
+}
+
+namespace {
+
+constexpr size_t kStormLength = 4096;
+
+// A US layout subset: what a typing or gaming key storm actually hits.
+constexpr uint32_t kKeys[] = {
+    KEY_A,     KEY_S,   KEY_D,         KEY_W,   KEY_E,     KEY_R,     KEY_T,
+    KEY_O,     KEY_N,   KEY_I,         KEY_Z,   KEY_Q,     KEY_1,     KEY_2,
+    KEY_9,     KEY_SPACE, KEY_ENTER,   KEY_TAB, KEY_BACKSPACE, KEY_ESC, KEY_LEFT,
+    KEY_RIGHT, KEY_UP,  KEY_DOWN,      KEY_LEFTSHIFT, KEY_LEFTCTRL, KEY_F5, KEY_KP5,
+};
+
+// Effective mod masks with the usual real-modifier layout.
+constexpr uint32_t kMasks[] = {0x00, 0x01, 0x04, 0x08, 0x10, 0x11, 0x05, 0x40, 0x02, 0x12};
+
+struct StormEntry {
+  uint32_t keycode;  // evdev, as on Wayland.
+  uint32_t mask;
+};
+
+struct Fixture {
+  LVKW_Context_Linux ctx;
+  std::vector<StormEntry> storm;
+  uint64_t delivered = 0;
+
+  static void* alloc(size_t size, void*) { return std::malloc(size); }
+  static void* realloc_cb(void* ptr, size_t size, void*) { return std::realloc(ptr, size); }
+  static void free_cb(void* ptr, void*) { std::free(ptr); }
+
+  static void on_event(LVKW_EventType, LVKW_Window*, const LVKW_Event* evt, void* userdata) {
+    Fixture* self = static_cast<Fixture*>(userdata);
+    self->delivered += static_cast<uint64_t>(evt->key.key) + evt->key.modifiers;
+  }
+
+  Fixture() {
+    std::memset(&ctx, 0, sizeof(ctx));
+    ctx.base.prv.allocator = {
+        .alloc_cb = &Fixture::alloc,
+        .realloc_cb = &Fixture::realloc_cb,
+        .free_cb = &Fixture::free_cb,
+        .userdata = nullptr,
+    };
+    ctx.base.prv.event_mask = static_cast<uint32_t>(LVKW_EVENT_TYPE_ALL);
+    ctx.base.prv.event_callback = &Fixture::on_event;
+    ctx.base.prv.event_userdata = this;
+
+    ctx.xkb.mod_indices.shift = 0;
+    ctx.xkb.mod_indices.caps = 1;
+    ctx.xkb.mod_indices.ctrl = 2;
+    ctx.xkb.mod_indices.alt = 3;
+    ctx.xkb.mod_indices.num = 4;
+    ctx.xkb.mod_indices.super = 6;
+    _lvkw_linux_build_modifier_lut(&ctx);
+
+    std::mt19937 rng(1234);
+    storm.resize(kStormLength);
+    for (StormEntry& e : storm) {
+      e.keycode = kKeys[rng() % std::size(kKeys)];
+      e.mask = kMasks[rng() % std::size(kMasks)];
+    }
+  }
+};
+
+Fixture& fixture() {
+  static Fixture f;
+  return f;
+}
+
+// The per-event modifier resolution that the table replaced.
+LVKW_ModifierFlags modifiers_branchy(const LVKW_Context_Linux& ctx, uint32_t mask) {
+  uint32_t modifiers = 0;
+  if (ctx.xkb.mod_indices.shift != XKB_MOD_INVALID && (mask & (1u << ctx.xkb.mod_indices.shift)))
+    modifiers |= LVKW_MODIFIER_SHIFT;
+  if (ctx.xkb.mod_indices.ctrl != XKB_MOD_INVALID && (mask & (1u << ctx.xkb.mod_indices.ctrl)))
+    modifiers |= LVKW_MODIFIER_CONTROL;
+  if (ctx.xkb.mod_indices.alt != XKB_MOD_INVALID && (mask & (1u << ctx.xkb.mod_indices.alt)))
+    modifiers |= LVKW_MODIFIER_ALT;
+  if (ctx.xkb.mod_indices.super != XKB_MOD_INVALID && (mask & (1u << ctx.xkb.mod_indices.super)))
+    modifiers |= LVKW_MODIFIER_META;
+  if (ctx.xkb.mod_indices.caps != XKB_MOD_INVALID && (mask & (1u << ctx.xkb.mod_indices.caps)))
+    modifiers |= LVKW_MODIFIER_CAPS_LOCK;
+  if (ctx.xkb.mod_indices.num != XKB_MOD_INVALID && (mask & (1u << ctx.xkb.mod_indices.num)))
+    modifiers |= LVKW_MODIFIER_NUM_LOCK;
+  return static_cast<LVKW_ModifierFlags>(modifiers);
+}
+
+// Copy of the evdev keycode switch that _lvkw_linux_evdev_key_table replaced.
+LVKW_Key translate_keycode_switch(uint32_t keycode) {
+  switch (keycode) {
+    case KEY_SPACE: return LVKW_KEY_SPACE;
+    case KEY_APOSTROPHE: return LVKW_KEY_APOSTROPHE;
+    case KEY_COMMA: return LVKW_KEY_COMMA;
+    case KEY_MINUS: return LVKW_KEY_MINUS;
+    case KEY_DOT: return LVKW_KEY_PERIOD;
+    case KEY_SLASH: return LVKW_KEY_SLASH;
+    case KEY_0: return LVKW_KEY_0;
+    case KEY_1: return LVKW_KEY_1;
+    case KEY_2: return LVKW_KEY_2;
+    case KEY_3: return LVKW_KEY_3;
+    case KEY_4: return LVKW_KEY_4;
+    case KEY_5: return LVKW_KEY_5;
+    case KEY_6: return LVKW_KEY_6;
+    case KEY_7: return LVKW_KEY_7;
+    case KEY_8: return LVKW_KEY_8;
+    case KEY_9: return LVKW_KEY_9;
+    case KEY_SEMICOLON: return LVKW_KEY_SEMICOLON;
+    case KEY_EQUAL: return LVKW_KEY_EQUAL;
+    case KEY_A: return LVKW_KEY_A;
+    case KEY_B: return LVKW_KEY_B;
+    case KEY_C: return LVKW_KEY_C;
+    case KEY_D: return LVKW_KEY_D;
+    case KEY_E: return LVKW_KEY_E;
+    case KEY_F: return LVKW_KEY_F;
+    case KEY_G: return LVKW_KEY_G;
+    case KEY_H: return LVKW_KEY_H;
+    case KEY_I: return LVKW_KEY_I;
+    case KEY_J: return LVKW_KEY_J;
+    case KEY_K: return LVKW_KEY_K;
+    case KEY_L: return LVKW_KEY_L;
+    case KEY_M: return LVKW_KEY_M;
+    case KEY_N: return LVKW_KEY_N;
+    case KEY_O: return LVKW_KEY_O;
+    case KEY_P: return LVKW_KEY_P;
+    case KEY_Q: return LVKW_KEY_Q;
+    case KEY_R: return LVKW_KEY_R;
+    case KEY_S: return LVKW_KEY_S;
+    case KEY_T: return LVKW_KEY_T;
+    case KEY_U: return LVKW_KEY_U;
+    case KEY_V: return LVKW_KEY_V;
+    case KEY_W: return LVKW_KEY_W;
+    case KEY_X: return LVKW_KEY_X;
+    case KEY_Y: return LVKW_KEY_Y;
+    case KEY_Z: return LVKW_KEY_Z;
+    case KEY_LEFTBRACE: return LVKW_KEY_LEFT_BRACKET;
+    case KEY_BACKSLASH: return LVKW_KEY_BACKSLASH;
+    case KEY_RIGHTBRACE: return LVKW_KEY_RIGHT_BRACKET;
+    case KEY_GRAVE: return LVKW_KEY_GRAVE_ACCENT;
+    case KEY_ESC: return LVKW_KEY_ESCAPE;
+    case KEY_ENTER: return LVKW_KEY_ENTER;
+    case KEY_TAB: return LVKW_KEY_TAB;
+    case KEY_BACKSPACE: return LVKW_KEY_BACKSPACE;
+    case KEY_INSERT: return LVKW_KEY_INSERT;
+    case KEY_DELETE: return LVKW_KEY_DELETE;
+    case KEY_RIGHT: return LVKW_KEY_RIGHT;
+    case KEY_LEFT: return LVKW_KEY_LEFT;
+    case KEY_DOWN: return LVKW_KEY_DOWN;
+    case KEY_UP: return LVKW_KEY_UP;
+    case KEY_PAGEUP: return LVKW_KEY_PAGE_UP;
+    case KEY_PAGEDOWN: return LVKW_KEY_PAGE_DOWN;
+    case KEY_HOME: return LVKW_KEY_HOME;
+    case KEY_END: return LVKW_KEY_END;
+    case KEY_CAPSLOCK: return LVKW_KEY_CAPS_LOCK;
+    case KEY_SCROLLLOCK: return LVKW_KEY_SCROLL_LOCK;
+    case KEY_NUMLOCK: return LVKW_KEY_NUM_LOCK;
+    case KEY_PRINT: return LVKW_KEY_PRINT_SCREEN;
+    case KEY_PAUSE: return LVKW_KEY_PAUSE;
+    case KEY_F1: return LVKW_KEY_F1;
+    case KEY_F2: return LVKW_KEY_F2;
+    case KEY_F3: return LVKW_KEY_F3;
+    case KEY_F4: return LVKW_KEY_F4;
+    case KEY_F5: return LVKW_KEY_F5;
+    case KEY_F6: return LVKW_KEY_F6;
+    case KEY_F7: return LVKW_KEY_F7;
+    case KEY_F8: return LVKW_KEY_F8;
+    case KEY_F9: return LVKW_KEY_F9;
+    case KEY_F10: return LVKW_KEY_F10;
+    case KEY_F11: return LVKW_KEY_F11;
+    case KEY_F12: return LVKW_KEY_F12;
+    case KEY_KP0: return LVKW_KEY_KP_0;
+    case KEY_KP1: return LVKW_KEY_KP_1;
+    case KEY_KP2: return LVKW_KEY_KP_2;
+    case KEY_KP3: return LVKW_KEY_KP_3;
+    case KEY_KP4: return LVKW_KEY_KP_4;
+    case KEY_KP5: return LVKW_KEY_KP_5;
+    case KEY_KP6: return LVKW_KEY_KP_6;
+    case KEY_KP7: return LVKW_KEY_KP_7;
+    case KEY_KP8: return LVKW_KEY_KP_8;
+    case KEY_KP9: return LVKW_KEY_KP_9;
+    case KEY_KPDOT: return LVKW_KEY_KP_DECIMAL;
+    case KEY_KPSLASH: return LVKW_KEY_KP_DIVIDE;
+    case KEY_KPASTERISK: return LVKW_KEY_KP_MULTIPLY;
+    case KEY_KPMINUS: return LVKW_KEY_KP_SUBTRACT;
+    case KEY_KPPLUS: return LVKW_KEY_KP_ADD;
+    case KEY_KPENTER: return LVKW_KEY_KP_ENTER;
+    case KEY_KPEQUAL: return LVKW_KEY_KP_EQUAL;
+    case KEY_LEFTSHIFT: return LVKW_KEY_LEFT_SHIFT;
+    case KEY_LEFTCTRL: return LVKW_KEY_LEFT_CONTROL;
+    case KEY_LEFTALT: return LVKW_KEY_LEFT_ALT;
+    case KEY_LEFTMETA: return LVKW_KEY_LEFT_META;
+    case KEY_RIGHTSHIFT: return LVKW_KEY_RIGHT_SHIFT;
+    case KEY_RIGHTCTRL: return LVKW_KEY_RIGHT_CONTROL;
+    case KEY_RIGHTALT: return LVKW_KEY_RIGHT_ALT;
+    case KEY_RIGHTMETA: return LVKW_KEY_RIGHT_META;
+    case KEY_MENU: return LVKW_KEY_MENU;
+    default: return LVKW_KEY_UNKNOWN;
+  }
+}
+
+// Keycode switch + branchy modifiers: the pre-table Wayland path.
+void run_translate_switch(benchmark::State& state) {
+  Fixture& f = fixture();
+  size_t i = 0;
+  for (auto _ : state) {
+    const StormEntry& e = f.storm[i++ & (kStormLength - 1)];
+    LVKW_Key key = translate_keycode_switch(e.keycode);
+    LVKW_ModifierFlags mods = modifiers_branchy(f.ctx, e.mask);
+    benchmark::DoNotOptimize(key);
+    benchmark::DoNotOptimize(mods);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// Keycode table + modifier table.
+void run_translate_lut(benchmark::State& state) {
+  Fixture& f = fixture();
+  size_t i = 0;
+  for (auto _ : state) {
+    const StormEntry& e = f.storm[i++ & (kStormLength - 1)];
+    LVKW_Key key = lvkw_linux_translate_keycode(e.keycode);
+    LVKW_ModifierFlags mods = _lvkw_linux_modifiers_from_mask(&f.ctx, e.mask);
+    benchmark::DoNotOptimize(key);
+    benchmark::DoNotOptimize(mods);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// Whole KEY event, from raw input to the application callback.
+template <bool kUseTables>
+void run_key_storm_dispatch(benchmark::State& state) {
+  Fixture& f = fixture();
+  size_t i = 0;
+  for (auto _ : state) {
+    const StormEntry& e = f.storm[i++ & (kStormLength - 1)];
+    LVKW_Event evt = {};
+    if constexpr (kUseTables) {
+      evt.key.key = lvkw_linux_translate_keycode(e.keycode);
+      evt.key.modifiers = _lvkw_linux_modifiers_from_mask(&f.ctx, e.mask);
+    }
+    else {
+      evt.key.key = translate_keycode_switch(e.keycode);
+      evt.key.modifiers = modifiers_branchy(f.ctx, e.mask);
+    }
+    evt.key.state = (i & 1) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
+    _lvkw_dispatch_timed_event(&f.ctx.base, LVKW_EVENT_TYPE_KEY, nullptr, &evt, 0);
+  }
+  benchmark::DoNotOptimize(f.delivered);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+}  // namespace
+
+BENCHMARK(run_translate_switch)->Unit(benchmark::kNanosecond);
+BENCHMARK(run_translate_lut)->Unit(benchmark::kNanosecond);
+BENCHMARK_TEMPLATE(run_key_storm_dispatch, false)->Name("run_key_storm_dispatch/switch");
+BENCHMARK_TEMPLATE(run_key_storm_dispatch, true)->Name("run_key_storm_dispatch/lut");
+
+BENCHMARK_MAIN();
@@ -0,0 +1,262 @@
+// SPDX-License-Identifier: Zlib
+// Copyright (c) 2026 François Chabot
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+extern "C" {
+#include "internal.h"
+
+// context.c references the backend entry point and the platform clock; the
+// ring itself needs neither.
+LVKW_Status _lvkw_createContext_impl(const LVKW_ContextCreateInfo* create_info,
+                                     LVKW_Context** out_context) {
+  (void)create_info;
+  *out_context = nullptr;
+  return LVKW_ERROR;
+}
+
+uint64_t _lvkw_get_timestamp_ns(void) {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch())
+                                   .count());
+}
+}
+
+namespace {
+
+constexpr size_t kMaxLatencySamples = size_t{1} << 22;
+
+uint64_t now_ns() { return _lvkw_get_timestamp_ns(); }
+
+// Per-thread hardware cache-miss counter. Silently unavailable when
+// perf_event_open() is refused (containers, perf_event_paranoid, non-Linux).
+class CacheMissCounter {
+ public:
+  CacheMissCounter() {
+#if defined(__linux__)
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    if (fd_ >= 0) {
+      ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  ~CacheMissCounter() {
+#if defined(__linux__)
+    if (fd_ >= 0) close(fd_);
+#endif
+  }
+
+  CacheMissCounter(const CacheMissCounter&) = delete;
+  CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+
+  // Returns -1 when counters are unavailable.
+  int64_t stop() {
+#if defined(__linux__)
+    if (fd_ < 0) return -1;
+    ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+    uint64_t value = 0;
+    if (read(fd_, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) return -1;
+    return static_cast<int64_t>(value);
+#else
+    return -1;
+#endif
+  }
+
+ private:
+  int fd_ = -1;
+};
+
+struct RingFixture {
+  LVKW_Context_Base ctx;
+
+  std::thread consumer;
+  std::atomic<bool> stop_consumer{false};
+
+  std::atomic<uint32_t> producers_done{0};
+
+  // Written by the consumer only.
+  std::vector<uint64_t> latencies_ns;
+  uint64_t dispatched = 0;
+  int64_t consumer_cache_misses = -1;
+
+  static void* alloc(size_t size, void*) { return std::malloc(size); }
+  static void* realloc_cb(void* ptr, size_t size, void*) { return std::realloc(ptr, size); }
+  static void free_cb(void* ptr, void*) { std::free(ptr); }
+
+  static void on_event(LVKW_EventType type, LVKW_Window* window, const LVKW_Event* evt,
+                       void* userdata) {
+    (void)type;
+    (void)window;
+    RingFixture* self = static_cast<RingFixture*>(userdata);
+    uint64_t posted_at;
+    std::memcpy(&posted_at, evt, sizeof(posted_at));
+    const uint64_t now = now_ns();
+    if (self->latencies_ns.size() < kMaxLatencySamples) {
+      self->latencies_ns.push_back(now - posted_at);
+    }
+    self->dispatched++;
+  }
+
+  void init(uint32_t capacity) {
+    std::memset(&ctx, 0, sizeof(ctx));
+    ctx.prv.allocator = {
+        .alloc_cb = &RingFixture::alloc,
+        .realloc_cb = &RingFixture::realloc_cb,
+        .free_cb = &RingFixture::free_cb,
+        .userdata = nullptr,
+    };
+    ctx.prv.event_mask = static_cast<uint32_t>(LVKW_EVENT_TYPE_ALL);
+    ctx.prv.event_callback = &RingFixture::on_event;
+    ctx.prv.event_userdata = this;
+
+    LVKW_EventNotificationRing& ring = ctx.prv.external_notifications;
+    ring.capacity = capacity;
+    ring.buffer = static_cast<LVKW_ExternalEvent*>(
+        std::calloc(capacity, sizeof(LVKW_ExternalEvent)));
+    if (!ring.buffer) std::abort();
+    ring.head = 0;
+    ring.tail = 0;
+    ring.reserve_tail = 0;
+
+    producers_done = 0;
+    latencies_ns.clear();
+    latencies_ns.reserve(kMaxLatencySamples);
+    dispatched = 0;
+    consumer_cache_misses = -1;
+    stop_consumer = false;
+
+    consumer = std::thread([this] {
+      CacheMissCounter counter;
+      while (!stop_consumer.load(std::memory_order_acquire)) {
+        _lvkw_notification_ring_dispatch_all(&ctx);
+      }
+      _lvkw_notification_ring_dispatch_all(&ctx);
+      consumer_cache_misses = counter.stop();
+    });
+  }
+
+  void shutdown() {
+    stop_consumer.store(true, std::memory_order_release);
+    consumer.join();
+    std::free(ctx.prv.external_notifications.buffer);
+    ctx.prv.external_notifications.buffer = nullptr;
+  }
+};
+
+RingFixture g_fixture;
+
+double percentile(const std::vector<uint64_t>& sorted, double p) {
+  if (sorted.empty()) return 0.0;
+  size_t idx = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1));
+  return static_cast<double>(sorted[idx]);
+}
+
+void run_contended_push(benchmark::State& state) {
+  const uint32_t capacity = static_cast<uint32_t>(state.range(0));
+
+  if (state.thread_index() == 0) {
+    g_fixture.init(capacity);
+  }
+
+  LVKW_Window* window = reinterpret_cast<LVKW_Window*>(
+      static_cast<uintptr_t>(state.thread_index() + 1));
+  uint64_t local_pushed = 0;
+  uint64_t local_dropped = 0;
+  CacheMissCounter counter;
+
+  for (auto _ : state) {
+    LVKW_Event evt = {};
+    const uint64_t posted_at = now_ns();
+    std::memcpy(&evt, &posted_at, sizeof(posted_at));
+    if (_lvkw_notification_ring_push(&g_fixture.ctx.prv.external_notifications,
+                                     LVKW_EVENT_TYPE_USER_0, window, &evt)) {
+      local_pushed++;
+    }
+    else {
+      local_dropped++;
+    }
+  }
+
+  const int64_t misses = counter.stop();
+  const double attempts = static_cast<double>(local_pushed + local_dropped);
+
+  // Every producer runs the same iteration count, so averaging per-thread
+  // ratios yields the global ratio.
+  state.SetItemsProcessed(static_cast<int64_t>(local_pushed));
+  state.counters["drop_rate"] = benchmark::Counter(
+      attempts > 0.0 ? static_cast<double>(local_dropped) / attempts : 0.0,
+      benchmark::Counter::kAvgThreads);
+  if (misses >= 0 && attempts > 0.0) {
+    state.counters["producer_misses_per_push"] = benchmark::Counter(
+        static_cast<double>(misses) / attempts, benchmark::Counter::kAvgThreads);
+  }
+
+  // The last producer out stops the consumer and reports the shared figures.
+  // Counters missing from the other threads' maps simply don't contribute to
+  // the per-thread sum.
+  if (g_fixture.producers_done.fetch_add(1, std::memory_order_acq_rel) + 1 !=
+      static_cast<uint32_t>(state.threads())) {
+    return;
+  }
+
+  g_fixture.shutdown();
+
+  std::vector<uint64_t>& lat = g_fixture.latencies_ns;
+  std::sort(lat.begin(), lat.end());
+
+  state.counters["capacity"] = static_cast<double>(capacity);
+  state.counters["producers"] = static_cast<double>(state.threads());
+  state.counters["dispatched"] = static_cast<double>(g_fixture.dispatched);
+  state.counters["lat_p50_ns"] = percentile(lat, 0.50);
+  state.counters["lat_p99_ns"] = percentile(lat, 0.99);
+  state.counters["lat_p999_ns"] = percentile(lat, 0.999);
+
+  if (g_fixture.consumer_cache_misses >= 0 && g_fixture.dispatched > 0) {
+    state.counters["consumer_misses_per_event"] =
+        static_cast<double>(g_fixture.consumer_cache_misses) /
+        static_cast<double>(g_fixture.dispatched);
+  }
+}
+
+void add_arguments(benchmark::internal::Benchmark* bench) {
+  static constexpr int capacities[] = {64, 256, 1024, 4096};
+  for (int c : capacities) {
+    bench->Arg(c);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(run_contended_push)
+    ->Apply(add_arguments)
+    ->ThreadRange(1, 32)
+    ->Unit(benchmark::kNanosecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: Zlib
+// Copyright (c) 2026 François Chabot
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "lvkw/lvkw.h"
+
+namespace {
+
+LVKW_BackendType g_backend = LVKW_BACKEND_AUTO;
+constexpr uint32_t kReadyTimeoutMs = 5000;
+
+constexpr std::array<const char*, LVKW_STARTUP_PHASE_COUNT> kPhaseNames = {
+    "phase_library_load_us", "phase_connect_us", "phase_protocol_discovery_us",
+    "phase_monitors_us",     "phase_keymap_us",  "phase_cursors_us",
+    "phase_controller_scan_us",
+};
+
+struct ReadyState {
+  bool ready = false;
+};
+
+void on_event(LVKW_EventType type, LVKW_Window* window, const LVKW_Event* evt, void* userdata) {
+  (void)window;
+  (void)evt;
+  if (type == LVKW_EVENT_TYPE_WINDOW_READY) {
+    static_cast<ReadyState*>(userdata)->ready = true;
+  }
+}
+
+double to_us(uint64_t ns) { return static_cast<double>(ns) / 1000.0; }
+
+// Accumulates LVKW_StartupMetrics across iterations and reports per-iteration
+// averages as google-benchmark counters.
+struct StartupTotals {
+  uint64_t context_create_ns = 0;
+  std::array<uint64_t, LVKW_STARTUP_PHASE_COUNT> phase_ns = {};
+  uint64_t first_window_create_ns = 0;
+  uint64_t first_window_ready_ns = 0;
+  uint64_t round_trips = 0;
+
+  void add(const LVKW_StartupMetrics& m) {
+    context_create_ns += m.context_create_ns;
+    for (size_t i = 0; i < phase_ns.size(); ++i) phase_ns[i] += m.phase_ns[i];
+    first_window_create_ns += m.first_window_create_ns;
+    first_window_ready_ns += m.first_window_ready_ns;
+    round_trips += m.round_trips;
+  }
+
+  void report(benchmark::State& state, bool with_window) const {
+    auto avg = [](uint64_t ns) {
+      return benchmark::Counter(to_us(ns), benchmark::Counter::kAvgIterations);
+    };
+    state.counters["ctx_create_us"] = avg(context_create_ns);
+    state.counters["round_trips"] =
+        benchmark::Counter(static_cast<double>(round_trips), benchmark::Counter::kAvgIterations);
+    for (size_t i = 0; i < phase_ns.size(); ++i) {
+      state.counters[kPhaseNames[i]] = avg(phase_ns[i]);
+    }
+    if (with_window) {
+      state.counters["window_create_us"] = avg(first_window_create_ns);
+      state.counters["window_ready_us"] = avg(first_window_ready_ns);
+    }
+  }
+};
+
+bool create_context(benchmark::State& state, ReadyState* ready, LVKW_Context** out_ctx) {
+  LVKW_ContextCreateInfo ctx_info = LVKW_CONTEXT_CREATE_INFO_DEFAULT;
+  ctx_info.backend = g_backend;
+  ctx_info.attributes.event_callback = on_event;
+  ctx_info.attributes.event_userdata = ready;
+
+  if (lvkw_context_create(&ctx_info, out_ctx) != LVKW_SUCCESS) {
+    state.SkipWithError("lvkw_context_create() failed (is a display server running?)");
+    return false;
+  }
+  return true;
+}
+
+void run_context_create(benchmark::State& state) {
+  StartupTotals totals;
+
+  for (auto _ : state) {
+    ReadyState ready;
+    LVKW_Context* ctx = nullptr;
+    if (!create_context(state, &ready, &ctx)) break;
+
+    state.PauseTiming();
+    LVKW_StartupMetrics metrics = {};
+    lvkw_instrumentation_getMetrics(ctx, LVKW_METRICS_CATEGORY_STARTUP, &metrics, false);
+    totals.add(metrics);
+    state.ResumeTiming();
+
+    lvkw_context_destroy(ctx);
+  }
+
+  totals.report(state, false);
+}
+
+void run_first_window_ready(benchmark::State& state) {
+  StartupTotals totals;
+
+  for (auto _ : state) {
+    ReadyState ready;
+    LVKW_Context* ctx = nullptr;
+    if (!create_context(state, &ready, &ctx)) break;
+
+    LVKW_WindowCreateInfo window_info = LVKW_WINDOW_CREATE_INFO_DEFAULT;
+    window_info.attributes.title = "lvkw startup bench";
+    window_info.attributes.logical_size = {640, 480};
+
+    LVKW_Window* window = nullptr;
+    if (lvkw_display_createWindow(ctx, &window_info, &window) != LVKW_SUCCESS) {
+      lvkw_context_destroy(ctx);
+      state.SkipWithError("lvkw_display_createWindow() failed");
+      break;
+    }
+
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(kReadyTimeoutMs);
+    while (!ready.ready && std::chrono::steady_clock::now() < deadline) {
+      if (lvkw_events_pump(ctx, 10) != LVKW_SUCCESS) break;
+    }
+
+    if (!ready.ready) {
+      lvkw_display_destroyWindow(window);
+      lvkw_context_destroy(ctx);
+      state.SkipWithError("WINDOW_READY not received within timeout");
+      break;
+    }
+
+    state.PauseTiming();
+    LVKW_StartupMetrics metrics = {};
+    lvkw_instrumentation_getMetrics(ctx, LVKW_METRICS_CATEGORY_STARTUP, &metrics, false);
+    totals.add(metrics);
+    state.ResumeTiming();
+
+    lvkw_display_destroyWindow(window);
+    lvkw_context_destroy(ctx);
+  }
+
+  totals.report(state, true);
+}
+
+// Strips `--lvkw_backend=<auto|wayland|x11>` from argv before google-benchmark
+// sees it.
+bool parse_backend_flag(int* argc, char** argv) {
+  static const char kFlag[] = "--lvkw_backend=";
+  int out = 1;
+  for (int i = 1; i < *argc; ++i) {
+    if (std::strncmp(argv[i], kFlag, sizeof(kFlag) - 1) != 0) {
+      argv[out++] = argv[i];
+      continue;
+    }
+    const std::string value = argv[i] + sizeof(kFlag) - 1;
+    if (value == "auto") {
+      g_backend = LVKW_BACKEND_AUTO;
+    }
+    else if (value == "wayland") {
+      g_backend = LVKW_BACKEND_WAYLAND;
+    }
+    else if (value == "x11") {
+      g_backend = LVKW_BACKEND_X11;
+    }
+    else {
+      return false;
+    }
+  }
+  *argc = out;
+  return true;
+}
+
+}  // namespace
+
+// Every iteration is a full cold start of the library, so keep iteration
+// counts modest.
+BENCHMARK(run_context_create)->Unit(benchmark::kMillisecond)->UseRealTime()->Iterations(50);
+BENCHMARK(run_first_window_ready)->Unit(benchmark::kMillisecond)->UseRealTime()->Iterations(20);
+
+int main(int argc, char** argv) {
+  if (!parse_backend_flag(&argc, argv)) {
+    std::fprintf(stderr, "usage: %s [--lvkw_backend=auto|wayland|x11] [benchmark flags]\n",
+                 argv[0]);
+    return 1;
+  }
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
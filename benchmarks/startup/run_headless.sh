@@ -0,0 +1,70 @@
+#!/bin/bash
+# Runs lvkw_bench_startup against a throwaway headless display server.
+#
+# Usage: benchmarks/startup/run_headless.sh <wayland|x11> <bench-binary> [benchmark flags...]
+set -e
+
+BACKEND="$1"
+BENCH="$2"
+shift 2 || true
+
+if [ -z "$BACKEND" ] || [ -z "$BENCH" ]; then
+    echo "Usage: $0 <wayland|x11> <bench-binary> [benchmark flags...]"
+    exit 1
+fi
+
+RUNTIME_DIR="$(mktemp -d)"
+SERVER_PID=""
+
+cleanup() {
+    if [ -n "$SERVER_PID" ]; then
+        kill "$SERVER_PID" 2>/dev/null || true
+        wait "$SERVER_PID" 2>/dev/null || true
+    fi
+    rm -rf "$RUNTIME_DIR"
+}
+trap cleanup EXIT
+
+wait_for() {
+    for _ in $(seq 1 100); do
+        if [ -e "$1" ]; then return 0; fi
+        sleep 0.05
+    done
+    echo "Error: display server did not come up ($1)."
+    exit 1
+}
+
+case "$BACKEND" in
+    wayland)
+        if ! command -v weston &> /dev/null; then
+            echo "Error: weston not found in PATH."
+            exit 1
+        fi
+        chmod 700 "$RUNTIME_DIR"
+        export XDG_RUNTIME_DIR="$RUNTIME_DIR"
+        weston --backend=headless-backend.so --socket=lvkw-bench --idle-time=0 &> "$RUNTIME_DIR/weston.log" &
+        SERVER_PID=$!
+        wait_for "$RUNTIME_DIR/lvkw-bench"
+        export WAYLAND_DISPLAY=lvkw-bench
+        unset DISPLAY
+        ;;
+    x11)
+        if ! command -v Xvfb &> /dev/null; then
+            echo "Error: Xvfb not found in PATH."
+            exit 1
+        fi
+        DISPLAY_NUM=99
+        while [ -e "/tmp/.X11-unix/X$DISPLAY_NUM" ]; do DISPLAY_NUM=$((DISPLAY_NUM + 1)); done
+        Xvfb ":$DISPLAY_NUM" -screen 0 1920x1080x24 -nolisten tcp &> "$RUNTIME_DIR/xvfb.log" &
+        SERVER_PID=$!
+        wait_for "/tmp/.X11-unix/X$DISPLAY_NUM"
+        export DISPLAY=":$DISPLAY_NUM"
+        unset WAYLAND_DISPLAY
+        ;;
+    *)
+        echo "Error: unknown backend '$BACKEND' (expected wayland or x11)."
+        exit 1
+        ;;
+esac
+
+"$BENCH" --lvkw_backend="$BACKEND" "$@"
@@ -64,6 +64,8 @@ void vulkan_renderer_init(VulkanRenderer* renderer, uint32_t extension_count, co
   renderer->swapChainImages = NULL;
   renderer->swapChainImageViews = NULL;
   renderer->swapChainFramebuffers = NULL;
+  renderer->lastPresentNs = 0;
+  renderer->lastPresentIntervalNs = 0;
 
   create_instance(renderer, extension_count, extensions);
 }
@@ -222,6 +224,12 @@ void vulkan_renderer_draw_frame(VulkanRenderer* renderer) {
     exit(EXIT_FAILURE);
   }
 
+  uint64_t present_ns = lvkw_instrumentation_getTimestamp();
+  if (renderer->lastPresentNs != 0) {
+    renderer->lastPresentIntervalNs = present_ns - renderer->lastPresentNs;
+  }
+  renderer->lastPresentNs = present_ns;
+
   renderer->currentFrame = (renderer->currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
 }
 
@@ -44,6 +44,11 @@ typedef struct VulkanRenderer {
   uint32_t currentFrame;
 
   bool framebufferResized;
+
+  // Frame timing, in the lvkw_instrumentation_getTimestamp() domain. 0 until
+  // the first frame has been presented.
+  uint64_t lastPresentNs;          // Right after vkQueuePresentKHR() returned.
+  uint64_t lastPresentIntervalNs;  // Time between the last two presents.
 } VulkanRenderer;
 
 void vulkan_renderer_init(VulkanRenderer* renderer, uint32_t extension_count, const char** extensions);
@@ -46,6 +46,11 @@ typedef enum LVKW_ContextFlags {
 struct LVKW_Context {
   void *userdata;  ///< User-controlled pointer. You CAN override it directly.
   LVKW_READONLY uint32_t flags;  ///< Bitmask of LVKW_ContextFlags.
+  LVKW_READONLY uint64_t event_timestamp_ns;  ///< OS timestamp of the event currently being
+                                              ///< dispatched, in the clock domain of
+                                              ///< @ref lvkw_instrumentation_getTimestamp. 0 if
+                                              ///< the event carries no OS timestamp. Only
+                                              ///< meaningful inside the event callback.
 };
 
 /* ----- Context Management ----- */
@@ -125,10 +130,21 @@ typedef struct LVKW_ContextTuning {
     /**
      * @brief Polling period for X11 system-idle detection, in milliseconds.
      *
-     * Used only by the X11 backend when querying XScreenSaver idle state.
+     * Used only by the X11 backend, and only when the server lacks the SYNC IDLETIME counter and
+     * idle state has to be polled through XScreenSaver.
      * Set to 0 to use backend default.
      */
     uint32_t idle_poll_interval_ms;
+    /**
+     * @brief If true, pointer motion and resizes are merged within each batch of events read
+     * from the X server.
+     *
+     * Consecutive MOUSE_MOTION events for the same window become one, carrying the latest
+     * position and the summed deltas. WINDOW_RESIZED is reported once per window per batch,
+     * with the final geometry. Other events keep their order relative to motion.
+     * Off by default: intermediate pointer samples are dropped when it is on.
+     */
+    bool coalesce_events;
   } x11;
 
   /**
@@ -150,7 +166,7 @@ typedef struct LVKW_ContextTuning {
    .wayland =                                                                            \
        {.decoration_mode = LVKW_WAYLAND_DECORATION_MODE_AUTO, .dnd_post_drop_timeout_ms = 1000, \
         .enforce_client_side_constraints = true},                                         \
-   .x11 = {.idle_poll_interval_ms = 250},                                                 \
+   .x11 = {.idle_poll_interval_ms = 250, .coalesce_events = false},                       \
    .vk_loader = NULL}
 
 /** @brief Parameters for lvkw_context_create(). */
@@ -78,6 +78,10 @@ typedef enum LVKW_EventType {
   LVKW_EVENT_TYPE_DND_DROP = 1 << 16,
   LVKW_EVENT_TYPE_TEXT_COMPOSITION = 1 << 17,
   LVKW_EVENT_TYPE_DATA_READY = 1 << 18,
+  LVKW_EVENT_TYPE_FRAME = 1 << 19,
+  LVKW_EVENT_TYPE_PRESENTATION = 1 << 20,
+  LVKW_EVENT_TYPE_TOUCH = 1 << 21,
+  LVKW_EVENT_TYPE_PEN = 1 << 22,
 
   LVKW_EVENT_TYPE_CONTROLLER_CONNECTION = 1 << 27,
 
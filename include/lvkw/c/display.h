@@ -147,6 +147,8 @@ typedef enum LVKW_WindowAttributesField {
   LVKW_WINDOW_ATTR_TEXT_INPUT_TYPE = 1 << 14,
   LVKW_WINDOW_ATTR_TEXT_INPUT_RECT = 1 << 15,
   LVKW_WINDOW_ATTR_PRIMARY_SELECTION = 1 << 16,
+  LVKW_WINDOW_ATTR_FRAME_EVENTS = 1 << 17,
+  LVKW_WINDOW_ATTR_PRESENTATION_FEEDBACK = 1 << 18,
 } LVKW_WindowAttributesField;
 
 /** @brief Live-updatable window properties. */
@@ -166,6 +168,8 @@ typedef struct LVKW_WindowAttributes {
   bool mouse_passthrough;
   bool accept_dnd;
   bool primary_selection;
+  bool frame_events;
+  bool presentation_feedback;
   LVKW_TextInputType text_input_type;
   LVKW_LogicalRect text_input_rect;
 } LVKW_WindowAttributes;
@@ -196,6 +200,8 @@ typedef struct LVKW_WindowCreateInfo {
                   .mouse_passthrough = false,                   \
                   .accept_dnd = false,                          \
                   .primary_selection = true,                    \
+                  .frame_events = false,                        \
+                  .presentation_feedback = false,               \
                   .text_input_type = LVKW_TEXT_INPUT_TYPE_NONE, \
                   .text_input_rect = {{0, 0}, {0, 0}}},         \
    .app_id = "lvkw.app",                                        \
@@ -241,6 +247,18 @@ LVKW_COLD LVKW_Status lvkw_display_getWindowGeometry(LVKW_Window *window,
 
 LVKW_COLD LVKW_Status lvkw_display_requestWindowFocus(LVKW_Window *window);
 
+/**
+ * @brief Tells the system that a frame at the window's latest size has been presented.
+ *
+ * Call it after presenting the first frame that follows LVKW_EVENT_TYPE_WINDOW_RESIZED. On X11,
+ * window managers that support _NET_WM_SYNC_REQUEST hold back further resizes until then, so an
+ * interactive resize runs at the app's frame rate instead of outpacing swapchain recreation.
+ * A resize that was not acknowledged is acknowledged by the next lvkw_events_pump().
+ *
+ * Other backends pace resizes on their own, and this is a no-op there.
+ */
+LVKW_HOT LVKW_Status lvkw_display_ackWindowResize(LVKW_Window *window);
+
 #ifdef __cplusplus
 }
 #endif
@@ -51,6 +51,7 @@ typedef struct LVKW_KeyboardEvent {
   LVKW_Key key;
   LVKW_ButtonState state;
   LVKW_ModifierFlags modifiers;
+  bool repeat;  ///< Synthesized by key repeat while the key is held down.
 } LVKW_KeyboardEvent;
 
 /** @brief Fired when mouse pointer moves. */
@@ -67,13 +68,34 @@ typedef struct LVKW_MouseButtonEvent {
   LVKW_ModifierFlags modifiers;
 } LVKW_MouseButtonEvent;
 
+/** @brief Physical origin of a scroll event. */
+typedef enum LVKW_ScrollSource {
+  LVKW_SCROLL_SOURCE_UNKNOWN = 0,
+  LVKW_SCROLL_SOURCE_WHEEL = 1,       ///< Discrete mouse wheel notches.
+  LVKW_SCROLL_SOURCE_FINGER = 2,      ///< Fingers on a touchpad or touchscreen.
+  LVKW_SCROLL_SOURCE_CONTINUOUS = 3,  ///< Continuous motion, e.g. a trackpoint or button-scrolling.
+  LVKW_SCROLL_SOURCE_WHEEL_TILT = 4,  ///< Side-to-side tilt of a mouse wheel.
+} LVKW_ScrollSource;
+
+/** @brief Bitmask qualifying a scroll event. */
+typedef enum LVKW_ScrollFlags {
+  LVKW_SCROLL_STOP_X = 1 << 0,  ///< Horizontal scrolling ended; a good time to start kinetic scrolling.
+  LVKW_SCROLL_STOP_Y = 1 << 1,  ///< Vertical scrolling ended; a good time to start kinetic scrolling.
+} LVKW_ScrollFlags;
+
 /** @brief Fired on scroll wheel/touchpad scroll gestures. */
 typedef struct LVKW_MouseScrollEvent {
   LVKW_LogicalVec delta;
   struct {
     int32_t x;
     int32_t y;
-  } steps;
+  } steps;  ///< Whole wheel notches.
+  struct {
+    int32_t x;
+    int32_t y;
+  } value120;  ///< Wheel motion in 1/120ths of a notch, for high-resolution wheels. 0 if not a wheel.
+  LVKW_ScrollSource source;
+  uint32_t flags;  ///< LVKW_ScrollFlags.
 } LVKW_MouseScrollEvent;
 
 /** @brief Fired when the system idle state changes. */
@@ -102,6 +124,7 @@ typedef struct LVKW_SyncEvent {
 typedef struct LVKW_TextInputEvent {
   LVKW_TRANSIENT const char *text;
   uint32_t length;
+  bool repeat;  ///< Produced by a repeated key press.
 } LVKW_TextInputEvent;
 
 /** @brief Fired during active IME preedit composition. */
@@ -157,6 +180,121 @@ typedef struct LVKW_DataReadyEvent {
   size_t size;
 } LVKW_DataReadyEvent;
 
+/**
+ * @brief Fired when the compositor signals that a new frame would be useful.
+ *
+ * Only delivered to windows with LVKW_WindowAttributes::frame_events set.
+ * Windows that are hidden or fully occluded stop receiving it.
+ */
+typedef struct LVKW_FrameEvent {
+  uint64_t timestamp_ns;  ///< Compositor frame time, on the lvkw_instrumentation_getTimestamp() clock.
+} LVKW_FrameEvent;
+
+/** @brief Bitmask describing how a frame reached the screen. */
+typedef enum LVKW_PresentationFlags {
+  LVKW_PRESENTATION_VSYNC = 1 << 0,          ///< Synchronized to the vertical retrace, no tearing.
+  LVKW_PRESENTATION_HW_CLOCK = 1 << 1,       ///< The timestamp comes from the display hardware.
+  LVKW_PRESENTATION_HW_COMPLETION = 1 << 2,  ///< The hardware signalled the switch to the new image.
+  LVKW_PRESENTATION_ZERO_COPY = 1 << 3,      ///< The buffer was scanned out without compositing.
+  LVKW_PRESENTATION_DISCARDED = 1 << 4,      ///< The frame was never displayed.
+} LVKW_PresentationFlags;
+
+/**
+ * @brief Fired when a frame committed to the window reached the screen, or was discarded.
+ *
+ * Only delivered to windows with LVKW_WindowAttributes::presentation_feedback set.
+ * Feedback is requested on the same cadence as LVKW_FrameEvent, so not every
+ * frame is reported if the application renders faster than the compositor.
+ */
+typedef struct LVKW_PresentationEvent {
+  uint64_t present_ns;  ///< When the frame turned into light, on the
+                        ///< lvkw_instrumentation_getTimestamp() clock. 0 if discarded.
+  uint64_t sequence;    ///< Output refresh counter at presentation, 0 if unknown.
+  uint32_t refresh_ns;  ///< Output refresh period, 0 if unknown or variable.
+  uint32_t flags;       ///< LVKW_PresentationFlags.
+} LVKW_PresentationEvent;
+
+/** @brief What happened to a touch contact. */
+typedef enum LVKW_TouchState {
+  LVKW_TOUCH_STATE_DOWN = 0,       ///< The contact started.
+  LVKW_TOUCH_STATE_MOTION = 1,     ///< The contact moved.
+  LVKW_TOUCH_STATE_UP = 2,         ///< The contact was lifted.
+  LVKW_TOUCH_STATE_CANCELLED = 3,  ///< The system took over the contact (e.g. for a gesture).
+} LVKW_TouchState;
+
+/** @brief One touch contact that changed during a touch frame. */
+typedef struct LVKW_TouchContact {
+  uint64_t timestamp_ns;     ///< When the change happened, on the lvkw_instrumentation_getTimestamp() clock.
+  LVKW_LogicalVec position;  ///< Window-relative position. Last known position for UP and CANCELLED.
+  int32_t id;                ///< Unique while the contact is down; may be reused afterwards.
+  LVKW_TouchState state;
+} LVKW_TouchContact;
+
+/**
+ * @brief Fired once per touch frame with every contact that changed in it.
+ *
+ * Contacts that did not move since the previous frame are not listed.
+ */
+typedef struct LVKW_TouchEvent {
+  LVKW_TRANSIENT const LVKW_TouchContact *contacts;
+  uint32_t contact_count;
+} LVKW_TouchEvent;
+
+/** @brief Physical kind of a pen tool, as reported by the tablet. */
+typedef enum LVKW_PenTool {
+  LVKW_PEN_TOOL_PEN = 0,
+  LVKW_PEN_TOOL_ERASER = 1,
+  LVKW_PEN_TOOL_BRUSH = 2,
+  LVKW_PEN_TOOL_PENCIL = 3,
+  LVKW_PEN_TOOL_AIRBRUSH = 4,
+  LVKW_PEN_TOOL_FINGER = 5,
+  LVKW_PEN_TOOL_MOUSE = 6,
+  LVKW_PEN_TOOL_LENS = 7,
+} LVKW_PenTool;
+
+/** @brief State bits of a pen sample. */
+typedef enum LVKW_PenSampleFlags {
+  LVKW_PEN_SAMPLE_DOWN = 1 << 0,            ///< The tip is touching the tablet.
+  LVKW_PEN_SAMPLE_PROXIMITY_IN = 1 << 1,    ///< First sample since the tool came into range.
+  LVKW_PEN_SAMPLE_PROXIMITY_OUT = 1 << 2,   ///< The tool left the range of the tablet or the window.
+  LVKW_PEN_SAMPLE_HAS_PRESSURE = 1 << 3,    ///< The tool reports pressure.
+  LVKW_PEN_SAMPLE_HAS_TILT = 1 << 4,        ///< The tool reports tilt.
+  LVKW_PEN_SAMPLE_HAS_DISTANCE = 1 << 5,    ///< The tool reports hover distance.
+  LVKW_PEN_SAMPLE_HAS_ROTATION = 1 << 6,    ///< The tool reports barrel rotation.
+} LVKW_PenSampleFlags;
+
+/** @brief Bitmask of the pen's barrel buttons. */
+typedef enum LVKW_PenButtons {
+  LVKW_PEN_BUTTON_1 = 1 << 0,  ///< Lower barrel button.
+  LVKW_PEN_BUTTON_2 = 1 << 1,  ///< Upper barrel button.
+  LVKW_PEN_BUTTON_3 = 1 << 2,  ///< Third barrel button, on tools that have one.
+} LVKW_PenButtons;
+
+/** @brief Complete state of a pen tool at one hardware report. */
+typedef struct LVKW_PenSample {
+  uint64_t timestamp_ns;     ///< Hardware report time, on the lvkw_instrumentation_getTimestamp() clock.
+  LVKW_LogicalVec position;  ///< Window-relative position.
+  LVKW_LogicalVec tilt;      ///< Tilt from the perpendicular, in degrees.
+  LVKW_Scalar pressure;      ///< 0 to 1.
+  LVKW_Scalar distance;      ///< Hover distance, 0 (touching) to 1 (edge of range).
+  LVKW_Scalar rotation;      ///< Barrel rotation, in degrees.
+  uint32_t buttons;          ///< LVKW_PenButtons.
+  uint32_t flags;            ///< LVKW_PenSampleFlags.
+} LVKW_PenSample;
+
+/**
+ * @brief Fired with every pen sample received for a tool since the previous event.
+ *
+ * Tablets report at several hundred Hz. Samples are batched per lvkw_events_pump()
+ * iteration, so a painting application gets every sample of the frame in one call.
+ */
+typedef struct LVKW_PenEvent {
+  LVKW_TRANSIENT const LVKW_PenSample *samples;
+  uint32_t sample_count;
+  LVKW_PenTool tool;
+  uint64_t tool_serial;  ///< Unique hardware serial of the tool, 0 if unknown.
+} LVKW_PenEvent;
+
 /** @brief Unified standard event payload union. */
 typedef struct LVKW_Event {
   union {
@@ -182,6 +320,10 @@ typedef struct LVKW_Event {
     LVKW_DndLeaveEvent dnd_leave;
     LVKW_DndDropEvent dnd_drop;
     LVKW_DataReadyEvent data_ready;
+    LVKW_FrameEvent frame;
+    LVKW_PresentationEvent presentation;
+    LVKW_TouchEvent touch;
+    LVKW_PenEvent pen;
   };
 } LVKW_Event;
 
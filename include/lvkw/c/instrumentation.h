@@ -75,7 +75,10 @@ typedef void (*LVKW_DiagnosticCallback)(const LVKW_DiagnosticInfo *info, void *u
  */
 typedef enum LVKW_MetricsCategory {
   LVKW_METRICS_CATEGORY_NONE = 0,
-  LVKW_METRICS_CATEGORY_EVENTS = 1,  ///< Returns LVKW_EventMetrics snapshot.
+  LVKW_METRICS_CATEGORY_EVENTS = 1,   ///< Returns LVKW_EventMetrics snapshot.
+  LVKW_METRICS_CATEGORY_STARTUP = 2,  ///< Returns LVKW_StartupMetrics snapshot.
+  LVKW_METRICS_CATEGORY_MEMORY = 3,   ///< Returns LVKW_MemoryMetrics snapshot.
+  LVKW_METRICS_CATEGORY_PRESENTATION = 4,  ///< Returns LVKW_PresentationMetrics snapshot.
 } LVKW_MetricsCategory;
 
 /**
@@ -87,8 +90,94 @@ typedef struct LVKW_EventMetrics {
                               ///< buffer.
   uint32_t drop_count;        ///< Total events dropped due to max_capacity since last
                               ///< reset.
+  uint32_t peak_frame_size;   ///< Largest number of events delivered as one atomic backend
+                              ///< frame since last reset. Only tracked on Wayland.
 } LVKW_EventMetrics;
 
+/**
+ * @brief Coarse phases of context creation, as reported by LVKW_StartupMetrics.
+ * @note Phases a backend does not go through are reported as 0.
+ */
+typedef enum LVKW_StartupPhase {
+  LVKW_STARTUP_PHASE_LIBRARY_LOAD = 0,    ///< dlopen()/dlsym() of system libraries.
+  LVKW_STARTUP_PHASE_CONNECT,             ///< Connection to the display server.
+  LVKW_STARTUP_PHASE_PROTOCOL_DISCOVERY,  ///< Registry round-trips, extension and atom
+                                          ///< queries.
+  LVKW_STARTUP_PHASE_MONITORS,            ///< Initial monitor enumeration.
+  LVKW_STARTUP_PHASE_KEYMAP,              ///< Keyboard context and keymap setup.
+  LVKW_STARTUP_PHASE_CURSORS,             ///< Cursor theme loading.
+  LVKW_STARTUP_PHASE_CONTROLLER_SCAN,     ///< Initial controller device scan.
+  LVKW_STARTUP_PHASE_COUNT
+} LVKW_StartupPhase;
+
+/**
+ * @brief Startup latency breakdown, in nanoseconds unless stated otherwise.
+ * @note Values are recorded once and are not affected by the `reset` flag.
+ */
+typedef struct LVKW_StartupMetrics {
+  uint64_t context_create_ns;  ///< Total time spent in lvkw_context_create().
+  uint64_t phase_ns[LVKW_STARTUP_PHASE_COUNT];  ///< Per-phase share of context_create_ns.
+  uint64_t first_window_create_ns;  ///< Time spent in the first lvkw_display_createWindow().
+  uint64_t first_window_ready_ns;   ///< Time from entering the first
+                                    ///< lvkw_display_createWindow() to its WINDOW_READY event.
+  uint32_t round_trips;  ///< Synchronous display server round-trips made by
+                         ///< lvkw_context_create(), connection setup excluded.
+} LVKW_StartupMetrics;
+
+/**
+ * @brief Subsystems that context allocations are attributed to, as reported by
+ * LVKW_MemoryMetrics.
+ */
+typedef enum LVKW_MemoryTag {
+  LVKW_MEMORY_TAG_CORE = 0,        ///< Context, windows, event ring and anything not
+                                   ///< listed below.
+  LVKW_MEMORY_TAG_CLIPBOARD,       ///< Clipboard and primary selection caches.
+  LVKW_MEMORY_TAG_DND,             ///< Drag and drop payloads and offers.
+  LVKW_MEMORY_TAG_TRANSFERS,       ///< Asynchronous data transfer buffers.
+  LVKW_MEMORY_TAG_CONTROLLERS,     ///< Controller devices and their state.
+  LVKW_MEMORY_TAG_MONITORS,        ///< Monitors and video mode lists.
+  LVKW_MEMORY_TAG_CURSORS,         ///< Standard and custom cursors.
+  LVKW_MEMORY_TAG_STRING_CACHE,    ///< Interned strings.
+  LVKW_MEMORY_TAG_COUNT
+} LVKW_MemoryTag;
+
+/**
+ * @brief Allocation counters for a single LVKW_MemoryTag, or for all of them.
+ */
+typedef struct LVKW_MemoryUsage {
+  uint64_t live_bytes;   ///< Bytes currently allocated.
+  uint64_t peak_bytes;   ///< High watermark of live_bytes since last reset.
+  uint64_t alloc_count;  ///< Allocations (including reallocations) since last reset.
+  uint64_t free_count;   ///< Frees since last reset.
+} LVKW_MemoryUsage;
+
+/**
+ * @brief Memory attributed to the context, through its allocator.
+ * @note Requested sizes only. With LVKW_GATHER_METRICS, every allocation also
+ * carries a 16-byte bookkeeping header that is not counted here.
+ */
+typedef struct LVKW_MemoryMetrics {
+  LVKW_MemoryUsage total;
+  LVKW_MemoryUsage tags[LVKW_MEMORY_TAG_COUNT];
+} LVKW_MemoryMetrics;
+
+/**
+ * @brief Frame pacing, aggregated over every window with presentation feedback enabled.
+ * @note Missed frames and jitter are only meaningful while the application renders
+ * continuously, one window at a time.
+ */
+typedef struct LVKW_PresentationMetrics {
+  uint64_t presented_count;   ///< Frames reported as displayed since last reset.
+  uint64_t discarded_count;   ///< Frames reported as never displayed since last reset.
+  uint64_t missed_frames;     ///< Refresh cycles skipped between consecutive presented
+                              ///< frames since last reset.
+  uint64_t refresh_ns;        ///< Latest output refresh period, 0 if unknown.
+  uint64_t last_interval_ns;  ///< Time between the two latest presented frames.
+  uint64_t mean_jitter_ns;    ///< Mean change between consecutive intervals since last reset.
+  uint64_t max_jitter_ns;     ///< Largest change between consecutive intervals since last
+                              ///< reset.
+} LVKW_PresentationMetrics;
+
 /**
  * @brief Retrieves a specific category of metrics data from the context.
  *
@@ -105,6 +194,15 @@ LVKW_COLD LVKW_Status lvkw_instrumentation_getMetrics(LVKW_Context *context,
                                                       LVKW_MetricsCategory category,
                                                       void *out_data, bool reset);
 
+/**
+ * @brief Reads the monotonic clock used for event timestamps, in nanoseconds.
+ *
+ * Compare against LVKW_Context::event_timestamp_ns to measure how old an event
+ * is by the time it reaches your code.
+ * @note Threading: callable from any thread.
+ */
+LVKW_HOT uint64_t lvkw_instrumentation_getTimestamp(void);
+
 /**
  * @brief Convenience setter for context diagnostic callback attributes.
  */
@@ -32,6 +32,9 @@ static inline LVKW_Status lvkw_display_setWindowTextInputType(LVKW_Window *windo
                                                                LVKW_TextInputType type);
 static inline LVKW_Status lvkw_display_setWindowTextInputRect(LVKW_Window *window,
                                                                LVKW_LogicalRect rect);
+static inline LVKW_Status lvkw_display_setWindowFrameEvents(LVKW_Window *window, bool enabled);
+static inline LVKW_Status lvkw_display_setWindowPresentationFeedback(LVKW_Window *window,
+                                                                     bool enabled);
 
 #ifdef __cplusplus
 }
@@ -35,6 +35,10 @@ concept PartialEventVisitor = std::invocable<std::remove_cvref_t<T>, WindowReady
                               std::invocable<std::remove_cvref_t<T>, TextInputEvent> ||
                               std::invocable<std::remove_cvref_t<T>, TextCompositionEvent> ||
                               std::invocable<std::remove_cvref_t<T>, FocusEvent> ||
+                              std::invocable<std::remove_cvref_t<T>, FrameEvent> ||
+                              std::invocable<std::remove_cvref_t<T>, PresentationEvent> ||
+                              std::invocable<std::remove_cvref_t<T>, TouchEvent> ||
+                              std::invocable<std::remove_cvref_t<T>, PenEvent> ||
                               std::invocable<std::remove_cvref_t<T>, DndHoverEvent> ||
                               std::invocable<std::remove_cvref_t<T>, DndLeaveEvent> ||
                               std::invocable<std::remove_cvref_t<T>, DndDropEvent>
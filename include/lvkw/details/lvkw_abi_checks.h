@@ -37,6 +37,9 @@ LVKW_STATIC_ASSERT(sizeof(LVKW_DndHoverEvent) <= LVKW_EXPECTED_EVENT_SIZE,
 LVKW_STATIC_ASSERT(sizeof(LVKW_MouseMotionEvent) <= LVKW_EXPECTED_EVENT_SIZE,
                    "LVKW_MouseMotionEvent exceeds size limit.");
 
+LVKW_STATIC_ASSERT(sizeof(LVKW_MouseScrollEvent) <= LVKW_EXPECTED_EVENT_SIZE,
+                   "LVKW_MouseScrollEvent exceeds size limit.");
+
 #endif
 
 #endif /* LVKW_DETAILS_ABI_CHECKS_H_INCLUDED */
@@ -66,6 +66,19 @@ void dispatchVisitor(LVKW_EventType type, LVKW_Window *window, const LVKW_Event
     case LVKW_EVENT_TYPE_FOCUS:
       if constexpr (std::invocable<F_raw, FocusEvent>) f(FocusEvent{window, evt.focus});
       break;
+    case LVKW_EVENT_TYPE_FRAME:
+      if constexpr (std::invocable<F_raw, FrameEvent>) f(FrameEvent{window, evt.frame});
+      break;
+    case LVKW_EVENT_TYPE_PRESENTATION:
+      if constexpr (std::invocable<F_raw, PresentationEvent>)
+        f(PresentationEvent{window, evt.presentation});
+      break;
+    case LVKW_EVENT_TYPE_TOUCH:
+      if constexpr (std::invocable<F_raw, TouchEvent>) f(TouchEvent{window, evt.touch});
+      break;
+    case LVKW_EVENT_TYPE_PEN:
+      if constexpr (std::invocable<F_raw, PenEvent>) f(PenEvent{window, evt.pen});
+      break;
     case LVKW_EVENT_TYPE_DND_HOVER:
       if constexpr (std::invocable<F_raw, DndHoverEvent>) f(DndHoverEvent{window, evt.dnd_hover});
       break;
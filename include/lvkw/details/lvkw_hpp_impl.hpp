@@ -195,10 +195,26 @@ inline void Window::setMousePassthrough(bool passthrough) {
   update(LVKW_WINDOW_ATTR_MOUSE_PASSTHROUGH, attrs);
 }
 
+inline void Window::setFrameEvents(bool enabled) {
+  LVKW_WindowAttributes attrs = {};
+  attrs.frame_events = enabled;
+  update(LVKW_WINDOW_ATTR_FRAME_EVENTS, attrs);
+}
+
+inline void Window::setPresentationFeedback(bool enabled) {
+  LVKW_WindowAttributes attrs = {};
+  attrs.presentation_feedback = enabled;
+  update(LVKW_WINDOW_ATTR_PRESENTATION_FEEDBACK, attrs);
+}
+
 inline void Window::requestFocus() {
   check(lvkw_display_requestWindowFocus(m_window_handle), "Failed to request focus");
 }
 
+inline void Window::ackResize() {
+  check(lvkw_display_ackWindowResize(m_window_handle), "Failed to acknowledge resize");
+}
+
 inline void Window::setClipboardText(const char *text) {
   check(lvkw_data_setClipboardText(m_window_handle, text), "Failed to set clipboard text");
 }
@@ -384,6 +400,8 @@ inline void Context::setDiagnosticCallback(LVKW_DiagnosticCallback callback, voi
 
 inline bool Context::isLost() const { return m_ctx_handle->flags & LVKW_CONTEXT_STATE_LOST; }
 
+inline uint64_t Context::getEventTimestamp() const { return m_ctx_handle->event_timestamp_ns; }
+
 inline void *Context::getUserData() const { return m_ctx_handle->userdata; }
 
 inline void Context::setUserData(void *userdata) { m_ctx_handle->userdata = userdata; }
@@ -467,6 +485,9 @@ inline Controller Context::createController(LVKW_ControllerRef *controller_ref)
 template <typename T>
 LVKW_MetricsCategory Context::getCategory() {
   if (std::is_same<T, LVKW_EventMetrics>::value) return LVKW_METRICS_CATEGORY_EVENTS;
+  if (std::is_same<T, LVKW_StartupMetrics>::value) return LVKW_METRICS_CATEGORY_STARTUP;
+  if (std::is_same<T, LVKW_MemoryMetrics>::value) return LVKW_METRICS_CATEGORY_MEMORY;
+  if (std::is_same<T, LVKW_PresentationMetrics>::value) return LVKW_METRICS_CATEGORY_PRESENTATION;
   return LVKW_METRICS_CATEGORY_NONE;
 }
 
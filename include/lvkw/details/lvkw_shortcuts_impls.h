@@ -110,6 +110,19 @@ static inline LVKW_Status lvkw_display_setWindowTextInputRect(LVKW_Window *windo
   return lvkw_display_updateWindow(window, LVKW_WINDOW_ATTR_TEXT_INPUT_RECT, &attrs);
 }
 
+static inline LVKW_Status lvkw_display_setWindowFrameEvents(LVKW_Window *window, bool enabled) {
+  LVKW_WindowAttributes attrs = {0};
+  attrs.frame_events = enabled;
+  return lvkw_display_updateWindow(window, LVKW_WINDOW_ATTR_FRAME_EVENTS, &attrs);
+}
+
+static inline LVKW_Status lvkw_display_setWindowPresentationFeedback(LVKW_Window *window,
+                                                                     bool enabled) {
+  LVKW_WindowAttributes attrs = {0};
+  attrs.presentation_feedback = enabled;
+  return lvkw_display_updateWindow(window, LVKW_WINDOW_ATTR_PRESENTATION_FEEDBACK, &attrs);
+}
+
 #ifdef __cplusplus
 }
 #endif
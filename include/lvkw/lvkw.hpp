@@ -54,6 +54,10 @@ typedef Event<LVKW_MonitorModeEvent> MonitorModeEvent;
 typedef Event<LVKW_TextInputEvent> TextInputEvent;
 typedef Event<LVKW_TextCompositionEvent> TextCompositionEvent;
 typedef Event<LVKW_FocusEvent> FocusEvent;
+typedef Event<LVKW_FrameEvent> FrameEvent;
+typedef Event<LVKW_PresentationEvent> PresentationEvent;
+typedef Event<LVKW_TouchEvent> TouchEvent;
+typedef Event<LVKW_PenEvent> PenEvent;
 
 /**
  * C++ wrapper for DND feedback state.
@@ -275,10 +279,25 @@ class Window {
    *  @param passthrough True to enable passthrough. */
   void setMousePassthrough(bool passthrough);
 
+  /** Toggles delivery of LVKW_EVENT_TYPE_FRAME for this window.
+   *  @note Only the Wayland backend currently emits frame events.
+   *  @param enabled True to receive frame events. */
+  void setFrameEvents(bool enabled);
+
+  /** Toggles delivery of LVKW_EVENT_TYPE_PRESENTATION for this window.
+   *  @note Only the Wayland backend currently emits presentation events.
+   *  @param enabled True to receive presentation feedback. */
+  void setPresentationFeedback(bool enabled);
+
   /** Asks the system to give this window input focus.
    *  @throws Exception if the request fails. */
   void requestFocus();
 
+  /** Reports that a frame at the window's latest size has been presented.
+   *  @note Only the X11 backend acts on it. See lvkw_display_ackWindowResize().
+   *  @throws Exception if the call fails. */
+  void ackResize();
+
   /** Sets the system clipboard content to a UTF-8 string.
    *  @param text The null-terminated UTF-8 string to copy.
    *  @note On Wayland, this requires a recent valid input serial and
@@ -497,6 +516,11 @@ class Context {
    */
   bool isLost() const;
 
+  /** Returns the OS timestamp of the event currently being dispatched.
+   *  @return Nanoseconds in the lvkw_instrumentation_getTimestamp() domain, or 0
+   *  when called outside the event callback or for events without one. */
+  uint64_t getEventTimestamp() const;
+
   /** Returns your custom global user data pointer.
    *  @return The global userdata pointer. */
   void *getUserData() const;
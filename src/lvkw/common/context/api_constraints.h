@@ -369,6 +369,12 @@ static inline LVKW_Status _lvkw_api_constraints_wnd_requestFocus(LVKW_Window *wi
   return LVKW_SUCCESS;
 }
 
+static inline LVKW_Status _lvkw_api_constraints_wnd_ackResize(LVKW_Window *window) {
+  LVKW_CONSTRAINT_WND_VALID_AND_READY(window);
+  LVKW_CONSTRAINT_CTX_THREAD_PRIMARY(((LVKW_Window_Base *)window)->prv.ctx_base);
+  return LVKW_SUCCESS;
+}
+
 LVKW_Status lvkw_data_getClipboardText(LVKW_Window *window, const char **out_text);
 LVKW_Status lvkw_data_setClipboardData(LVKW_Window *window, const LVKW_ClipboardData *data,
                                       uint32_t count);
@@ -441,6 +447,25 @@ static inline LVKW_Status _lvkw_api_constraints_data_pullData(LVKW_Window *windo
   return _lvkw_api_constraints_data_target(window, target);
 }
 
+static inline LVKW_Status _lvkw_api_constraints_data_pullTextAsync(LVKW_Window *window,
+                                                                   LVKW_DataExchangeTarget target,
+                                                                   void *user_tag) {
+  (void)user_tag;
+  LVKW_CONSTRAINT_WND_VALID_AND_READY(window);
+  LVKW_CONSTRAINT_CTX_THREAD_PRIMARY(((LVKW_Window_Base *)window)->prv.ctx_base);
+  return _lvkw_api_constraints_data_target(window, target);
+}
+
+static inline LVKW_Status _lvkw_api_constraints_data_pullDataAsync(LVKW_Window *window,
+                                                                   LVKW_DataExchangeTarget target,
+                                                                   const char *mime_type,
+                                                                   void *user_tag) {
+  LVKW_Status status = _lvkw_api_constraints_data_pullTextAsync(window, target, user_tag);
+  if (status != LVKW_SUCCESS) return status;
+  LVKW_WINDOW_ARG_CONSTRAINT(window, mime_type != NULL, "mime_type must not be NULL");
+  return LVKW_SUCCESS;
+}
+
 static inline LVKW_Status _lvkw_api_constraints_data_listBufferMimeTypes(
     LVKW_Window *window, LVKW_DataExchangeTarget target, const char ***out_mime_types,
     uint32_t *count) {
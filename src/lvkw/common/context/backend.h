@@ -25,6 +25,7 @@ typedef struct LVKW_Backend {
     __typeof__(lvkw_display_createVkSurface) *create_vk_surface;
     __typeof__(lvkw_display_getWindowGeometry) *get_geometry;
     __typeof__(lvkw_display_requestWindowFocus) *request_focus;
+    __typeof__(lvkw_display_ackWindowResize) *ack_resize;
     __typeof__(lvkw_data_pushText) *push_text;
     __typeof__(lvkw_data_pullText) *pull_text;
     __typeof__(lvkw_data_pushData) *push_data;
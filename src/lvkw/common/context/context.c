@@ -23,7 +23,16 @@ LVKW_Status lvkw_context_create(const LVKW_ContextCreateInfo *create_info,
     create_info = &create_info_copy;
   }
 
-  return _lvkw_createContext_impl(create_info, out_context);
+  LVKW_METRICS_STAMP(create_start);
+  LVKW_Status result = _lvkw_createContext_impl(create_info, out_context);
+#ifdef LVKW_GATHER_METRICS
+  if (result == LVKW_SUCCESS) {
+    LVKW_Context_Base *ctx_base = (LVKW_Context_Base *)*out_context;
+    ctx_base->prv.metrics.startup.context_create_ns = _lvkw_get_timestamp_ns() - create_start;
+    ctx_base->prv.metrics.startup.round_trips = ctx_base->prv.metrics.round_trips;
+  }
+#endif
+  return result;
 }
 
 LVKW_Status lvkw_events_post(LVKW_Context *ctx_handle, LVKW_EventType type, LVKW_Window *window,
@@ -51,6 +60,8 @@ LVKW_Version lvkw_core_getVersion(void) {
   };
 }
 
+uint64_t lvkw_instrumentation_getTimestamp(void) { return _lvkw_get_timestamp_ns(); }
+
 LVKW_Status lvkw_wnd_getContext(LVKW_Window *window_handle, LVKW_Context **out_context) {
   LVKW_API_VALIDATE(wnd_getContext, window_handle, out_context);
 
@@ -83,6 +94,17 @@ void _lvkw_update_state_from_event(LVKW_Context_Base *ctx, LVKW_EventType type,
 
 void _lvkw_dispatch_event(LVKW_Context_Base *ctx, LVKW_EventType type, LVKW_Window *window,
                           const LVKW_Event *evt) {
+  _lvkw_dispatch_timed_event(ctx, type, window, evt, 0);
+}
+
+void _lvkw_dispatch_timed_event(LVKW_Context_Base *ctx, LVKW_EventType type, LVKW_Window *window,
+                                const LVKW_Event *evt, uint64_t timestamp_ns) {
+#ifdef LVKW_GATHER_METRICS
+  if (type == LVKW_EVENT_TYPE_WINDOW_READY) {
+    _lvkw_metrics_window_ready(ctx, window);
+  }
+#endif
+
   uint32_t mask = atomic_load_explicit(&ctx->prv.event_mask, memory_order_relaxed);
   if (!(mask & (uint32_t)type)) {
     return;
@@ -91,7 +113,9 @@ void _lvkw_dispatch_event(LVKW_Context_Base *ctx, LVKW_EventType type, LVKW_Wind
   _lvkw_update_state_from_event(ctx, type, window, evt);
 
   if (ctx->prv.event_callback) {
+    ctx->pub.event_timestamp_ns = timestamp_ns;
     ctx->prv.event_callback(type, window, evt, ctx->prv.event_userdata);
+    ctx->pub.event_timestamp_ns = 0;
   }
 }
 
@@ -104,6 +128,9 @@ bool _lvkw_notification_ring_push(LVKW_EventNotificationRing *ring, LVKW_EventTy
     reserve_tail = atomic_load_explicit(&ring->reserve_tail, memory_order_relaxed);
     head = atomic_load_explicit(&ring->head, memory_order_acquire);
     if (reserve_tail - head >= ring->capacity) {
+#ifdef LVKW_GATHER_METRICS
+      atomic_fetch_add_explicit(&ring->drop_count, 1, memory_order_relaxed);
+#endif
       return false;  // Queue full
     }
   } while (!atomic_compare_exchange_weak_explicit(
@@ -113,6 +140,7 @@ bool _lvkw_notification_ring_push(LVKW_EventNotificationRing *ring, LVKW_EventTy
   LVKW_ExternalEvent *slot = &ring->buffer[reserve_tail % ring->capacity];
   slot->type = type;
   slot->window = window;
+  slot->timestamp_ns = _lvkw_get_timestamp_ns();
   if (evt)
     slot->payload = *evt;
   else
@@ -131,9 +159,15 @@ void _lvkw_notification_ring_dispatch_all(LVKW_Context_Base *ctx) {
   uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
   uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
 
+#ifdef LVKW_GATHER_METRICS
+  if (tail - head > ring->peak_count) {
+    ring->peak_count = tail - head;
+  }
+#endif
+
   while (head != tail) {
     LVKW_ExternalEvent *slot = &ring->buffer[head % ring->capacity];
-    _lvkw_dispatch_event(ctx, slot->type, slot->window, &slot->payload);
+    _lvkw_dispatch_timed_event(ctx, slot->type, slot->window, &slot->payload, slot->timestamp_ns);
     head++;
   }
   atomic_store_explicit(&ring->head, head, memory_order_release);
@@ -142,6 +176,9 @@ void _lvkw_notification_ring_dispatch_all(LVKW_Context_Base *ctx) {
 LVKW_Status _lvkw_context_init_base(LVKW_Context_Base *ctx_base,
                                     const LVKW_ContextCreateInfo *create_info) {
   memset(ctx_base, 0, sizeof(*ctx_base));
+#ifdef LVKW_GATHER_METRICS
+  _lvkw_mem_record_bootstrap(ctx_base);
+#endif
   ctx_base->pub.userdata = create_info->userdata;
   ctx_base->prv.diagnostic_cb = create_info->attributes.diagnostic_cb;
   ctx_base->prv.diagnostic_userdata = create_info->attributes.diagnostic_userdata;
@@ -181,6 +218,9 @@ LVKW_Status _lvkw_context_init_base(LVKW_Context_Base *ctx_base,
   atomic_init(&ctx_base->prv.external_notifications.head, 0);
   atomic_init(&ctx_base->prv.external_notifications.tail, 0);
   atomic_init(&ctx_base->prv.external_notifications.reserve_tail, 0);
+#ifdef LVKW_GATHER_METRICS
+  atomic_init(&ctx_base->prv.external_notifications.drop_count, 0);
+#endif
 
   _lvkw_string_cache_init(&ctx_base->prv.string_cache);
 #if LVKW_API_VALIDATION > 0
@@ -196,6 +236,7 @@ void _lvkw_context_cleanup_base(LVKW_Context_Base *ctx_base) {
   }
 
   _lvkw_string_cache_destroy(&ctx_base->prv.string_cache, ctx_base);
+  _lvkw_window_map_destroy(&ctx_base->prv.window_map, ctx_base);
 
 #ifdef LVKW_ENABLE_CONTROLLER
   LVKW_Controller_Base *c_curr = ctx_base->prv.controller_list;
@@ -230,6 +271,90 @@ void _lvkw_context_cleanup_base(LVKW_Context_Base *ctx_base) {
   }
 }
 
+LVKW_Status _lvkw_context_get_base_metrics(LVKW_Context_Base *ctx_base,
+                                           LVKW_MetricsCategory category, void *out_data,
+                                           bool reset) {
+  switch (category) {
+    case LVKW_METRICS_CATEGORY_EVENTS: {
+      LVKW_EventNotificationRing *ring = &ctx_base->prv.external_notifications;
+      LVKW_EventMetrics *out = (LVKW_EventMetrics *)out_data;
+      memset(out, 0, sizeof(*out));
+      out->current_capacity = ring->capacity;
+#ifdef LVKW_GATHER_METRICS
+      out->peak_count = ring->peak_count;
+      out->peak_frame_size = ctx_base->prv.metrics.peak_frame_size;
+      if (reset) {
+        ctx_base->prv.metrics.peak_frame_size = 0;
+        out->drop_count = atomic_exchange_explicit(&ring->drop_count, 0, memory_order_relaxed);
+        ring->peak_count = atomic_load_explicit(&ring->tail, memory_order_relaxed) -
+                           atomic_load_explicit(&ring->head, memory_order_relaxed);
+      }
+      else {
+        out->drop_count = atomic_load_explicit(&ring->drop_count, memory_order_relaxed);
+      }
+#else
+      (void)reset;
+#endif
+      return LVKW_SUCCESS;
+    }
+    case LVKW_METRICS_CATEGORY_STARTUP: {
+      LVKW_StartupMetrics *out = (LVKW_StartupMetrics *)out_data;
+#ifdef LVKW_GATHER_METRICS
+      *out = ctx_base->prv.metrics.startup;
+#else
+      memset(out, 0, sizeof(*out));
+#endif
+      return LVKW_SUCCESS;
+    }
+    case LVKW_METRICS_CATEGORY_MEMORY: {
+      LVKW_MemoryMetrics *out = (LVKW_MemoryMetrics *)out_data;
+#ifdef LVKW_GATHER_METRICS
+      LVKW_MemoryMetrics *memory = &ctx_base->prv.metrics.memory;
+      *out = *memory;
+      if (reset) {
+        memory->total.peak_bytes = memory->total.live_bytes;
+        memory->total.alloc_count = 0;
+        memory->total.free_count = 0;
+        for (uint32_t i = 0; i < LVKW_MEMORY_TAG_COUNT; ++i) {
+          memory->tags[i].peak_bytes = memory->tags[i].live_bytes;
+          memory->tags[i].alloc_count = 0;
+          memory->tags[i].free_count = 0;
+        }
+      }
+#else
+      (void)reset;
+      memset(out, 0, sizeof(*out));
+#endif
+      return LVKW_SUCCESS;
+    }
+    case LVKW_METRICS_CATEGORY_PRESENTATION: {
+      LVKW_PresentationMetrics *out = (LVKW_PresentationMetrics *)out_data;
+#ifdef LVKW_GATHER_METRICS
+      LVKW_PresentationMetrics *presentation = &ctx_base->prv.metrics.presentation;
+      *out = *presentation;
+      if (ctx_base->prv.metrics.presentation_jitter_samples != 0) {
+        out->mean_jitter_ns = ctx_base->prv.metrics.presentation_jitter_sum_ns /
+                              ctx_base->prv.metrics.presentation_jitter_samples;
+      }
+      if (reset) {
+        presentation->presented_count = 0;
+        presentation->discarded_count = 0;
+        presentation->missed_frames = 0;
+        presentation->max_jitter_ns = 0;
+        ctx_base->prv.metrics.presentation_jitter_sum_ns = 0;
+        ctx_base->prv.metrics.presentation_jitter_samples = 0;
+      }
+#else
+      (void)reset;
+      memset(out, 0, sizeof(*out));
+#endif
+      return LVKW_SUCCESS;
+    }
+    default:
+      return LVKW_ERROR;
+  }
+}
+
 void _lvkw_update_base_attributes(LVKW_Context_Base *ctx_base, uint32_t field_mask,
                                   const LVKW_ContextAttributes *attributes) {
   if (field_mask & LVKW_CONTEXT_ATTR_DIAGNOSTICS) {
@@ -265,20 +390,36 @@ void _lvkw_context_mark_lost(LVKW_Context_Base *ctx_base) {
   }
 }
 
-void _lvkw_window_list_add(LVKW_Context_Base *ctx_base, LVKW_Window_Base *window_base) {
+bool _lvkw_window_list_add(LVKW_Context_Base *ctx_base, LVKW_Window_Base *window_base,
+                           uintptr_t native_key) {
+  if (!_lvkw_window_map_insert(&ctx_base->prv.window_map, ctx_base, native_key, window_base)) {
+    return false;
+  }
+  window_base->prv.native_key = native_key;
+
+  window_base->prv.prev = NULL;
   window_base->prv.next = ctx_base->prv.window_list;
+  if (window_base->prv.next) window_base->prv.next->prv.prev = window_base;
   ctx_base->prv.window_list = window_base;
+  return true;
 }
 
 void _lvkw_window_list_remove(LVKW_Context_Base *ctx_base, LVKW_Window_Base *window_base) {
-  LVKW_Window_Base **curr = &ctx_base->prv.window_list;
-  while (*curr) {
-    if (*curr == window_base) {
-      *curr = window_base->prv.next;
-      break;
-    }
-    curr = &((*curr)->prv.next);
+  if (window_base->prv.prev) {
+    window_base->prv.prev->prv.next = window_base->prv.next;
+  }
+  else if (ctx_base->prv.window_list == window_base) {
+    ctx_base->prv.window_list = window_base->prv.next;
   }
+  else {
+    return;
+  }
+  if (window_base->prv.next) window_base->prv.next->prv.prev = window_base->prv.prev;
+  window_base->prv.next = NULL;
+  window_base->prv.prev = NULL;
+
+  _lvkw_window_map_remove(&ctx_base->prv.window_map, window_base->prv.native_key);
+  window_base->prv.native_key = 0;
 }
 
 #ifdef LVKW_ENABLE_DIAGNOSTICS
@@ -7,6 +7,7 @@
 #include "backend.h"
 #include "diagnostic_internal.h"
 #include "mem_internal.h"
+#include "metrics_internal.h"
 #include "types_internal.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,13 @@ uint64_t _lvkw_get_timestamp_ms(void);
 void _lvkw_dispatch_event(LVKW_Context_Base *ctx, LVKW_EventType type, LVKW_Window *window,
                           const LVKW_Event *evt);
 
+/**
+ * @brief Same as _lvkw_dispatch_event(), exposing the OS timestamp of the event
+ * through LVKW_Context::event_timestamp_ns for the duration of the callback.
+ */
+void _lvkw_dispatch_timed_event(LVKW_Context_Base *ctx, LVKW_EventType type, LVKW_Window *window,
+                                const LVKW_Event *evt, uint64_t timestamp_ns);
+
 /**
  * @brief Internal helper to push to the thread-safe notification ring.
  */
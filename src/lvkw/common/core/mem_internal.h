@@ -43,23 +43,114 @@ static inline void *lvkw_realloc(const LVKW_Allocator *alloc, void *ptr,
   }
 }
 
+#ifdef LVKW_GATHER_METRICS
+
+/* Allocation accounting.
+ *
+ * Every context allocation is prefixed with a header recording its size and
+ * LVKW_MemoryTag, so frees can be attributed without the caller passing the
+ * size back. The header keeps the payload 16-byte aligned. */
+#define LVKW_ALLOC_HEADER_SIZE 16
+
+typedef struct LVKW_AllocHeader {
+  size_t size;
+  uint32_t tag;
+} LVKW_AllocHeader;
+
+LVKW_STATIC_ASSERT(sizeof(LVKW_AllocHeader) <= LVKW_ALLOC_HEADER_SIZE,
+                   "LVKW_AllocHeader does not fit in LVKW_ALLOC_HEADER_SIZE");
+
+static inline LVKW_AllocHeader *_lvkw_alloc_header(void *ptr) {
+  return (LVKW_AllocHeader *)((char *)ptr - LVKW_ALLOC_HEADER_SIZE);
+}
+
+static inline void *_lvkw_alloc_header_init(void *raw, size_t size, LVKW_MemoryTag tag) {
+  LVKW_AllocHeader *header = (LVKW_AllocHeader *)raw;
+  header->size = size;
+  header->tag = (uint32_t)tag;
+  return (char *)raw + LVKW_ALLOC_HEADER_SIZE;
+}
+
+static inline void _lvkw_mem_usage_add(LVKW_MemoryUsage *usage, size_t size) {
+  usage->live_bytes += size;
+  usage->alloc_count++;
+  if (usage->live_bytes > usage->peak_bytes) usage->peak_bytes = usage->live_bytes;
+}
+
+static inline void _lvkw_mem_usage_sub(LVKW_MemoryUsage *usage, size_t size) {
+  usage->live_bytes -= size;
+  usage->free_count++;
+}
+
+static inline void _lvkw_mem_record_alloc(LVKW_Context_Base *ctx_base, LVKW_MemoryTag tag,
+                                          size_t size) {
+  _lvkw_mem_usage_add(&ctx_base->prv.metrics.memory.total, size);
+  _lvkw_mem_usage_add(&ctx_base->prv.metrics.memory.tags[tag], size);
+}
+
+static inline void _lvkw_mem_record_free(LVKW_Context_Base *ctx_base, LVKW_MemoryTag tag,
+                                         size_t size) {
+  _lvkw_mem_usage_sub(&ctx_base->prv.metrics.memory.total, size);
+  _lvkw_mem_usage_sub(&ctx_base->prv.metrics.memory.tags[tag], size);
+}
+
+/* The context block is allocated before its counters exist. Called by
+ * _lvkw_context_init_base() once they do. */
+static inline void _lvkw_mem_record_bootstrap(LVKW_Context_Base *ctx_base) {
+  LVKW_AllocHeader *header = _lvkw_alloc_header(ctx_base);
+  _lvkw_mem_record_alloc(ctx_base, (LVKW_MemoryTag)header->tag, header->size);
+}
+
+#else
+#define LVKW_ALLOC_HEADER_SIZE 0
+#endif
+
 static inline void *lvkw_context_alloc_bootstrap(const LVKW_ContextCreateInfo *create_info,
                                                  size_t size) {
+  void *raw;
   if (create_info->allocator.alloc_cb) {
-    return create_info->allocator.alloc_cb(size, create_info->allocator.userdata);
+    raw = create_info->allocator.alloc_cb(size + LVKW_ALLOC_HEADER_SIZE,
+                                          create_info->allocator.userdata);
   }
-  return malloc(size);
+  else {
+    raw = malloc(size + LVKW_ALLOC_HEADER_SIZE);
+  }
+#ifdef LVKW_GATHER_METRICS
+  if (!raw) return NULL;
+  return _lvkw_alloc_header_init(raw, size, LVKW_MEMORY_TAG_CORE);
+#else
+  return raw;
+#endif
 }
 
-static inline void *lvkw_context_alloc(LVKW_Context_Base *ctx_base, size_t size) {
-  void *ptr = ctx_base->prv.allocator.alloc_cb(size, ctx_base->prv.allocator.userdata);
+static inline void *lvkw_context_alloc_tagged(LVKW_Context_Base *ctx_base, LVKW_MemoryTag tag,
+                                              size_t size) {
+  void *ptr = ctx_base->prv.allocator.alloc_cb(size + LVKW_ALLOC_HEADER_SIZE,
+                                               ctx_base->prv.allocator.userdata);
   if (!ptr) {
     LVKW_REPORT_CTX_DIAGNOSTIC(ctx_base, LVKW_DIAGNOSTIC_OUT_OF_MEMORY, "Out of memory");
+    return NULL;
   }
+#ifdef LVKW_GATHER_METRICS
+  _lvkw_mem_record_alloc(ctx_base, tag, size);
+  return _lvkw_alloc_header_init(ptr, size, tag);
+#else
+  (void)tag;
   return ptr;
+#endif
+}
+
+static inline void *lvkw_context_alloc(LVKW_Context_Base *ctx_base, size_t size) {
+  return lvkw_context_alloc_tagged(ctx_base, LVKW_MEMORY_TAG_CORE, size);
 }
 
 static inline void lvkw_context_free(LVKW_Context_Base *ctx_base, void *ptr) {
+#ifdef LVKW_GATHER_METRICS
+  if (!ptr) return;
+  LVKW_AllocHeader *header = _lvkw_alloc_header(ptr);
+  _lvkw_mem_record_free(ctx_base, (LVKW_MemoryTag)header->tag, header->size);
+  ptr = header;
+#endif
   lvkw_free(&ctx_base->prv.allocator, ptr);
 }
 
@@ -87,8 +178,37 @@ static inline void lvkw_context_free_aligned64(LVKW_Context_Base *ctx_base, void
   }
 }
 
-static inline void *lvkw_context_realloc(LVKW_Context_Base *ctx_base, void *ptr, size_t old_size,
-                                         size_t new_size) {
+/**
+ * @note When @p ptr is NULL, the new block is attributed to @p tag. Otherwise it
+ * keeps the tag it was allocated with.
+ */
+static inline void *lvkw_context_realloc_tagged(LVKW_Context_Base *ctx_base, LVKW_MemoryTag tag,
+                                                void *ptr, size_t old_size, size_t new_size) {
+#ifdef LVKW_GATHER_METRICS
+  if (!ptr) return new_size ? lvkw_context_alloc_tagged(ctx_base, tag, new_size) : NULL;
+  if (new_size == 0) {
+    lvkw_context_free(ctx_base, ptr);
+    return NULL;
+  }
+
+  LVKW_AllocHeader *header = _lvkw_alloc_header(ptr);
+  const size_t tracked_size = header->size;
+  tag = (LVKW_MemoryTag)header->tag;
+
+  void *raw = lvkw_realloc(&ctx_base->prv.allocator, header,
+                           tracked_size + LVKW_ALLOC_HEADER_SIZE,
+                           new_size + LVKW_ALLOC_HEADER_SIZE);
+  if (!raw) {
+    LVKW_REPORT_CTX_DIAGNOSTIC(ctx_base, LVKW_DIAGNOSTIC_OUT_OF_MEMORY, "Out of memory");
+    return NULL;
+  }
+
+  (void)old_size;
+  _lvkw_mem_record_free(ctx_base, tag, tracked_size);
+  _lvkw_mem_record_alloc(ctx_base, tag, new_size);
+  return _lvkw_alloc_header_init(raw, new_size, tag);
+#else
+  (void)tag;
   void *new_ptr = lvkw_realloc(&ctx_base->prv.allocator, ptr,
                                old_size, new_size);
   if (!new_ptr && new_size > 0) {
@@ -96,6 +216,12 @@ static inline void *lvkw_context_realloc(LVKW_Context_Base *ctx_base, void *ptr,
   }
 
   return new_ptr;
+#endif
+}
+
+static inline void *lvkw_context_realloc(LVKW_Context_Base *ctx_base, void *ptr, size_t old_size,
+                                         size_t new_size) {
+  return lvkw_context_realloc_tagged(ctx_base, LVKW_MEMORY_TAG_CORE, ptr, old_size, new_size);
 }
 
 #endif  // LVKW_MEM_INTERNAL_H_INCLUDED
@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: Zlib
+// Copyright (c) 2026 François Chabot
+
+#ifndef LVKW_METRICS_INTERNAL_H_INCLUDED
+#define LVKW_METRICS_INTERNAL_H_INCLUDED
+
+#include <stdint.h>
+
+#include "types_internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Monotonic clock in nanoseconds. Implemented by each platform next to
+// _lvkw_get_timestamp_ms().
+uint64_t _lvkw_get_timestamp_ns(void);
+
+// Per-window presentation history, owned by backends that report presentation
+// feedback. Intervals are only meaningful within a single window.
+typedef struct LVKW_PresentationHistory {
+  uint64_t last_present_ns;
+  uint64_t last_sequence;
+  uint64_t last_interval_ns;
+} LVKW_PresentationHistory;
+
+#ifdef LVKW_GATHER_METRICS
+
+/* Startup instrumentation hooks.
+ *
+ * Usage inside a backend:
+ *   LVKW_METRICS_STAMP(t0);
+ *   ...do the work...
+ *   LVKW_METRICS_RECORD_PHASE(ctx_base, LVKW_STARTUP_PHASE_CONNECT, t0);
+ *
+ * Phases accumulate, so a phase may be recorded from several call sites. */
+#define LVKW_METRICS_STAMP(name) const uint64_t name = _lvkw_get_timestamp_ns()
+#define LVKW_METRICS_RECORD_PHASE(ctx_base, phase, since) \
+  ((ctx_base)->prv.metrics.startup.phase_ns[(phase)] += _lvkw_get_timestamp_ns() - (since))
+
+static inline void _lvkw_metrics_window_create_begin(LVKW_Context_Base *ctx_base) {
+  if (ctx_base->prv.metrics.first_window_seen) return;
+  ctx_base->prv.metrics.first_window_start_ns = _lvkw_get_timestamp_ns();
+}
+
+static inline void _lvkw_metrics_window_create_end(LVKW_Context_Base *ctx_base,
+                                                   LVKW_Window_Base *window_base) {
+  if (ctx_base->prv.metrics.first_window_seen) return;
+  ctx_base->prv.metrics.first_window_seen = true;
+  ctx_base->prv.metrics.first_window = window_base;
+  ctx_base->prv.metrics.startup.first_window_create_ns =
+      _lvkw_get_timestamp_ns() - ctx_base->prv.metrics.first_window_start_ns;
+}
+
+static inline void _lvkw_metrics_window_ready(LVKW_Context_Base *ctx_base, LVKW_Window *window) {
+  if (ctx_base->prv.metrics.startup.first_window_ready_ns != 0) return;
+  if (ctx_base->prv.metrics.first_window_start_ns == 0) return;
+
+  // Backends that map synchronously may report READY before createWindow returns.
+  if (ctx_base->prv.metrics.first_window_seen &&
+      (LVKW_Window *)ctx_base->prv.metrics.first_window != window) {
+    return;
+  }
+
+  ctx_base->prv.metrics.startup.first_window_ready_ns =
+      _lvkw_get_timestamp_ns() - ctx_base->prv.metrics.first_window_start_ns;
+}
+
+static inline void _lvkw_metrics_record_presented(LVKW_Context_Base *ctx_base,
+                                                  LVKW_PresentationHistory *history,
+                                                  uint64_t present_ns, uint64_t refresh_ns,
+                                                  uint64_t sequence) {
+  LVKW_PresentationMetrics *metrics = &ctx_base->prv.metrics.presentation;
+  metrics->presented_count++;
+  if (refresh_ns != 0) metrics->refresh_ns = refresh_ns;
+
+  if (history->last_present_ns != 0 && present_ns > history->last_present_ns) {
+    const uint64_t interval_ns = present_ns - history->last_present_ns;
+
+    // Prefer the output's refresh counter; fall back to rounding the interval
+    // to whole refresh periods when the compositor doesn't report one.
+    uint64_t elapsed_frames = 0;
+    if (sequence != 0 && history->last_sequence != 0 && sequence > history->last_sequence) {
+      elapsed_frames = sequence - history->last_sequence;
+    }
+    else if (refresh_ns != 0) {
+      elapsed_frames = (interval_ns + refresh_ns / 2) / refresh_ns;
+    }
+    if (elapsed_frames > 1) metrics->missed_frames += elapsed_frames - 1;
+
+    if (history->last_interval_ns != 0) {
+      const uint64_t jitter_ns = interval_ns > history->last_interval_ns
+                                     ? interval_ns - history->last_interval_ns
+                                     : history->last_interval_ns - interval_ns;
+      ctx_base->prv.metrics.presentation_jitter_sum_ns += jitter_ns;
+      ctx_base->prv.metrics.presentation_jitter_samples++;
+      if (jitter_ns > metrics->max_jitter_ns) metrics->max_jitter_ns = jitter_ns;
+    }
+
+    history->last_interval_ns = interval_ns;
+    metrics->last_interval_ns = interval_ns;
+  }
+
+  history->last_present_ns = present_ns;
+  history->last_sequence = sequence;
+}
+
+#define LVKW_METRICS_WINDOW_CREATE_BEGIN(ctx_base) _lvkw_metrics_window_create_begin(ctx_base)
+#define LVKW_METRICS_WINDOW_CREATE_END(ctx_base, window_base) \
+  _lvkw_metrics_window_create_end((ctx_base), (window_base))
+#define LVKW_METRICS_PRESENTED(ctx_base, history, present_ns, refresh_ns, sequence) \
+  _lvkw_metrics_record_presented((ctx_base), (history), (present_ns), (refresh_ns), (sequence))
+#define LVKW_METRICS_DISCARDED(ctx_base) ((ctx_base)->prv.metrics.presentation.discarded_count++)
+// Counts one blocking request/reply exchange with the display server.
+#define LVKW_METRICS_ROUND_TRIP(ctx_base) ((ctx_base)->prv.metrics.round_trips++)
+#define LVKW_METRICS_FRAME_SIZE(ctx_base, size)                      \
+  do {                                                              \
+    if ((size) > (ctx_base)->prv.metrics.peak_frame_size) {         \
+      (ctx_base)->prv.metrics.peak_frame_size = (size);             \
+    }                                                               \
+  } while (0)
+
+#else
+
+#define LVKW_METRICS_STAMP(name) ((void)0)
+#define LVKW_METRICS_RECORD_PHASE(ctx_base, phase, since) ((void)0)
+#define LVKW_METRICS_WINDOW_CREATE_BEGIN(ctx_base) ((void)0)
+#define LVKW_METRICS_WINDOW_CREATE_END(ctx_base, window_base) ((void)0)
+#define LVKW_METRICS_PRESENTED(ctx_base, history, present_ns, refresh_ns, sequence) ((void)0)
+#define LVKW_METRICS_DISCARDED(ctx_base) ((void)0)
+#define LVKW_METRICS_ROUND_TRIP(ctx_base) ((void)0)
+#define LVKW_METRICS_FRAME_SIZE(ctx_base, size) ((void)0)
+
+#endif
+
+/**
+ * @brief Fills category snapshots that are tracked by the common layer.
+ * @return LVKW_ERROR if the category is not handled by the common layer.
+ */
+LVKW_Status _lvkw_context_get_base_metrics(LVKW_Context_Base *ctx_base,
+                                           LVKW_MetricsCategory category, void *out_data,
+                                           bool reset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // LVKW_METRICS_INTERNAL_H_INCLUDED
@@ -45,7 +45,7 @@ const char *_lvkw_string_cache_intern(LVKW_StringCache *cache, LVKW_Context_Base
   }
 
   size_t len = strlen(str);
-  char *copy = (char *)lvkw_context_alloc(ctx_base, len + 1);
+  char *copy = (char *)lvkw_context_alloc_tagged(ctx_base, LVKW_MEMORY_TAG_STRING_CACHE, len + 1);
   if (!copy) return NULL;
 
   memcpy(copy, str, len + 1);
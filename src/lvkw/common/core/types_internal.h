@@ -11,6 +11,7 @@
 #include "string_cache.h"
 #include "transient_pool.h"
 #include "thread_internal.h"
+#include "window_map.h"
 
 #ifdef __cplusplus
 #include <atomic>
@@ -23,6 +24,7 @@
 typedef struct LVKW_ExternalEvent {
   LVKW_EventType type;
   LVKW_Window *window;
+  uint64_t timestamp_ns;  // Time of the lvkw_events_post() call.
   LVKW_Event payload;
 } LVKW_ExternalEvent;
 
@@ -32,6 +34,10 @@ typedef struct LVKW_EventNotificationRing {
   LVKW_ATOMIC(uint32_t) head;
   LVKW_ATOMIC(uint32_t) tail;
   LVKW_ATOMIC(uint32_t) reserve_tail;
+#ifdef LVKW_GATHER_METRICS
+  LVKW_ATOMIC(uint32_t) drop_count;
+  uint32_t peak_count;  // Sampled by the consumer on drain.
+#endif
 } LVKW_EventNotificationRing;
 
 // Forward declaration of LVKW_Backend to allow use in Context/Window
@@ -66,6 +72,7 @@ typedef struct LVKW_Context_Base {
     LVKW_DiagnosticCallback diagnostic_cb;
     void *diagnostic_userdata;
     struct LVKW_Window_Base *window_list;
+    LVKW_WindowMap window_map;  // Native key -> live window, for event routing.
 #ifdef LVKW_ENABLE_CONTROLLER
     struct LVKW_Controller_Base *controller_list;
 #endif
@@ -80,6 +87,20 @@ typedef struct LVKW_Context_Base {
     void *event_userdata;
 
     LVKW_EventNotificationRing external_notifications;
+#ifdef LVKW_GATHER_METRICS
+    struct {
+      LVKW_StartupMetrics startup;
+      struct LVKW_Window_Base *first_window;  // Pending WINDOW_READY, if any.
+      uint64_t first_window_start_ns;
+      bool first_window_seen;
+      LVKW_MemoryMetrics memory;
+      LVKW_PresentationMetrics presentation;
+      uint64_t presentation_jitter_sum_ns;
+      uint64_t presentation_jitter_samples;
+      uint32_t peak_frame_size;
+      uint32_t round_trips;  // Since creation; snapshotted into startup.round_trips.
+    } metrics;
+#endif
 #if LVKW_API_VALIDATION > 0
     LVKW_ThreadId creator_thread;
 #endif
@@ -108,6 +129,8 @@ typedef struct LVKW_Window_Base {
 #endif
     LVKW_Context_Base *ctx_base;
     struct LVKW_Window_Base *next;
+    struct LVKW_Window_Base *prev;
+    uintptr_t native_key;  // This window's key in ctx_base->prv.window_map.
 
     /* DnD Session state */
     void *session_userdata;
@@ -149,7 +172,11 @@ void _lvkw_update_base_attributes(LVKW_Context_Base *ctx_base, uint32_t field_ma
                                   const LVKW_ContextAttributes *attributes);
 
 void _lvkw_context_mark_lost(LVKW_Context_Base *ctx_base);
-void _lvkw_window_list_add(LVKW_Context_Base *ctx_base, LVKW_Window_Base *window_base);
+/* Registers the window under its backend-native key (XID, wl_surface pointer, ...) so events can
+   be routed to it with _lvkw_window_map_find(). Fails only on allocation failure. Removal is O(1)
+   and harmless for a window that was never added. */
+bool _lvkw_window_list_add(LVKW_Context_Base *ctx_base, LVKW_Window_Base *window_base,
+                           uintptr_t native_key);
 void _lvkw_window_list_remove(LVKW_Context_Base *ctx_base, LVKW_Window_Base *window_base);
 
 #endif  // LVKW_TYPES_INTERNAL_H_INCLUDED
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: Zlib
+// Copyright (c) 2026 François Chabot
+
+#include "window_map.h"
+
+#include <string.h>
+
+#include "mem_internal.h"
+#include "types_internal.h"
+
+#define LVKW_WINDOW_MAP_MIN_CAPACITY 16
+
+void _lvkw_window_map_destroy(LVKW_WindowMap *map, LVKW_Context_Base *ctx_base) {
+  if (map->entries) lvkw_context_free(ctx_base, map->entries);
+  memset(map, 0, sizeof(*map));
+}
+
+static void _place(LVKW_WindowMapEntry *entries, uint32_t capacity, uintptr_t key,
+                   struct LVKW_Window_Base *window) {
+  uint32_t i = _lvkw_window_map_slot(key, capacity);
+  while (entries[i].key && entries[i].key != key) i = (i + 1) & (capacity - 1);
+  entries[i].key = key;
+  entries[i].window = window;
+}
+
+static bool _grow(LVKW_WindowMap *map, LVKW_Context_Base *ctx_base) {
+  uint32_t capacity = map->capacity ? map->capacity * 2 : LVKW_WINDOW_MAP_MIN_CAPACITY;
+  LVKW_WindowMapEntry *entries = (LVKW_WindowMapEntry *)lvkw_context_alloc_tagged(
+      ctx_base, LVKW_MEMORY_TAG_CORE, sizeof(*entries) * capacity);
+  if (!entries) return false;
+  memset(entries, 0, sizeof(*entries) * capacity);
+
+  for (uint32_t i = 0; i < map->capacity; i++) {
+    if (map->entries[i].key) _place(entries, capacity, map->entries[i].key, map->entries[i].window);
+  }
+
+  if (map->entries) lvkw_context_free(ctx_base, map->entries);
+  map->entries = entries;
+  map->capacity = capacity;
+  return true;
+}
+
+bool _lvkw_window_map_insert(LVKW_WindowMap *map, LVKW_Context_Base *ctx_base, uintptr_t key,
+                             struct LVKW_Window_Base *window) {
+  if (!key) return false;
+
+  /* Keep the load factor under 3/4 so probe sequences stay short. */
+  if ((map->count + 1) * 4 > map->capacity * 3 && !_grow(map, ctx_base)) return false;
+
+  if (!_lvkw_window_map_find(map, key)) map->count++;
+  _place(map->entries, map->capacity, key, window);
+  return true;
+}
+
+void _lvkw_window_map_remove(LVKW_WindowMap *map, uintptr_t key) {
+  if (!map->count || !key) return;
+
+  const uint32_t mask = map->capacity - 1;
+  uint32_t hole = _lvkw_window_map_slot(key, map->capacity);
+  while (map->entries[hole].key != key) {
+    if (!map->entries[hole].key) return;
+    hole = (hole + 1) & mask;
+  }
+
+  /* Backward-shift deletion: pull later members of the probe run into the hole so lookups never
+     need tombstones. */
+  for (uint32_t i = (hole + 1) & mask; map->entries[i].key; i = (i + 1) & mask) {
+    uint32_t home = _lvkw_window_map_slot(map->entries[i].key, map->capacity);
+    if (((i - home) & mask) >= ((i - hole) & mask)) {
+      map->entries[hole] = map->entries[i];
+      hole = i;
+    }
+  }
+  map->entries[hole].key = 0;
+  map->entries[hole].window = NULL;
+  map->count--;
+}
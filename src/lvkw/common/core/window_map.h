@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: Zlib
+// Copyright (c) 2026 François Chabot
+
+#ifndef LVKW_WINDOW_MAP_H_INCLUDED
+#define LVKW_WINDOW_MAP_H_INCLUDED
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Open-addressing hash from a backend's native window key (XID, wl_surface pointer, ...) to the
+   window that owns it. Event routing goes through here, so its cost does not grow with the
+   number of open windows. Key 0 is reserved. */
+
+typedef struct LVKW_WindowMapEntry {
+  uintptr_t key;
+  struct LVKW_Window_Base *window;
+} LVKW_WindowMapEntry;
+
+typedef struct LVKW_WindowMap {
+  LVKW_WindowMapEntry *entries;
+  uint32_t capacity;  // Zero or a power of two.
+  uint32_t count;
+} LVKW_WindowMap;
+
+/* Forward declaration */
+typedef struct LVKW_Context_Base LVKW_Context_Base;
+
+void _lvkw_window_map_destroy(LVKW_WindowMap *map, LVKW_Context_Base *ctx_base);
+
+/* Returns false if the table needed to grow and could not. */
+bool _lvkw_window_map_insert(LVKW_WindowMap *map, LVKW_Context_Base *ctx_base, uintptr_t key,
+                             struct LVKW_Window_Base *window);
+void _lvkw_window_map_remove(LVKW_WindowMap *map, uintptr_t key);
+
+static inline uint32_t _lvkw_window_map_slot(uintptr_t key, uint32_t capacity) {
+  uint64_t h = (uint64_t)key * 0x9e3779b97f4a7c15ull;
+  return (uint32_t)(h >> 32) & (capacity - 1);
+}
+
+static inline struct LVKW_Window_Base *_lvkw_window_map_find(const LVKW_WindowMap *map,
+                                                             uintptr_t key) {
+  if (!map->count || !key) return NULL;
+  for (uint32_t i = _lvkw_window_map_slot(key, map->capacity);; i = (i + 1) & (map->capacity - 1)) {
+    const LVKW_WindowMapEntry *entry = &map->entries[i];
+    if (entry->key == key) return entry->window;
+    if (!entry->key) return NULL;
+  }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // LVKW_WINDOW_MAP_H_INCLUDED
@@ -22,6 +22,8 @@
 #ifdef LVKW_ENABLE_CONTROLLER
 
 #define LVKW_EV_BUF_SIZE (sizeof(struct inotify_event) + NAME_MAX + 1)
+// A 1 kHz pad reports a handful of events per frame; this drains several frames per read().
+#define LVKW_INPUT_EVENT_BATCH 64
 
 static LVKW_ControllerContext_Linux *_get_ctrl_ctx(LVKW_Context *ctx_handle) {
   LVKW_Context_Linux *linux_ctx = (LVKW_Context_Linux *)ctx_handle;
@@ -68,7 +70,7 @@ static bool _is_gamepad(int fd) {
 
 static LVKW_Controller_Base *_alloc_controller(LVKW_Context_Base *ctx_base,
                                                struct LVKW_CtrlDevice_Linux *dev) {
-  LVKW_Controller_Base *ctrl = lvkw_context_alloc(ctx_base, sizeof(LVKW_Controller_Base));
+  LVKW_Controller_Base *ctrl = lvkw_context_alloc_tagged(ctx_base, LVKW_MEMORY_TAG_CONTROLLERS, sizeof(LVKW_Controller_Base));
   if (!ctrl) return NULL;
 
   memset(ctrl, 0, sizeof(*ctrl));
@@ -78,9 +80,9 @@ static LVKW_Controller_Base *_alloc_controller(LVKW_Context_Base *ctx_base,
   ctrl->pub.haptic_count = 0;
 
   ctrl->prv.analogs_backing =
-      lvkw_context_alloc(ctx_base, sizeof(LVKW_AnalogInputState) * ctrl->pub.analog_count);
+      lvkw_context_alloc_tagged(ctx_base, LVKW_MEMORY_TAG_CONTROLLERS, sizeof(LVKW_AnalogInputState) * ctrl->pub.analog_count);
   ctrl->prv.buttons_backing =
-      lvkw_context_alloc(ctx_base, sizeof(LVKW_ButtonState) * ctrl->pub.button_count);
+      lvkw_context_alloc_tagged(ctx_base, LVKW_MEMORY_TAG_CONTROLLERS, sizeof(LVKW_ButtonState) * ctrl->pub.button_count);
   if (!ctrl->prv.analogs_backing || !ctrl->prv.buttons_backing) {
     if (ctrl->prv.analogs_backing) lvkw_context_free(ctx_base, ctrl->prv.analogs_backing);
     if (ctrl->prv.buttons_backing) lvkw_context_free(ctx_base, ctrl->prv.buttons_backing);
@@ -92,8 +94,8 @@ static LVKW_Controller_Base *_alloc_controller(LVKW_Context_Base *ctx_base,
   ctrl->pub.analogs = ctrl->prv.analogs_backing;
   ctrl->pub.buttons = ctrl->prv.buttons_backing;
 
-  ctrl->prv.analog_channels_backing = lvkw_context_alloc(
-      ctx_base, sizeof(LVKW_AnalogChannelInfo) * ctrl->pub.analog_count);
+  ctrl->prv.analog_channels_backing = lvkw_context_alloc_tagged(
+      ctx_base, LVKW_MEMORY_TAG_CONTROLLERS, sizeof(LVKW_AnalogChannelInfo) * ctrl->pub.analog_count);
   if (ctrl->prv.analog_channels_backing) {
     ctrl->prv.analog_channels_backing[LVKW_CTRL_ANALOG_LEFT_X].name = "Left X";
     ctrl->prv.analog_channels_backing[LVKW_CTRL_ANALOG_LEFT_Y].name = "Left Y";
@@ -104,8 +106,8 @@ static LVKW_Controller_Base *_alloc_controller(LVKW_Context_Base *ctx_base,
     ctrl->pub.analog_channels = ctrl->prv.analog_channels_backing;
   }
 
-  ctrl->prv.button_channels_backing = lvkw_context_alloc(
-      ctx_base, sizeof(LVKW_ButtonChannelInfo) * ctrl->pub.button_count);
+  ctrl->prv.button_channels_backing = lvkw_context_alloc_tagged(
+      ctx_base, LVKW_MEMORY_TAG_CONTROLLERS, sizeof(LVKW_ButtonChannelInfo) * ctrl->pub.button_count);
   if (ctrl->prv.button_channels_backing) {
     ctrl->prv.button_channels_backing[LVKW_CTRL_BUTTON_SOUTH].name = "South";
     ctrl->prv.button_channels_backing[LVKW_CTRL_BUTTON_EAST].name = "East";
@@ -132,7 +134,7 @@ static LVKW_Controller_Base *_alloc_controller(LVKW_Context_Base *ctx_base,
     if (has_rumble) {
       ctrl->pub.haptic_count = 2;
       ctrl->prv.haptic_channels_backing =
-          lvkw_context_alloc(ctx_base, sizeof(LVKW_HapticChannelInfo) * ctrl->pub.haptic_count);
+          lvkw_context_alloc_tagged(ctx_base, LVKW_MEMORY_TAG_CONTROLLERS, sizeof(LVKW_HapticChannelInfo) * ctrl->pub.haptic_count);
       if (ctrl->prv.haptic_channels_backing) {
         ctrl->prv.haptic_channels_backing[LVKW_CTRL_HAPTIC_LOW_FREQ].name = "Low Frequency";
         ctrl->prv.haptic_channels_backing[LVKW_CTRL_HAPTIC_HIGH_FREQ].name = "High Frequency";
@@ -148,6 +150,145 @@ static LVKW_Controller_Base *_alloc_controller(LVKW_Context_Base *ctx_base,
   return ctrl;
 }
 
+// Evdev code of each standard button, for reading back the full key state.
+static const uint16_t _button_codes[LVKW_CTRL_BUTTON_STANDARD_COUNT] = {
+    [LVKW_CTRL_BUTTON_SOUTH] = BTN_SOUTH,        [LVKW_CTRL_BUTTON_EAST] = BTN_EAST,
+    [LVKW_CTRL_BUTTON_WEST] = BTN_WEST,          [LVKW_CTRL_BUTTON_NORTH] = BTN_NORTH,
+    [LVKW_CTRL_BUTTON_LB] = BTN_TL,              [LVKW_CTRL_BUTTON_RB] = BTN_TR,
+    [LVKW_CTRL_BUTTON_BACK] = BTN_SELECT,        [LVKW_CTRL_BUTTON_START] = BTN_START,
+    [LVKW_CTRL_BUTTON_GUIDE] = BTN_MODE,         [LVKW_CTRL_BUTTON_L_THUMB] = BTN_THUMBL,
+    [LVKW_CTRL_BUTTON_R_THUMB] = BTN_THUMBR,     [LVKW_CTRL_BUTTON_DPAD_UP] = BTN_DPAD_UP,
+    [LVKW_CTRL_BUTTON_DPAD_RIGHT] = BTN_DPAD_RIGHT, [LVKW_CTRL_BUTTON_DPAD_DOWN] = BTN_DPAD_DOWN,
+    [LVKW_CTRL_BUTTON_DPAD_LEFT] = BTN_DPAD_LEFT,
+};
+
+// Evdev code of each standard analog channel.
+static const uint16_t _axis_codes[LVKW_CTRL_ANALOG_STANDARD_COUNT] = {
+    [LVKW_CTRL_ANALOG_LEFT_X] = ABS_X,         [LVKW_CTRL_ANALOG_LEFT_Y] = ABS_Y,
+    [LVKW_CTRL_ANALOG_RIGHT_X] = ABS_RX,       [LVKW_CTRL_ANALOG_RIGHT_Y] = ABS_RY,
+    [LVKW_CTRL_ANALOG_LEFT_TRIGGER] = ABS_Z,   [LVKW_CTRL_ANALOG_RIGHT_TRIGGER] = ABS_RZ,
+};
+
+static int _button_index(uint16_t code) {
+  switch (code) {
+    case BTN_SOUTH:
+      return LVKW_CTRL_BUTTON_SOUTH;
+    case BTN_EAST:
+      return LVKW_CTRL_BUTTON_EAST;
+    case BTN_WEST:
+      return LVKW_CTRL_BUTTON_WEST;
+    case BTN_NORTH:
+      return LVKW_CTRL_BUTTON_NORTH;
+    case BTN_TL:
+      return LVKW_CTRL_BUTTON_LB;
+    case BTN_TR:
+      return LVKW_CTRL_BUTTON_RB;
+    case BTN_SELECT:
+      return LVKW_CTRL_BUTTON_BACK;
+    case BTN_START:
+      return LVKW_CTRL_BUTTON_START;
+    case BTN_MODE:
+      return LVKW_CTRL_BUTTON_GUIDE;
+    case BTN_THUMBL:
+      return LVKW_CTRL_BUTTON_L_THUMB;
+    case BTN_THUMBR:
+      return LVKW_CTRL_BUTTON_R_THUMB;
+    case BTN_DPAD_UP:
+      return LVKW_CTRL_BUTTON_DPAD_UP;
+    case BTN_DPAD_DOWN:
+      return LVKW_CTRL_BUTTON_DPAD_DOWN;
+    case BTN_DPAD_LEFT:
+      return LVKW_CTRL_BUTTON_DPAD_LEFT;
+    case BTN_DPAD_RIGHT:
+      return LVKW_CTRL_BUTTON_DPAD_RIGHT;
+  }
+  return -1;
+}
+
+static int _axis_index(uint16_t code) {
+  switch (code) {
+    case ABS_X:
+      return LVKW_CTRL_ANALOG_LEFT_X;
+    case ABS_Y:
+      return LVKW_CTRL_ANALOG_LEFT_Y;
+    case ABS_RX:
+      return LVKW_CTRL_ANALOG_RIGHT_X;
+    case ABS_RY:
+      return LVKW_CTRL_ANALOG_RIGHT_Y;
+    case ABS_Z:
+      return LVKW_CTRL_ANALOG_LEFT_TRIGGER;
+    case ABS_RZ:
+      return LVKW_CTRL_ANALOG_RIGHT_TRIGGER;
+  }
+  return -1;
+}
+
+// Axis ranges are fixed for the lifetime of the device, so they are only queried here. Sticks map
+// to [-1, 1], triggers to [0, 1]. An axis the device lacks stays at zero.
+static void _init_axes(struct LVKW_CtrlDevice_Linux *dev) {
+  for (int i = 0; i < LVKW_CTRL_ANALOG_STANDARD_COUNT; i++) {
+    struct input_absinfo abs;
+    if (ioctl(dev->fd, (unsigned int)EVIOCGABS(_axis_codes[i]), &abs) != 0) continue;
+    if (abs.maximum == abs.minimum) continue;
+
+    const bool is_stick = (i != LVKW_CTRL_ANALOG_LEFT_TRIGGER && i != LVKW_CTRL_ANALOG_RIGHT_TRIGGER);
+    const LVKW_Scalar range = (LVKW_Scalar)abs.maximum - (LVKW_Scalar)abs.minimum;
+    const LVKW_Scalar span = is_stick ? (LVKW_Scalar)2.0 : (LVKW_Scalar)1.0;
+    dev->axes[i].scale = span / range;
+    dev->axes[i].offset = -(LVKW_Scalar)abs.minimum * dev->axes[i].scale;
+    if (is_stick) dev->axes[i].offset -= (LVKW_Scalar)1.0;
+  }
+}
+
+static void _apply_abs(struct LVKW_CtrlDevice_Linux *dev, uint16_t code, int32_t value) {
+  switch (code) {
+    case ABS_HAT0X:
+      dev->buttons[LVKW_CTRL_BUTTON_DPAD_LEFT] =
+          (value < 0) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
+      dev->buttons[LVKW_CTRL_BUTTON_DPAD_RIGHT] =
+          (value > 0) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
+      return;
+    case ABS_HAT0Y:
+      dev->buttons[LVKW_CTRL_BUTTON_DPAD_UP] =
+          (value < 0) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
+      dev->buttons[LVKW_CTRL_BUTTON_DPAD_DOWN] =
+          (value > 0) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
+      return;
+  }
+
+  const int axis_idx = _axis_index(code);
+  if (axis_idx < 0) return;
+  const LVKW_CtrlAxis_Linux *axis = &dev->axes[axis_idx];
+  dev->analogs[axis_idx].value = (LVKW_Scalar)value * axis->scale + axis->offset;
+}
+
+// Reads the whole device state back, for a fresh device or after the kernel dropped events.
+static void _read_device_state(struct LVKW_CtrlDevice_Linux *dev) {
+  unsigned long key_bits[KEY_MAX / 8 / sizeof(unsigned long) + 1] = {0};
+  if (ioctl(dev->fd, EVIOCGKEY(sizeof(key_bits)), key_bits) >= 0) {
+    for (int i = 0; i < LVKW_CTRL_BUTTON_STANDARD_COUNT; i++) {
+      const uint16_t code = _button_codes[i];
+      const bool down = (key_bits[code / 8 / sizeof(unsigned long)] &
+                         (1UL << (code % (8 * sizeof(unsigned long))))) != 0;
+      dev->buttons[i] = down ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
+    }
+  }
+
+  static const uint16_t abs_codes[] = {ABS_X, ABS_Y, ABS_RX, ABS_RY, ABS_Z, ABS_RZ, ABS_HAT0X, ABS_HAT0Y};
+  for (size_t i = 0; i < sizeof(abs_codes) / sizeof(abs_codes[0]); i++) {
+    struct input_absinfo abs;
+    if (ioctl(dev->fd, (unsigned int)EVIOCGABS(abs_codes[i]), &abs) == 0) {
+      _apply_abs(dev, abs_codes[i], abs.value);
+    }
+  }
+}
+
+static void _commit_device_state(struct LVKW_CtrlDevice_Linux *dev) {
+  LVKW_Controller_Base *ctrl = dev->controller;
+  memcpy(ctrl->prv.analogs_backing, dev->analogs, sizeof(dev->analogs));
+  memcpy(ctrl->prv.buttons_backing, dev->buttons, sizeof(dev->buttons));
+}
+
 static void _add_device(LVKW_Context_Base *ctx_base, LVKW_ControllerContext_Linux *ctrl_ctx,
                         const char *path) {
   for (struct LVKW_CtrlDevice_Linux *d = ctrl_ctx->devices; d; d = d->next) {
@@ -171,7 +312,7 @@ static void _add_device(LVKW_Context_Base *ctx_base, LVKW_ControllerContext_Linu
     return;
   }
 
-  struct LVKW_CtrlDevice_Linux *dev = lvkw_context_alloc(ctx_base,
+  struct LVKW_CtrlDevice_Linux *dev = lvkw_context_alloc_tagged(ctx_base, LVKW_MEMORY_TAG_CONTROLLERS,
                                                  sizeof(struct LVKW_CtrlDevice_Linux));
   if (!dev) {
     close(fd);
@@ -184,7 +325,7 @@ static void _add_device(LVKW_Context_Base *ctx_base, LVKW_ControllerContext_Linu
   dev->id = ++ctrl_ctx->next_id;
 
   size_t path_len = strlen(path) + 1;
-  dev->path = lvkw_context_alloc(ctx_base, path_len);
+  dev->path = lvkw_context_alloc_tagged(ctx_base, LVKW_MEMORY_TAG_CONTROLLERS, path_len);
   if (dev->path) {
     memcpy(dev->path, path, path_len);
   }
@@ -195,7 +336,7 @@ static void _add_device(LVKW_Context_Base *ctx_base, LVKW_ControllerContext_Linu
   }
 
   size_t name_len = strlen(name) + 1;
-  dev->name = lvkw_context_alloc(ctx_base, name_len);
+  dev->name = lvkw_context_alloc_tagged(ctx_base, LVKW_MEMORY_TAG_CONTROLLERS, name_len);
   if (dev->name) {
     memcpy(dev->name, name, name_len);
   }
@@ -207,6 +348,9 @@ static void _add_device(LVKW_Context_Base *ctx_base, LVKW_ControllerContext_Linu
     dev->version = id_info.version;
   }
 
+  _init_axes(dev);
+  _read_device_state(dev);
+
   dev->next = ctrl_ctx->devices;
   ctrl_ctx->devices = dev;
   dev->controller = _alloc_controller(ctx_base, dev);
@@ -214,6 +358,7 @@ static void _add_device(LVKW_Context_Base *ctx_base, LVKW_ControllerContext_Linu
     _remove_device(ctx_base, ctrl_ctx, dev, NULL);
     return;
   }
+  _commit_device_state(dev);
 
   if (ctrl_ctx->push_event) {
     LVKW_Event evt = {.controller_connection = {
@@ -312,118 +457,44 @@ void _lvkw_ctrl_cleanup_context_Linux(LVKW_Context_Base *ctx_base,
   }
 }
 
-static bool _process_device_events(struct LVKW_CtrlDevice_Linux *dev) {
-  if (!dev->controller) return true;
-  LVKW_Controller_Base *ctrl = dev->controller;
-  struct input_event ev;
-  ssize_t rd;
-  while ((rd = read(dev->fd, &ev, sizeof(ev))) == sizeof(ev)) {
-    if (ev.type == EV_KEY) {
-      int btn_idx = -1;
-      switch (ev.code) {
-        case BTN_SOUTH:
-          btn_idx = LVKW_CTRL_BUTTON_SOUTH;
-          break;
-        case BTN_EAST:
-          btn_idx = LVKW_CTRL_BUTTON_EAST;
-          break;
-        case BTN_WEST:
-          btn_idx = LVKW_CTRL_BUTTON_WEST;
-          break;
-        case BTN_NORTH:
-          btn_idx = LVKW_CTRL_BUTTON_NORTH;
-          break;
-        case BTN_TL:
-          btn_idx = LVKW_CTRL_BUTTON_LB;
-          break;
-        case BTN_TR:
-          btn_idx = LVKW_CTRL_BUTTON_RB;
-          break;
-        case BTN_SELECT:
-          btn_idx = LVKW_CTRL_BUTTON_BACK;
-          break;
-        case BTN_START:
-          btn_idx = LVKW_CTRL_BUTTON_START;
-          break;
-        case BTN_MODE:
-          btn_idx = LVKW_CTRL_BUTTON_GUIDE;
-          break;
-        case BTN_THUMBL:
-          btn_idx = LVKW_CTRL_BUTTON_L_THUMB;
-          break;
-        case BTN_THUMBR:
-          btn_idx = LVKW_CTRL_BUTTON_R_THUMB;
-          break;
-        case BTN_DPAD_UP:
-          btn_idx = LVKW_CTRL_BUTTON_DPAD_UP;
-          break;
-        case BTN_DPAD_DOWN:
-          btn_idx = LVKW_CTRL_BUTTON_DPAD_DOWN;
-          break;
-        case BTN_DPAD_LEFT:
-          btn_idx = LVKW_CTRL_BUTTON_DPAD_LEFT;
-          break;
-        case BTN_DPAD_RIGHT:
-          btn_idx = LVKW_CTRL_BUTTON_DPAD_RIGHT;
-          break;
-      }
-      if (btn_idx >= 0 && btn_idx < LVKW_CTRL_BUTTON_STANDARD_COUNT) {
-        ctrl->prv.buttons_backing[btn_idx] =
-            (ev.value != 0) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
-      }
+static void _process_input_event(struct LVKW_CtrlDevice_Linux *dev, const struct input_event *ev) {
+  if (ev->type == EV_SYN) {
+    if (ev->code == SYN_DROPPED) {
+      dev->dropped = true;
     }
-    else if (ev.type == EV_ABS) {
-      int axis_idx = -1;
-      float val = (LVKW_Scalar)0.0;
-      struct input_absinfo abs;
-      if (ioctl(dev->fd, (unsigned int)EVIOCGABS(ev.code), &abs) == 0) {
-        float range = (float)(abs.maximum - abs.minimum);
-        if (range != (LVKW_Scalar)0.0) {
-          val = (float)(ev.value - abs.minimum) / range;
-          if (ev.code == ABS_X || ev.code == ABS_Y || ev.code == ABS_RX || ev.code == ABS_RY) {
-            val = val * (LVKW_Scalar)2.0 - (LVKW_Scalar)1.0;
-          }
-        }
-      }
-      switch (ev.code) {
-        case ABS_X:
-          axis_idx = LVKW_CTRL_ANALOG_LEFT_X;
-          break;
-        case ABS_Y:
-          axis_idx = LVKW_CTRL_ANALOG_LEFT_Y;
-          break;
-        case ABS_RX:
-          axis_idx = LVKW_CTRL_ANALOG_RIGHT_X;
-          break;
-        case ABS_RY:
-          axis_idx = LVKW_CTRL_ANALOG_RIGHT_Y;
-          break;
-        case ABS_Z:
-          axis_idx = LVKW_CTRL_ANALOG_LEFT_TRIGGER;
-          break;
-        case ABS_RZ:
-          axis_idx = LVKW_CTRL_ANALOG_RIGHT_TRIGGER;
-          break;
-        case ABS_HAT0X:
-          ctrl->prv.buttons_backing[LVKW_CTRL_BUTTON_DPAD_LEFT] =
-              (ev.value < 0) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
-          ctrl->prv.buttons_backing[LVKW_CTRL_BUTTON_DPAD_RIGHT] =
-              (ev.value > 0) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
-          break;
-        case ABS_HAT0Y:
-          ctrl->prv.buttons_backing[LVKW_CTRL_BUTTON_DPAD_UP] =
-              (ev.value < 0) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
-          ctrl->prv.buttons_backing[LVKW_CTRL_BUTTON_DPAD_DOWN] =
-              (ev.value > 0) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
-          break;
-      }
-      if (axis_idx >= 0 && axis_idx < LVKW_CTRL_ANALOG_STANDARD_COUNT) {
-        ctrl->prv.analogs_backing[axis_idx].value = val;
+    else if (ev->code == SYN_REPORT) {
+      if (dev->dropped) {
+        dev->dropped = false;
+        _read_device_state(dev);
       }
+      _commit_device_state(dev);
     }
+    return;
+  }
+  if (dev->dropped) return;
+
+  if (ev->type == EV_KEY) {
+    const int btn_idx = _button_index(ev->code);
+    if (btn_idx >= 0) {
+      dev->buttons[btn_idx] = (ev->value != 0) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
+    }
+  }
+  else if (ev->type == EV_ABS) {
+    _apply_abs(dev, ev->code, ev->value);
+  }
+}
+
+static bool _process_device_events(struct LVKW_CtrlDevice_Linux *dev) {
+  if (!dev->controller) return true;
+  struct input_event events[LVKW_INPUT_EVENT_BATCH];
+  for (;;) {
+    const ssize_t rd = read(dev->fd, events, sizeof(events));
+    if (rd < 0) return errno == EAGAIN || errno == EINTR;
+    const size_t count = (size_t)rd / sizeof(events[0]);
+    for (size_t i = 0; i < count; i++) _process_input_event(dev, &events[i]);
+    // A short read means the queue is drained; there is no need to go back for EAGAIN.
+    if (count < LVKW_INPUT_EVENT_BATCH) return true;
   }
-  if (rd < 0 && errno != EAGAIN) return false;
-  return true;
 }
 
 void _lvkw_ctrl_poll_Linux(LVKW_Context_Base *ctx_base, LVKW_ControllerContext_Linux *ctrl_ctx) {
@@ -14,6 +14,7 @@
   LVKW_LIB_FN(context_new)              \
   LVKW_LIB_FN(context_unref)            \
   LVKW_LIB_FN(keymap_new_from_string)   \
+  LVKW_LIB_FN(keymap_ref)               \
   LVKW_LIB_FN(keymap_unref)             \
   LVKW_LIB_FN(state_new)                \
   LVKW_LIB_FN(state_unref)              \
@@ -22,6 +23,7 @@
   LVKW_LIB_FN(state_key_get_utf8)       \
   LVKW_LIB_FN(state_mod_name_is_active) \
   LVKW_LIB_FN(keymap_mod_get_index)     \
+  LVKW_LIB_FN(keymap_key_repeats)       \
   LVKW_LIB_FN(state_serialize_mods)
 
 // xkbcommon-x11 types and functions (defined manually since headers might be missing)
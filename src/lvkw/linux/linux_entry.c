@@ -159,6 +159,12 @@ LVKW_Status lvkw_display_requestWindowFocus(LVKW_Window *window_handle) {
   return window_base->prv.backend->window.request_focus(window_handle);
 }
 
+LVKW_Status lvkw_display_ackWindowResize(LVKW_Window *window_handle) {
+  LVKW_API_VALIDATE(wnd_ackResize, window_handle);
+  LVKW_Window_Base *window_base = (LVKW_Window_Base *)window_handle;
+  return window_base->prv.backend->window.ack_resize(window_handle);
+}
+
 LVKW_Status lvkw_display_getStandardCursor(LVKW_Context *ctx_handle, LVKW_CursorShape shape,
                                        LVKW_Cursor **out_cursor) {
   LVKW_API_VALIDATE(ctx_getStandardCursor, ctx_handle, shape, out_cursor);
@@ -10,9 +10,39 @@
 #include "types_internal.h"
 
 LVKW_Key lvkw_linux_translate_keysym(xkb_keysym_t keysym);
-LVKW_Key lvkw_linux_translate_keycode(uint32_t keycode);
+
+#define LVKW_LINUX_KEYCODE_TABLE_SIZE 256
+
+/* evdev scancode -> LVKW_Key. */
+extern const LVKW_Key _lvkw_linux_evdev_key_table[LVKW_LINUX_KEYCODE_TABLE_SIZE];
+
+static inline LVKW_Key lvkw_linux_translate_keycode(uint32_t keycode) {
+  return keycode < LVKW_LINUX_KEYCODE_TABLE_SIZE ? _lvkw_linux_evdev_key_table[keycode]
+                                                 : LVKW_KEY_UNKNOWN;
+}
+
+/* Converts a server input timestamp to the lvkw_instrumentation_getTimestamp() domain. */
+uint64_t _lvkw_linux_event_time_ns(uint32_t time_ms);
+uint64_t _lvkw_linux_event_time_us_ns(uint64_t time_us);
+
+/* Accumulates a value120 scroll delta and returns the whole notches it completes. The remainder
+   is dropped when the direction flips, so a reversed wheel steps immediately. */
+static inline int32_t _lvkw_linux_accumulate_value120(int32_t *remainder, int32_t value120) {
+  if ((*remainder > 0 && value120 < 0) || (*remainder < 0 && value120 > 0)) *remainder = 0;
+  *remainder += value120;
+  const int32_t steps = *remainder / 120;
+  *remainder -= steps * 120;
+  return steps;
+}
 
 #ifdef LVKW_ENABLE_CONTROLLER
+// How one analog channel's raw evdev value maps to LVKW's range: raw * scale + offset. Derived
+// from the axis range once, when the device is opened.
+typedef struct LVKW_CtrlAxis_Linux {
+  LVKW_Scalar scale;
+  LVKW_Scalar offset;
+} LVKW_CtrlAxis_Linux;
+
 struct LVKW_CtrlDevice_Linux {
   LVKW_CtrlId id;
   int fd;
@@ -23,8 +53,11 @@ struct LVKW_CtrlDevice_Linux {
   uint16_t product_id;
   uint16_t version;
 
+  LVKW_CtrlAxis_Linux axes[LVKW_CTRL_ANALOG_STANDARD_COUNT];
+  // State as of the event frame being read. Published to the controller on SYN_REPORT.
   LVKW_AnalogInputState analogs[LVKW_CTRL_ANALOG_STANDARD_COUNT];
   LVKW_ButtonState buttons[LVKW_CTRL_BUTTON_STANDARD_COUNT];
+  bool dropped;  // SYN_DROPPED: events are discarded until the next SYN_REPORT, then state is re-read.
   struct LVKW_Controller_Base *controller;
 
   struct LVKW_CtrlDevice_Linux *next;
@@ -58,6 +91,24 @@ LVKW_Status lvkw_ctrl_setHapticLevels_Linux(LVKW_Controller *controller, uint32_
 
 #endif
 
+typedef struct LVKW_Context_Linux LVKW_Context_Linux;
+
+/* Fills xkb.modifier_lut from xkb.mod_indices. */
+void _lvkw_linux_build_modifier_lut(LVKW_Context_Linux *ctx);
+
+/* Compiled keymaps, keyed by the hash of their source text. Shared by every
+ * context living on the same thread. */
+typedef struct LVKW_XkbKeymapCache LVKW_XkbKeymapCache;
+
+LVKW_XkbKeymapCache *_lvkw_linux_keymap_cache_acquire(const LVKW_Lib_Xkb *xkb);
+void _lvkw_linux_keymap_cache_release(LVKW_XkbKeymapCache *cache);
+/* Returns a new reference to a cached keymap, or NULL on a miss. */
+struct xkb_keymap *_lvkw_linux_keymap_cache_lookup(LVKW_XkbKeymapCache *cache, const char *str,
+                                                   size_t size, uint64_t *out_hash);
+/* Takes its own reference to keymap, evicting the least recently used entry if full. */
+void _lvkw_linux_keymap_cache_insert(LVKW_XkbKeymapCache *cache, uint64_t hash, size_t size,
+                                     struct xkb_keymap *keymap);
+
 typedef struct LVKW_Context_Linux {
   LVKW_Context_Base base;
 
@@ -68,6 +119,7 @@ typedef struct LVKW_Context_Linux {
     struct xkb_context *ctx;
     struct xkb_keymap *keymap;
     struct xkb_state *state;
+    LVKW_XkbKeymapCache *keymap_cache;
     struct {
       xkb_mod_index_t shift;
       xkb_mod_index_t ctrl;
@@ -76,6 +128,12 @@ typedef struct LVKW_Context_Linux {
       xkb_mod_index_t caps;
       xkb_mod_index_t num;
     } mod_indices;
+
+    // Derived from the keymap, and rebuilt whenever it changes.
+    uint8_t modifier_lut[4][256];  // One byte of an xkb mod mask -> LVKW_ModifierFlags.
+    LVKW_Key keycode_lut[LVKW_LINUX_KEYCODE_TABLE_SIZE];  // xkb keycode -> LVKW_Key (X11).
+
+    LVKW_ModifierFlags modifiers;  // Effective modifiers, refreshed on every state change.
   } xkb;
 
 #ifdef LVKW_ENABLE_CONTROLLER
@@ -83,4 +141,12 @@ typedef struct LVKW_Context_Linux {
 #endif
 } LVKW_Context_Linux;
 
+static inline LVKW_ModifierFlags _lvkw_linux_modifiers_from_mask(const LVKW_Context_Linux *ctx,
+                                                                 xkb_mod_mask_t mask) {
+  return (LVKW_ModifierFlags)(ctx->xkb.modifier_lut[0][mask & 0xff] |
+                              ctx->xkb.modifier_lut[1][(mask >> 8) & 0xff] |
+                              ctx->xkb.modifier_lut[2][(mask >> 16) & 0xff] |
+                              ctx->xkb.modifier_lut[3][(mask >> 24) & 0xff]);
+}
+
 #endif
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: Zlib
+// Copyright (c) 2026 François Chabot
+
+#include <string.h>
+
+#include "internal.h"
+#include "linux_internal.h"
+
+// Compiling a keymap costs milliseconds, and compositors re-send the same one
+// on every keyboard enter, layout toggle and seat re-creation. Keymaps are
+// immutable once compiled, so identical source text can share a single
+// xkb_keymap.
+//
+// libxkbcommon refcounts are not atomic, so the cache is per-thread: every
+// context created on a given thread shares it, and no locking is needed.
+
+#define LVKW_KEYMAP_CACHE_CAPACITY 8
+
+typedef struct LVKW_XkbKeymapCacheEntry {
+  uint64_t hash;
+  size_t size;
+  struct xkb_keymap *keymap;
+  uint64_t last_used;
+} LVKW_XkbKeymapCacheEntry;
+
+struct LVKW_XkbKeymapCache {
+  uint32_t refcount;
+  uint64_t tick;
+
+  // Borrowed from the first context to attach. libxkbcommon stays mapped as long
+  // as any attached context holds it, and the last one releases the cache first.
+  __typeof__(xkb_keymap_ref) *keymap_ref;
+  __typeof__(xkb_keymap_unref) *keymap_unref;
+
+  LVKW_XkbKeymapCacheEntry entries[LVKW_KEYMAP_CACHE_CAPACITY];
+};
+
+static _Thread_local LVKW_XkbKeymapCache _lvkw_keymap_cache;
+
+LVKW_XkbKeymapCache *_lvkw_linux_keymap_cache_acquire(const LVKW_Lib_Xkb *xkb) {
+  LVKW_XkbKeymapCache *cache = &_lvkw_keymap_cache;
+  if (cache->refcount++ == 0) {
+    cache->keymap_ref = xkb->keymap_ref;
+    cache->keymap_unref = xkb->keymap_unref;
+  }
+  return cache;
+}
+
+void _lvkw_linux_keymap_cache_release(LVKW_XkbKeymapCache *cache) {
+  if (!cache || --cache->refcount > 0) return;
+
+  for (uint32_t i = 0; i < LVKW_KEYMAP_CACHE_CAPACITY; i++) {
+    if (cache->entries[i].keymap) cache->keymap_unref(cache->entries[i].keymap);
+  }
+  memset(cache, 0, sizeof(*cache));
+}
+
+// 64-bit FNV-1a. Keymaps are tens of kilobytes; hashing one is a few orders of
+// magnitude cheaper than compiling it.
+static uint64_t _keymap_hash(const char *str, size_t size) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= (uint8_t)str[i];
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+struct xkb_keymap *_lvkw_linux_keymap_cache_lookup(LVKW_XkbKeymapCache *cache, const char *str,
+                                                   size_t size, uint64_t *out_hash) {
+  const uint64_t hash = _keymap_hash(str, size);
+  *out_hash = hash;
+
+  for (uint32_t i = 0; i < LVKW_KEYMAP_CACHE_CAPACITY; i++) {
+    LVKW_XkbKeymapCacheEntry *entry = &cache->entries[i];
+    if (entry->keymap && entry->hash == hash && entry->size == size) {
+      entry->last_used = ++cache->tick;
+      return cache->keymap_ref(entry->keymap);
+    }
+  }
+  return NULL;
+}
+
+void _lvkw_linux_keymap_cache_insert(LVKW_XkbKeymapCache *cache, uint64_t hash, size_t size,
+                                     struct xkb_keymap *keymap) {
+  LVKW_XkbKeymapCacheEntry *victim = &cache->entries[0];
+  for (uint32_t i = 0; i < LVKW_KEYMAP_CACHE_CAPACITY; i++) {
+    LVKW_XkbKeymapCacheEntry *entry = &cache->entries[i];
+    if (!entry->keymap) {
+      victim = entry;
+      break;
+    }
+    if (entry->last_used < victim->last_used) victim = entry;
+  }
+
+  if (victim->keymap) cache->keymap_unref(victim->keymap);
+
+  victim->hash = hash;
+  victim->size = size;
+  victim->keymap = cache->keymap_ref(keymap);
+  victim->last_used = ++cache->tick;
+}
@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: Zlib
 // Copyright (c) 2026 François Chabot
 
+#include <string.h>
+
 #include "linux_internal.h"
 
 LVKW_Key lvkw_linux_translate_keysym(xkb_keysym_t keysym) {
@@ -248,113 +250,134 @@ LVKW_Key lvkw_linux_translate_keysym(xkb_keysym_t keysym) {
 
 #include <linux/input-event-codes.h>
 
-LVKW_Key lvkw_linux_translate_keycode(uint32_t keycode) {
-  switch (keycode) {
-    case KEY_SPACE: return LVKW_KEY_SPACE;
-    case KEY_APOSTROPHE: return LVKW_KEY_APOSTROPHE;
-    case KEY_COMMA: return LVKW_KEY_COMMA;
-    case KEY_MINUS: return LVKW_KEY_MINUS;
-    case KEY_DOT: return LVKW_KEY_PERIOD;
-    case KEY_SLASH: return LVKW_KEY_SLASH;
-    case KEY_0: return LVKW_KEY_0;
-    case KEY_1: return LVKW_KEY_1;
-    case KEY_2: return LVKW_KEY_2;
-    case KEY_3: return LVKW_KEY_3;
-    case KEY_4: return LVKW_KEY_4;
-    case KEY_5: return LVKW_KEY_5;
-    case KEY_6: return LVKW_KEY_6;
-    case KEY_7: return LVKW_KEY_7;
-    case KEY_8: return LVKW_KEY_8;
-    case KEY_9: return LVKW_KEY_9;
-    case KEY_SEMICOLON: return LVKW_KEY_SEMICOLON;
-    case KEY_EQUAL: return LVKW_KEY_EQUAL;
-    case KEY_A: return LVKW_KEY_A;
-    case KEY_B: return LVKW_KEY_B;
-    case KEY_C: return LVKW_KEY_C;
-    case KEY_D: return LVKW_KEY_D;
-    case KEY_E: return LVKW_KEY_E;
-    case KEY_F: return LVKW_KEY_F;
-    case KEY_G: return LVKW_KEY_G;
-    case KEY_H: return LVKW_KEY_H;
-    case KEY_I: return LVKW_KEY_I;
-    case KEY_J: return LVKW_KEY_J;
-    case KEY_K: return LVKW_KEY_K;
-    case KEY_L: return LVKW_KEY_L;
-    case KEY_M: return LVKW_KEY_M;
-    case KEY_N: return LVKW_KEY_N;
-    case KEY_O: return LVKW_KEY_O;
-    case KEY_P: return LVKW_KEY_P;
-    case KEY_Q: return LVKW_KEY_Q;
-    case KEY_R: return LVKW_KEY_R;
-    case KEY_S: return LVKW_KEY_S;
-    case KEY_T: return LVKW_KEY_T;
-    case KEY_U: return LVKW_KEY_U;
-    case KEY_V: return LVKW_KEY_V;
-    case KEY_W: return LVKW_KEY_W;
-    case KEY_X: return LVKW_KEY_X;
-    case KEY_Y: return LVKW_KEY_Y;
-    case KEY_Z: return LVKW_KEY_Z;
-    case KEY_LEFTBRACE: return LVKW_KEY_LEFT_BRACKET;
-    case KEY_BACKSLASH: return LVKW_KEY_BACKSLASH;
-    case KEY_RIGHTBRACE: return LVKW_KEY_RIGHT_BRACKET;
-    case KEY_GRAVE: return LVKW_KEY_GRAVE_ACCENT;
-    case KEY_ESC: return LVKW_KEY_ESCAPE;
-    case KEY_ENTER: return LVKW_KEY_ENTER;
-    case KEY_TAB: return LVKW_KEY_TAB;
-    case KEY_BACKSPACE: return LVKW_KEY_BACKSPACE;
-    case KEY_INSERT: return LVKW_KEY_INSERT;
-    case KEY_DELETE: return LVKW_KEY_DELETE;
-    case KEY_RIGHT: return LVKW_KEY_RIGHT;
-    case KEY_LEFT: return LVKW_KEY_LEFT;
-    case KEY_DOWN: return LVKW_KEY_DOWN;
-    case KEY_UP: return LVKW_KEY_UP;
-    case KEY_PAGEUP: return LVKW_KEY_PAGE_UP;
-    case KEY_PAGEDOWN: return LVKW_KEY_PAGE_DOWN;
-    case KEY_HOME: return LVKW_KEY_HOME;
-    case KEY_END: return LVKW_KEY_END;
-    case KEY_CAPSLOCK: return LVKW_KEY_CAPS_LOCK;
-    case KEY_SCROLLLOCK: return LVKW_KEY_SCROLL_LOCK;
-    case KEY_NUMLOCK: return LVKW_KEY_NUM_LOCK;
-    case KEY_PRINT: return LVKW_KEY_PRINT_SCREEN;
-    case KEY_PAUSE: return LVKW_KEY_PAUSE;
-    case KEY_F1: return LVKW_KEY_F1;
-    case KEY_F2: return LVKW_KEY_F2;
-    case KEY_F3: return LVKW_KEY_F3;
-    case KEY_F4: return LVKW_KEY_F4;
-    case KEY_F5: return LVKW_KEY_F5;
-    case KEY_F6: return LVKW_KEY_F6;
-    case KEY_F7: return LVKW_KEY_F7;
-    case KEY_F8: return LVKW_KEY_F8;
-    case KEY_F9: return LVKW_KEY_F9;
-    case KEY_F10: return LVKW_KEY_F10;
-    case KEY_F11: return LVKW_KEY_F11;
-    case KEY_F12: return LVKW_KEY_F12;
-    case KEY_KP0: return LVKW_KEY_KP_0;
-    case KEY_KP1: return LVKW_KEY_KP_1;
-    case KEY_KP2: return LVKW_KEY_KP_2;
-    case KEY_KP3: return LVKW_KEY_KP_3;
-    case KEY_KP4: return LVKW_KEY_KP_4;
-    case KEY_KP5: return LVKW_KEY_KP_5;
-    case KEY_KP6: return LVKW_KEY_KP_6;
-    case KEY_KP7: return LVKW_KEY_KP_7;
-    case KEY_KP8: return LVKW_KEY_KP_8;
-    case KEY_KP9: return LVKW_KEY_KP_9;
-    case KEY_KPDOT: return LVKW_KEY_KP_DECIMAL;
-    case KEY_KPSLASH: return LVKW_KEY_KP_DIVIDE;
-    case KEY_KPASTERISK: return LVKW_KEY_KP_MULTIPLY;
-    case KEY_KPMINUS: return LVKW_KEY_KP_SUBTRACT;
-    case KEY_KPPLUS: return LVKW_KEY_KP_ADD;
-    case KEY_KPENTER: return LVKW_KEY_KP_ENTER;
-    case KEY_KPEQUAL: return LVKW_KEY_KP_EQUAL;
-    case KEY_LEFTSHIFT: return LVKW_KEY_LEFT_SHIFT;
-    case KEY_LEFTCTRL: return LVKW_KEY_LEFT_CONTROL;
-    case KEY_LEFTALT: return LVKW_KEY_LEFT_ALT;
-    case KEY_LEFTMETA: return LVKW_KEY_LEFT_META;
-    case KEY_RIGHTSHIFT: return LVKW_KEY_RIGHT_SHIFT;
-    case KEY_RIGHTCTRL: return LVKW_KEY_RIGHT_CONTROL;
-    case KEY_RIGHTALT: return LVKW_KEY_RIGHT_ALT;
-    case KEY_RIGHTMETA: return LVKW_KEY_RIGHT_META;
-    case KEY_MENU: return LVKW_KEY_MENU;
-    default: return LVKW_KEY_UNKNOWN;
+// Physical key positions don't depend on the layout, so one table serves every keymap.
+const LVKW_Key _lvkw_linux_evdev_key_table[LVKW_LINUX_KEYCODE_TABLE_SIZE] = {
+    [KEY_SPACE] = LVKW_KEY_SPACE,
+    [KEY_APOSTROPHE] = LVKW_KEY_APOSTROPHE,
+    [KEY_COMMA] = LVKW_KEY_COMMA,
+    [KEY_MINUS] = LVKW_KEY_MINUS,
+    [KEY_DOT] = LVKW_KEY_PERIOD,
+    [KEY_SLASH] = LVKW_KEY_SLASH,
+    [KEY_0] = LVKW_KEY_0,
+    [KEY_1] = LVKW_KEY_1,
+    [KEY_2] = LVKW_KEY_2,
+    [KEY_3] = LVKW_KEY_3,
+    [KEY_4] = LVKW_KEY_4,
+    [KEY_5] = LVKW_KEY_5,
+    [KEY_6] = LVKW_KEY_6,
+    [KEY_7] = LVKW_KEY_7,
+    [KEY_8] = LVKW_KEY_8,
+    [KEY_9] = LVKW_KEY_9,
+    [KEY_SEMICOLON] = LVKW_KEY_SEMICOLON,
+    [KEY_EQUAL] = LVKW_KEY_EQUAL,
+    [KEY_A] = LVKW_KEY_A,
+    [KEY_B] = LVKW_KEY_B,
+    [KEY_C] = LVKW_KEY_C,
+    [KEY_D] = LVKW_KEY_D,
+    [KEY_E] = LVKW_KEY_E,
+    [KEY_F] = LVKW_KEY_F,
+    [KEY_G] = LVKW_KEY_G,
+    [KEY_H] = LVKW_KEY_H,
+    [KEY_I] = LVKW_KEY_I,
+    [KEY_J] = LVKW_KEY_J,
+    [KEY_K] = LVKW_KEY_K,
+    [KEY_L] = LVKW_KEY_L,
+    [KEY_M] = LVKW_KEY_M,
+    [KEY_N] = LVKW_KEY_N,
+    [KEY_O] = LVKW_KEY_O,
+    [KEY_P] = LVKW_KEY_P,
+    [KEY_Q] = LVKW_KEY_Q,
+    [KEY_R] = LVKW_KEY_R,
+    [KEY_S] = LVKW_KEY_S,
+    [KEY_T] = LVKW_KEY_T,
+    [KEY_U] = LVKW_KEY_U,
+    [KEY_V] = LVKW_KEY_V,
+    [KEY_W] = LVKW_KEY_W,
+    [KEY_X] = LVKW_KEY_X,
+    [KEY_Y] = LVKW_KEY_Y,
+    [KEY_Z] = LVKW_KEY_Z,
+    [KEY_LEFTBRACE] = LVKW_KEY_LEFT_BRACKET,
+    [KEY_BACKSLASH] = LVKW_KEY_BACKSLASH,
+    [KEY_RIGHTBRACE] = LVKW_KEY_RIGHT_BRACKET,
+    [KEY_GRAVE] = LVKW_KEY_GRAVE_ACCENT,
+    [KEY_ESC] = LVKW_KEY_ESCAPE,
+    [KEY_ENTER] = LVKW_KEY_ENTER,
+    [KEY_TAB] = LVKW_KEY_TAB,
+    [KEY_BACKSPACE] = LVKW_KEY_BACKSPACE,
+    [KEY_INSERT] = LVKW_KEY_INSERT,
+    [KEY_DELETE] = LVKW_KEY_DELETE,
+    [KEY_RIGHT] = LVKW_KEY_RIGHT,
+    [KEY_LEFT] = LVKW_KEY_LEFT,
+    [KEY_DOWN] = LVKW_KEY_DOWN,
+    [KEY_UP] = LVKW_KEY_UP,
+    [KEY_PAGEUP] = LVKW_KEY_PAGE_UP,
+    [KEY_PAGEDOWN] = LVKW_KEY_PAGE_DOWN,
+    [KEY_HOME] = LVKW_KEY_HOME,
+    [KEY_END] = LVKW_KEY_END,
+    [KEY_CAPSLOCK] = LVKW_KEY_CAPS_LOCK,
+    [KEY_SCROLLLOCK] = LVKW_KEY_SCROLL_LOCK,
+    [KEY_NUMLOCK] = LVKW_KEY_NUM_LOCK,
+    [KEY_PRINT] = LVKW_KEY_PRINT_SCREEN,
+    [KEY_PAUSE] = LVKW_KEY_PAUSE,
+    [KEY_F1] = LVKW_KEY_F1,
+    [KEY_F2] = LVKW_KEY_F2,
+    [KEY_F3] = LVKW_KEY_F3,
+    [KEY_F4] = LVKW_KEY_F4,
+    [KEY_F5] = LVKW_KEY_F5,
+    [KEY_F6] = LVKW_KEY_F6,
+    [KEY_F7] = LVKW_KEY_F7,
+    [KEY_F8] = LVKW_KEY_F8,
+    [KEY_F9] = LVKW_KEY_F9,
+    [KEY_F10] = LVKW_KEY_F10,
+    [KEY_F11] = LVKW_KEY_F11,
+    [KEY_F12] = LVKW_KEY_F12,
+    [KEY_KP0] = LVKW_KEY_KP_0,
+    [KEY_KP1] = LVKW_KEY_KP_1,
+    [KEY_KP2] = LVKW_KEY_KP_2,
+    [KEY_KP3] = LVKW_KEY_KP_3,
+    [KEY_KP4] = LVKW_KEY_KP_4,
+    [KEY_KP5] = LVKW_KEY_KP_5,
+    [KEY_KP6] = LVKW_KEY_KP_6,
+    [KEY_KP7] = LVKW_KEY_KP_7,
+    [KEY_KP8] = LVKW_KEY_KP_8,
+    [KEY_KP9] = LVKW_KEY_KP_9,
+    [KEY_KPDOT] = LVKW_KEY_KP_DECIMAL,
+    [KEY_KPSLASH] = LVKW_KEY_KP_DIVIDE,
+    [KEY_KPASTERISK] = LVKW_KEY_KP_MULTIPLY,
+    [KEY_KPMINUS] = LVKW_KEY_KP_SUBTRACT,
+    [KEY_KPPLUS] = LVKW_KEY_KP_ADD,
+    [KEY_KPENTER] = LVKW_KEY_KP_ENTER,
+    [KEY_KPEQUAL] = LVKW_KEY_KP_EQUAL,
+    [KEY_LEFTSHIFT] = LVKW_KEY_LEFT_SHIFT,
+    [KEY_LEFTCTRL] = LVKW_KEY_LEFT_CONTROL,
+    [KEY_LEFTALT] = LVKW_KEY_LEFT_ALT,
+    [KEY_LEFTMETA] = LVKW_KEY_LEFT_META,
+    [KEY_RIGHTSHIFT] = LVKW_KEY_RIGHT_SHIFT,
+    [KEY_RIGHTCTRL] = LVKW_KEY_RIGHT_CONTROL,
+    [KEY_RIGHTALT] = LVKW_KEY_RIGHT_ALT,
+    [KEY_RIGHTMETA] = LVKW_KEY_RIGHT_META,
+    [KEY_MENU] = LVKW_KEY_MENU,
+};
+
+void _lvkw_linux_build_modifier_lut(LVKW_Context_Linux *ctx) {
+  static const LVKW_ModifierFlags flags[] = {
+      LVKW_MODIFIER_SHIFT,     LVKW_MODIFIER_CONTROL,   LVKW_MODIFIER_ALT,
+      LVKW_MODIFIER_META,      LVKW_MODIFIER_CAPS_LOCK, LVKW_MODIFIER_NUM_LOCK,
+  };
+  const xkb_mod_index_t indices[] = {
+      ctx->xkb.mod_indices.shift, ctx->xkb.mod_indices.ctrl, ctx->xkb.mod_indices.alt,
+      ctx->xkb.mod_indices.super, ctx->xkb.mod_indices.caps, ctx->xkb.mod_indices.num,
+  };
+
+  memset(ctx->xkb.modifier_lut, 0, sizeof(ctx->xkb.modifier_lut));
+  for (uint32_t m = 0; m < sizeof(flags) / sizeof(flags[0]); ++m) {
+    const xkb_mod_index_t index = indices[m];
+    if (index == XKB_MOD_INVALID || index >= 32) continue;
+
+    const uint32_t byte = index / 8;
+    const uint32_t bit = 1u << (index % 8);
+    for (uint32_t value = 0; value < 256; ++value) {
+      if (value & bit) ctx->xkb.modifier_lut[byte][value] |= (uint8_t)flags[m];
+    }
   }
 }
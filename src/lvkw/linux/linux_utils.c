@@ -2,6 +2,7 @@
 // Copyright (c) 2026 François Chabot
 
 #include "internal.h"
+#include "linux_internal.h"
 #include <time.h>
 
 uint64_t _lvkw_get_timestamp_ms(void) {
@@ -9,3 +10,31 @@ uint64_t _lvkw_get_timestamp_ms(void) {
   clock_gettime(CLOCK_MONOTONIC, &ts);
   return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
 }
+
+uint64_t _lvkw_get_timestamp_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// Wayland and X11 both stamp input with a 32-bit millisecond clock that, in
+// practice, is CLOCK_MONOTONIC truncated. Rebase it onto the current 64-bit
+// monotonic time, and fall back to the reception time when the server clock
+// clearly lives in another domain.
+#define LVKW_LINUX_MAX_EVENT_AGE_MS 10000u
+
+uint64_t _lvkw_linux_event_time_ns(uint32_t time_ms) {
+  const uint64_t now_ns = _lvkw_get_timestamp_ns();
+  const uint32_t age_ms = (uint32_t)(now_ns / 1000000ull) - time_ms;
+  if (age_ms > LVKW_LINUX_MAX_EVENT_AGE_MS) return now_ns;
+  return (now_ns / 1000000ull - age_ms) * 1000000ull;
+}
+
+uint64_t _lvkw_linux_event_time_us_ns(uint64_t time_us) {
+  const uint64_t now_ns = _lvkw_get_timestamp_ns();
+  const uint64_t time_ns = time_us * 1000ull;
+  if (time_ns > now_ns || now_ns - time_ns > LVKW_LINUX_MAX_EVENT_AGE_MS * 1000000ull) {
+    return now_ns;
+  }
+  return time_ns;
+}
@@ -7,6 +7,7 @@
 #include "fractional-scale-v1-client-protocol.inc.h"
 #include "idle-inhibit-unstable-v1-client-protocol.inc.h"
 #include "pointer-constraints-unstable-v1-client-protocol.inc.h"
+#include "presentation-time-client-protocol.inc.h"
 #include "primary-selection-unstable-v1-client-protocol.inc.h"
 #include "relative-pointer-unstable-v1-client-protocol.inc.h"
 #include "tablet-v2-client-protocol.inc.h"
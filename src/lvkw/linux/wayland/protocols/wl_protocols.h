@@ -13,6 +13,7 @@
 #include "protocols/generated/fractional-scale-v1-client-protocol.h"
 #include "protocols/generated/idle-inhibit-unstable-v1-client-protocol.h"
 #include "protocols/generated/pointer-constraints-unstable-v1-client-protocol.h"
+#include "protocols/generated/presentation-time-client-protocol.h"
 #include "protocols/generated/primary-selection-unstable-v1-client-protocol.h"
 #include "protocols/generated/relative-pointer-unstable-v1-client-protocol.h"
 #include "protocols/generated/tablet-v2-client-protocol.h"
@@ -31,7 +32,7 @@
 #define WL_REGISTRY_REQUIRED_BINDINGS                                 \
   WL_REGISTRY_BINDING_ENTRY(wl_compositor, 4, NULL)                   \
   WL_REGISTRY_BINDING_ENTRY(wl_shm, 1, NULL)                          \
-  WL_REGISTRY_BINDING_ENTRY(wl_seat, 5, &_lvkw_wayland_seat_listener) \
+  WL_REGISTRY_BINDING_ENTRY(wl_seat, 8, &_lvkw_wayland_seat_listener) \
   WL_REGISTRY_BINDING_ENTRY(xdg_wm_base, 1, &_lvkw_wayland_wm_base_listener)
 
 // end of table
@@ -53,7 +54,9 @@
   WL_REGISTRY_BINDING_ENTRY(wp_cursor_shape_manager_v1, 1, NULL)      \
   WL_REGISTRY_BINDING_ENTRY(wp_content_type_manager_v1, 1, NULL)      \
   WL_REGISTRY_BINDING_ENTRY(ext_idle_notifier_v1, 1, NULL)            \
-  WL_REGISTRY_BINDING_ENTRY(zwp_text_input_manager_v3, 1, NULL)
+  WL_REGISTRY_BINDING_ENTRY(zwp_text_input_manager_v3, 1, NULL)       \
+  WL_REGISTRY_BINDING_ENTRY(zwp_tablet_manager_v2, 1, NULL)           \
+  WL_REGISTRY_BINDING_ENTRY(wp_presentation, 1, &_lvkw_wayland_presentation_listener)
 // end of table
 
 #define WL_REGISTRY_BINDING_ENTRY(name, version, listener) struct name *name;
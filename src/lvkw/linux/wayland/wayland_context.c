@@ -6,6 +6,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/eventfd.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "dlib/loader.h"
@@ -35,6 +36,20 @@ const struct xdg_wm_base_listener _lvkw_wayland_wm_base_listener = {
     .ping = _wm_base_handle_ping,
 };
 
+/* wp_presentation */
+
+static void _presentation_handle_clock_id(void *data, struct wp_presentation *presentation,
+                                          uint32_t clk_id) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
+  LVKW_CONTEXT_ASSUME(data, presentation != NULL, "presentation is NULL in clock_id handler");
+
+  ctx->presentation_clock_id = clk_id;
+}
+
+const struct wp_presentation_listener _lvkw_wayland_presentation_listener = {
+    .clock_id = _presentation_handle_clock_id,
+};
+
 /* libdecor */
 
 static void _libdecor_handle_error(struct libdecor *context, enum libdecor_error error,
@@ -205,16 +220,20 @@ LVKW_Status lvkw_ctx_create_WL(const LVKW_ContextCreateInfo *create_info,
 
   memset(ctx, 0, sizeof(*ctx));
   ctx->input.dnd.async.fd = -1;
+  ctx->input.repeat.timer_fd = -1;
+  ctx->presentation_clock_id = CLOCK_MONOTONIC;
 
   if (_lvkw_context_init_base(&ctx->linux_base.base, create_info) != LVKW_SUCCESS) {
     lvkw_context_free(&ctx->linux_base.base, ctx);
     goto cleanup_symbols;
   }
 
+  LVKW_METRICS_STAMP(load_start);
   if (!lvkw_load_wayland_symbols(&ctx->linux_base.base, &ctx->dlib.wl, &ctx->dlib.wlc, &ctx->dlib.xkb,
                                  &ctx->dlib.opt.decor)) {
     goto cleanup_ctx;
   }
+  LVKW_METRICS_RECORD_PHASE(&ctx->linux_base.base, LVKW_STARTUP_PHASE_LIBRARY_LOAD, load_start);
 
 #ifdef LVKW_INDIRECT_BACKEND
   ctx->linux_base.base.prv.backend = &_lvkw_wayland_backend;
@@ -225,17 +244,23 @@ LVKW_Status lvkw_ctx_create_WL(const LVKW_ContextCreateInfo *create_info,
   ctx->enforce_client_side_constraints =
       create_info->tuning->wayland.enforce_client_side_constraints;
 
+  LVKW_METRICS_STAMP(connect_start);
   if (!_lvkw_wayland_connect_display(ctx)) {
     goto cleanup_ctx;
   }
+  LVKW_METRICS_RECORD_PHASE(&ctx->linux_base.base, LVKW_STARTUP_PHASE_CONNECT, connect_start);
 
+  LVKW_METRICS_STAMP(xkb_start);
   ctx->linux_base.xkb.ctx = lvkw_xkb_context_new(ctx, XKB_CONTEXT_NO_FLAGS);
   if (!ctx->linux_base.xkb.ctx) {
     LVKW_REPORT_CTX_DIAGNOSTIC(&ctx->linux_base.base, LVKW_DIAGNOSTIC_RESOURCE_UNAVAILABLE,
                                "Failed to create xkb context");
     goto cleanup_display;
   }
+  ctx->linux_base.xkb.keymap_cache = _lvkw_linux_keymap_cache_acquire(&ctx->dlib.xkb);
+  LVKW_METRICS_RECORD_PHASE(&ctx->linux_base.base, LVKW_STARTUP_PHASE_KEYMAP, xkb_start);
 
+  LVKW_METRICS_STAMP(registry_start);
   ctx->wl.registry = lvkw_wl_display_get_registry(ctx, ctx->wl.display);
   if (!ctx->wl.registry) {
     LVKW_REPORT_CTX_DIAGNOSTIC(&ctx->linux_base.base, LVKW_DIAGNOSTIC_RESOURCE_UNAVAILABLE,
@@ -264,8 +289,11 @@ LVKW_Status lvkw_ctx_create_WL(const LVKW_ContextCreateInfo *create_info,
     result = LVKW_ERROR;
     goto cleanup_registry;
   }
+  LVKW_METRICS_RECORD_PHASE(&ctx->linux_base.base, LVKW_STARTUP_PHASE_PROTOCOL_DISCOVERY,
+                            registry_start);
 
   // roundtrip one more time so that the wl_output creation events are processed immediately.
+  LVKW_METRICS_STAMP(outputs_start);
   res = lvkw_wl_display_roundtrip(ctx, ctx->wl.display);
   if (res == -1) {
 #ifdef LVKW_ENABLE_DIAGNOSTICS
@@ -275,14 +303,17 @@ LVKW_Status lvkw_ctx_create_WL(const LVKW_ContextCreateInfo *create_info,
 #endif
     goto cleanup_registry;
   }
+  LVKW_METRICS_RECORD_PHASE(&ctx->linux_base.base, LVKW_STARTUP_PHASE_MONITORS, outputs_start);
 
   if (ctx->dlib.opt.decor.base.available) {
     ctx->libdecor.ctx =
         lvkw_libdecor_new(ctx, ctx->wl.display, &_libdecor_interface);
   }
 
+  LVKW_METRICS_STAMP(cursor_start);
   ctx->wl.cursor_theme = lvkw_wl_cursor_theme_load(ctx, NULL, 24, ctx->protocols.wl_shm);
   ctx->wl.cursor_surface = lvkw_wl_compositor_create_surface(ctx, ctx->protocols.wl_compositor);
+  LVKW_METRICS_RECORD_PHASE(&ctx->linux_base.base, LVKW_STARTUP_PHASE_CURSORS, cursor_start);
 
   for (int i = 1; i <= 12; i++) {
     ctx->linux_base.base.prv.standard_cursors[i].pub.flags = LVKW_CURSOR_FLAG_SYSTEM;
@@ -312,7 +343,9 @@ LVKW_Status lvkw_ctx_create_WL(const LVKW_ContextCreateInfo *create_info,
   ctx->linux_base.base.pub.flags |= LVKW_CONTEXT_STATE_READY;
 
 #ifdef LVKW_ENABLE_CONTROLLER
+  LVKW_METRICS_STAMP(ctrl_start);
   _lvkw_ctrl_init_context_Linux(&ctx->linux_base.base, &ctx->linux_base.controller, _ctrl_push_event_bridge, &ctx->linux_base.base);
+  LVKW_METRICS_RECORD_PHASE(&ctx->linux_base.base, LVKW_STARTUP_PHASE_CONTROLLER_SCAN, ctrl_start);
 #endif
 
   return LVKW_SUCCESS;
@@ -320,6 +353,7 @@ LVKW_Status lvkw_ctx_create_WL(const LVKW_ContextCreateInfo *create_info,
 cleanup_registry:
   _destroy_registry(ctx);
 cleanup_xkb:
+  _lvkw_linux_keymap_cache_release(ctx->linux_base.xkb.keymap_cache);
   if (ctx->linux_base.xkb.ctx) lvkw_xkb_context_unref(ctx, ctx->linux_base.xkb.ctx);
 cleanup_display:
   _lvkw_wayland_disconnect_display(ctx);
@@ -393,6 +427,11 @@ LVKW_Status lvkw_ctx_destroy_WL(LVKW_Context *ctx_handle) {
   if (ctx->input.pointer) {
     lvkw_wl_pointer_destroy(ctx, ctx->input.pointer);
   }
+  _lvkw_wayland_touch_cleanup(ctx);
+  _lvkw_wayland_tablet_cleanup(ctx);
+  if (ctx->input.pending_frame.entries) {
+    lvkw_context_free(&ctx->linux_base.base, ctx->input.pending_frame.entries);
+  }
   if (ctx->wl.cursor_surface) {
     lvkw_wl_surface_destroy(ctx, ctx->wl.cursor_surface);
   }
@@ -411,6 +450,7 @@ LVKW_Status lvkw_ctx_destroy_WL(LVKW_Context *ctx_handle) {
 
   if (ctx->linux_base.xkb.state) lvkw_xkb_state_unref(ctx, ctx->linux_base.xkb.state);
   if (ctx->linux_base.xkb.keymap) lvkw_xkb_keymap_unref(ctx, ctx->linux_base.xkb.keymap);
+  _lvkw_linux_keymap_cache_release(ctx->linux_base.xkb.keymap_cache);
   if (ctx->linux_base.xkb.ctx) lvkw_xkb_context_unref(ctx, ctx->linux_base.xkb.ctx);
 
   _destroy_registry(ctx);
@@ -513,9 +553,5 @@ LVKW_Status lvkw_ctx_getVkExtensions_WL(LVKW_Context *ctx_handle, uint32_t *coun
 LVKW_Status lvkw_ctx_getMetrics_WL(LVKW_Context *ctx, LVKW_MetricsCategory category,
                                      void *out_data, bool reset) {
   LVKW_API_VALIDATE(ctx_getMetrics, ctx, category, out_data, reset);
-  (void)ctx;
-  (void)category;
-  (void)out_data;
-  (void)reset;
-  return LVKW_ERROR;
+  return _lvkw_context_get_base_metrics((LVKW_Context_Base *)ctx, category, out_data, reset);
 }
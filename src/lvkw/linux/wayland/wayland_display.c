@@ -4,6 +4,7 @@
 #include <errno.h>
 #include <stdio.h>
 #include <sys/eventfd.h>
+#include <sys/timerfd.h>
 #include <unistd.h>
 
 #include "api_constraints.h"
@@ -55,10 +56,23 @@ bool _lvkw_wayland_connect_display(LVKW_Context_WL *ctx) {
     return false;
   }
 
+  // Key repeat is a convenience: without its timer, held keys simply don't repeat.
+  ctx->input.repeat.timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  if (ctx->input.repeat.timer_fd < 0) {
+    LVKW_REPORT_CTX_DIAGNOSTIC(&ctx->linux_base.base, LVKW_DIAGNOSTIC_RESOURCE_UNAVAILABLE,
+                               "Failed to create key repeat timerfd, key repeat is disabled");
+  }
+
   return true;
 }
 
 void _lvkw_wayland_disconnect_display(LVKW_Context_WL *ctx) {
+  if (ctx->input.repeat.timer_fd >= 0) {
+    close(ctx->input.repeat.timer_fd);
+    ctx->input.repeat.timer_fd = -1;
+  }
+  ctx->input.repeat.active = false;
+
   if (ctx->wake_fd >= 0) {
     close(ctx->wake_fd);
     ctx->wake_fd = -1;
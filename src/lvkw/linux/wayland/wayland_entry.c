@@ -25,6 +25,7 @@ const LVKW_Backend _lvkw_wayland_backend = {
             .get_geometry = lvkw_wnd_getGeometry_WL,
             .update = lvkw_wnd_update_WL,
             .request_focus = lvkw_wnd_requestFocus_WL,
+            .ack_resize = lvkw_wnd_ackResize_WL,
             .push_text = lvkw_wnd_pushText_WL,
             .pull_text = lvkw_wnd_pullText_WL,
             .push_data = lvkw_wnd_pushData_WL,
@@ -136,6 +137,11 @@ LVKW_Status lvkw_display_requestWindowFocus(LVKW_Window *window_handle) {
   return lvkw_wnd_requestFocus_WL(window_handle);
 }
 
+LVKW_Status lvkw_display_ackWindowResize(LVKW_Window *window_handle) {
+  LVKW_API_VALIDATE(wnd_ackResize, window_handle);
+  return lvkw_wnd_ackResize_WL(window_handle);
+}
+
 LVKW_Status lvkw_data_setClipboardText(LVKW_Window *window_handle, const char *text) {
   return lvkw_data_pushText(window_handle, LVKW_DATA_EXCHANGE_TARGET_CLIPBOARD, text);
 }
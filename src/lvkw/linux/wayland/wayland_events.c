@@ -7,35 +7,63 @@
 #include <unistd.h>
 
 #include "api_constraints.h"
+#include "mem_internal.h"
 #include "wayland_internal.h"
 
 #ifdef LVKW_ENABLE_CONTROLLER
 #include "controller/controller_internal.h"
 #endif
 
+static bool _pending_frame_reserve(LVKW_Context_WL *ctx, uint32_t needed) {
+  uint32_t capacity = ctx->input.pending_frame.capacity;
+  if (needed <= capacity) return true;
+
+  uint32_t next_capacity = capacity ? capacity * 2 : 16;
+  while (next_capacity < needed) next_capacity *= 2;
+
+  LVKW_WaylandPendingEvent *entries = lvkw_context_realloc_tagged(
+      &ctx->linux_base.base, LVKW_MEMORY_TAG_CORE, ctx->input.pending_frame.entries,
+      capacity * sizeof(LVKW_WaylandPendingEvent), next_capacity * sizeof(LVKW_WaylandPendingEvent));
+  if (!entries) return false;
+
+  ctx->input.pending_frame.entries = entries;
+  ctx->input.pending_frame.capacity = next_capacity;
+  return true;
+}
+
 void _lvkw_wayland_push_event(LVKW_Context_WL *ctx, LVKW_EventType type, LVKW_Window_WL *window,
-                              const LVKW_Event *evt) {
-  if (ctx->input.pending_frame.count >= 16) {
-    // Should not happen with standard Wayland protocols, but let's be safe
+                              const LVKW_Event *evt, uint64_t timestamp_ns) {
+  if (!_pending_frame_reserve(ctx, ctx->input.pending_frame.count + 1)) {
+    // Splitting the frame is still better than losing the event.
     _lvkw_wayland_dispatch_pending_frame(ctx);
+    if (ctx->input.pending_frame.capacity == 0) {
+      LVKW_Event zero = {0};
+      _lvkw_dispatch_timed_event(&ctx->linux_base.base, type, (LVKW_Window *)window,
+                                 evt ? evt : &zero, timestamp_ns);
+      return;
+    }
   }
 
-  uint32_t idx = ctx->input.pending_frame.count++;
-  ctx->input.pending_frame.types[idx] = type;
-  ctx->input.pending_frame.windows[idx] = window;
+  LVKW_WaylandPendingEvent *entry = &ctx->input.pending_frame.entries[ctx->input.pending_frame.count++];
+  entry->type = type;
+  entry->window = window;
+  entry->timestamp_ns = timestamp_ns;
   if (evt)
-    ctx->input.pending_frame.events[idx] = *evt;
+    entry->evt = *evt;
   else
-    memset(&ctx->input.pending_frame.events[idx], 0, sizeof(LVKW_Event));
+    memset(&entry->evt, 0, sizeof(LVKW_Event));
 }
 
 void _lvkw_wayland_dispatch_pending_frame(LVKW_Context_WL *ctx) {
   if (ctx->input.pending_frame.count == 0) return;
 
+  LVKW_METRICS_FRAME_SIZE(&ctx->linux_base.base, ctx->input.pending_frame.count);
+
+  // Callbacks may push more events, which can move the arena: dispatch from a copy.
   for (uint32_t i = 0; i < ctx->input.pending_frame.count; ++i) {
-    _lvkw_dispatch_event(&ctx->linux_base.base, ctx->input.pending_frame.types[i],
-                         (LVKW_Window *)ctx->input.pending_frame.windows[i],
-                         &ctx->input.pending_frame.events[i]);
+    LVKW_WaylandPendingEvent entry = ctx->input.pending_frame.entries[i];
+    _lvkw_dispatch_timed_event(&ctx->linux_base.base, entry.type, (LVKW_Window *)entry.window,
+                               &entry.evt, entry.timestamp_ns);
   }
 
   ctx->input.pending_frame.count = 0;
@@ -55,6 +83,7 @@ LVKW_Status lvkw_ctx_pumpEvents_WL(LVKW_Context *ctx_handle, uint32_t timeout_ms
   _lvkw_notification_ring_dispatch_all(&ctx->linux_base.base);
 
   uint64_t start_time = (timeout_ms != LVKW_NEVER && timeout_ms > 0) ? _lvkw_get_timestamp_ms() : 0;
+  ctx->frame_event_dispatched = false;
 
   for (;;) {
     int poll_timeout = -1;
@@ -72,6 +101,8 @@ LVKW_Status lvkw_ctx_pumpEvents_WL(LVKW_Context *ctx_handle, uint32_t timeout_ms
       }
     }
 
+    bool repeat_fd_ready = false;
+
     // OS pump
     if (lvkw_wl_display_prepare_read(ctx, ctx->wl.display) == 0) {
       lvkw_wl_display_flush(ctx, ctx->wl.display);
@@ -89,6 +120,14 @@ LVKW_Status lvkw_ctx_pumpEvents_WL(LVKW_Context *ctx_handle, uint32_t timeout_ms
         count++;
       }
 
+      int repeat_fd_idx = -1;
+      if (ctx->input.repeat.active) {
+        repeat_fd_idx = count;
+        pfds[count].fd = ctx->input.repeat.timer_fd;
+        pfds[count].events = POLLIN;
+        count++;
+      }
+
       int dnd_fd_idx = -1;
       int dnd_fd = _lvkw_wayland_dnd_get_async_fd(ctx);
       if (dnd_fd >= 0) {
@@ -125,6 +164,8 @@ LVKW_Status lvkw_ctx_pumpEvents_WL(LVKW_Context *ctx_handle, uint32_t timeout_ms
         if (transfer_count > 0) {
           _lvkw_wayland_process_transfers(ctx, pfds, transfer_pfds_idx);
         }
+
+        repeat_fd_ready = repeat_fd_idx != -1 && (pfds[repeat_fd_idx].revents & POLLIN);
       } else {
         lvkw_wl_display_cancel_read(ctx, ctx->wl.display);
       }
@@ -138,6 +179,13 @@ LVKW_Status lvkw_ctx_pumpEvents_WL(LVKW_Context *ctx_handle, uint32_t timeout_ms
     }
 
     lvkw_wl_display_dispatch_pending(ctx, ctx->wl.display);
+
+    // Tablet tool frames are held until the queue is drained, so they arrive batched.
+    _lvkw_wayland_pen_flush(ctx);
+
+    // After the display queue, so a release that arrived in the same wakeup cancels the repeat.
+    if (repeat_fd_ready) _lvkw_wayland_key_repeat_process(ctx);
+
     _lvkw_wayland_dnd_process_async(ctx, false, _lvkw_get_timestamp_ms());
 
 #ifdef LVKW_ENABLE_CONTROLLER
@@ -153,6 +201,9 @@ LVKW_Status lvkw_ctx_pumpEvents_WL(LVKW_Context *ctx_handle, uint32_t timeout_ms
     if (poll_timeout == 0) {
       break;
     }
+
+    // A FRAME event means "draw now": don't keep the app blocked until the timeout.
+    if (ctx->frame_event_dispatched) break;
     
     // If we were waiting for a specific event or timeout, we'd continue.
     // For now, let's keep the wait-until-timeout logic.
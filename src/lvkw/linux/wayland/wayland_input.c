@@ -7,6 +7,7 @@
 #include <linux/input-event-codes.h>
 #include <string.h>
 #include <sys/mman.h>
+#include <sys/timerfd.h>
 #include <unistd.h>
 
 #include "api_constraints.h"
@@ -98,9 +99,19 @@ static void _keyboard_handle_keymap(void *data, struct wl_keyboard *keyboard, ui
     return;
   }
 
-  struct xkb_keymap *keymap = lvkw_xkb_keymap_new_from_string(
-      ctx, ctx->linux_base.xkb.ctx, map_str, XKB_KEYMAP_FORMAT_TEXT_V1,
-      XKB_KEYMAP_COMPILE_NO_FLAGS);
+  // The compositor's size may include the trailing NUL; hash the text only.
+  const size_t text_size = strnlen(map_str, size);
+  uint64_t hash;
+  struct xkb_keymap *keymap =
+      _lvkw_linux_keymap_cache_lookup(ctx->linux_base.xkb.keymap_cache, map_str, text_size, &hash);
+  if (!keymap) {
+    keymap = lvkw_xkb_keymap_new_from_string(ctx, ctx->linux_base.xkb.ctx, map_str,
+                                             XKB_KEYMAP_FORMAT_TEXT_V1,
+                                             XKB_KEYMAP_COMPILE_NO_FLAGS);
+    if (keymap) {
+      _lvkw_linux_keymap_cache_insert(ctx->linux_base.xkb.keymap_cache, hash, text_size, keymap);
+    }
+  }
   munmap(map_str, size);
   close(fd);
 
@@ -118,6 +129,7 @@ static void _keyboard_handle_keymap(void *data, struct wl_keyboard *keyboard, ui
     return;
   }
 
+  _lvkw_wayland_key_repeat_stop(ctx);
   if (ctx->linux_base.xkb.keymap) lvkw_xkb_keymap_unref(ctx, ctx->linux_base.xkb.keymap);
   if (ctx->linux_base.xkb.state) lvkw_xkb_state_unref(ctx, ctx->linux_base.xkb.state);
 
@@ -136,20 +148,21 @@ static void _keyboard_handle_keymap(void *data, struct wl_keyboard *keyboard, ui
       lvkw_xkb_keymap_mod_get_index(ctx, keymap, XKB_MOD_NAME_CAPS);
   ctx->linux_base.xkb.mod_indices.num =
       lvkw_xkb_keymap_mod_get_index(ctx, keymap, XKB_MOD_NAME_NUM);
-}
+  _lvkw_linux_build_modifier_lut(&ctx->linux_base);
 
-static LVKW_Window_WL *_surface_to_live_window(LVKW_Context_WL *ctx, struct wl_surface *surface) {
-  if (!surface) return NULL;
-  LVKW_Window_WL *window = lvkw_wl_proxy_get_user_data(ctx, (struct wl_proxy *)surface);
-  if (!window) return NULL;
+  // The new state starts with no modifier; the compositor follows up with a modifiers event.
+  ctx->linux_base.xkb.modifiers = 0;
+}
 
-  LVKW_Window_Base *curr = ctx->linux_base.base.prv.window_list;
-  while (curr) {
-    if ((LVKW_Window_WL *)curr == window) return window;
-    curr = curr->prv.next;
-  }
+static LVKW_ModifierFlags _current_modifiers(const LVKW_Context_WL *ctx) {
+  return ctx->linux_base.xkb.modifiers;
+}
 
-  return NULL;
+// Surfaces we do not own (e.g. created by another toolkit on the same connection), or that belong
+// to a window already destroyed, are simply not in the map.
+static LVKW_Window_WL *_surface_to_live_window(LVKW_Context_WL *ctx, struct wl_surface *surface) {
+  return (LVKW_Window_WL *)_lvkw_window_map_find(&ctx->linux_base.base.prv.window_map,
+                                                 (uintptr_t)surface);
 }
 
 static void _keyboard_handle_enter(void *data, struct wl_keyboard *keyboard, uint32_t serial,
@@ -176,59 +189,30 @@ static void _keyboard_handle_leave(void *data, struct wl_keyboard *keyboard, uin
   LVKW_CONTEXT_ASSUME(&ctx->linux_base.base, keyboard != NULL,
                   "Keyboard must not be NULL in keyboard leave handler");
 
+  _lvkw_wayland_key_repeat_stop(ctx);
   _lvkw_wayland_sync_text_input_state(ctx, NULL);
   ctx->input.keyboard_focus = NULL;
 }
 
-static void _keyboard_handle_key(void *data, struct wl_keyboard *keyboard, uint32_t serial,
-                                 uint32_t time, uint32_t key, uint32_t state) {
-  LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
-
-  LVKW_CONTEXT_ASSUME(&ctx->linux_base.base, ctx != NULL, "Context handle must not be NULL in key handler");
-  LVKW_CONTEXT_ASSUME(&ctx->linux_base.base, keyboard != NULL, "Keyboard must not be NULL in key handler");
-
-  ctx->input.selections[0].serial = serial;
-  if (!ctx->input.keyboard_focus) return;
+// Caps the number of repeats delivered by a single pump, so a long stall doesn't
+// flood the application with a burst of stale repeats.
+#define LVKW_WAYLAND_MAX_KEY_REPEAT_BURST 8
 
-  uint32_t modifiers = 0;
-  if (ctx->linux_base.xkb.state) {
-    lvkw_xkb_state_key_get_one_sym(ctx, ctx->linux_base.xkb.state, key + 8);
-
-    xkb_mod_mask_t mask =
-        lvkw_xkb_state_serialize_mods(ctx, ctx->linux_base.xkb.state, XKB_STATE_MODS_EFFECTIVE);
-
-    if (ctx->linux_base.xkb.mod_indices.shift != XKB_MOD_INVALID &&
-        (mask & (1 << ctx->linux_base.xkb.mod_indices.shift)))
-      modifiers |= LVKW_MODIFIER_SHIFT;
-    if (ctx->linux_base.xkb.mod_indices.ctrl != XKB_MOD_INVALID &&
-        (mask & (1 << ctx->linux_base.xkb.mod_indices.ctrl)))
-      modifiers |= LVKW_MODIFIER_CONTROL;
-    if (ctx->linux_base.xkb.mod_indices.alt != XKB_MOD_INVALID &&
-        (mask & (1 << ctx->linux_base.xkb.mod_indices.alt)))
-      modifiers |= LVKW_MODIFIER_ALT;
-    if (ctx->linux_base.xkb.mod_indices.super != XKB_MOD_INVALID &&
-        (mask & (1 << ctx->linux_base.xkb.mod_indices.super)))
-      modifiers |= LVKW_MODIFIER_META;
-    if (ctx->linux_base.xkb.mod_indices.caps != XKB_MOD_INVALID &&
-        (mask & (1 << ctx->linux_base.xkb.mod_indices.caps)))
-      modifiers |= LVKW_MODIFIER_CAPS_LOCK;
-    if (ctx->linux_base.xkb.mod_indices.num != XKB_MOD_INVALID &&
-        (mask & (1 << ctx->linux_base.xkb.mod_indices.num)))
-      modifiers |= LVKW_MODIFIER_NUM_LOCK;
-  }
+// Dispatches the KEY event for an evdev scancode, followed by its TEXT_INPUT on presses.
+static void _keyboard_dispatch_key(LVKW_Context_WL *ctx, uint32_t key, bool pressed,
+                                   uint64_t timestamp_ns, bool repeat) {
+  LVKW_Window_WL *window = ctx->input.keyboard_focus;
 
   LVKW_Event evt = {0};
-
   evt.key.key = lvkw_linux_translate_keycode(key);
-  evt.key.state = (state == WL_KEYBOARD_KEY_STATE_PRESSED) ? LVKW_BUTTON_STATE_PRESSED
-                                                           : LVKW_BUTTON_STATE_RELEASED;
-  evt.key.modifiers = modifiers;
+  evt.key.state = pressed ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
+  evt.key.modifiers = _current_modifiers(ctx);
+  evt.key.repeat = repeat;
 
-  _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_KEY,
-                        (LVKW_Window *)ctx->input.keyboard_focus, &evt);
+  _lvkw_dispatch_timed_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_KEY, (LVKW_Window *)window,
+                             &evt, timestamp_ns);
 
-  if (state == WL_KEYBOARD_KEY_STATE_PRESSED && ctx->linux_base.xkb.state &&
-      !_is_text_input_v3_active(ctx, ctx->input.keyboard_focus)) {
+  if (pressed && ctx->linux_base.xkb.state && !_is_text_input_v3_active(ctx, window)) {
     char buffer[64];
     int len = lvkw_xkb_state_key_get_utf8(ctx, ctx->linux_base.xkb.state, key + 8, buffer, sizeof(buffer));
 
@@ -236,12 +220,110 @@ static void _keyboard_handle_key(void *data, struct wl_keyboard *keyboard, uint3
       LVKW_Event text_evt = {0};
       text_evt.text_input.text = buffer;
       text_evt.text_input.length = (uint32_t)len;
-      _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_TEXT_INPUT,
-                            (LVKW_Window *)ctx->input.keyboard_focus, &text_evt);
+      text_evt.text_input.repeat = repeat;
+      _lvkw_dispatch_timed_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_TEXT_INPUT,
+                                 (LVKW_Window *)window, &text_evt, timestamp_ns);
     }
   }
 }
 
+/* Key repeat */
+
+static bool _key_repeat_arm(LVKW_Context_WL *ctx, uint64_t first_ns, uint64_t interval_ns) {
+  struct itimerspec spec;
+  spec.it_value.tv_sec = (time_t)(first_ns / 1000000000ull);
+  spec.it_value.tv_nsec = (long)(first_ns % 1000000000ull);
+  spec.it_interval.tv_sec = (time_t)(interval_ns / 1000000000ull);
+  spec.it_interval.tv_nsec = (long)(interval_ns % 1000000000ull);
+  return timerfd_settime(ctx->input.repeat.timer_fd, TFD_TIMER_ABSTIME, &spec, NULL) == 0;
+}
+
+static void _key_repeat_start(LVKW_Context_WL *ctx, uint32_t key, uint64_t press_ns) {
+  if (ctx->input.repeat.timer_fd < 0 || ctx->input.repeat.rate <= 0) return;
+  if (!ctx->linux_base.xkb.keymap ||
+      !lvkw_xkb_keymap_key_repeats(ctx, ctx->linux_base.xkb.keymap, key + 8)) {
+    return;
+  }
+
+  const uint64_t delay_ms = (uint64_t)(ctx->input.repeat.delay > 0 ? ctx->input.repeat.delay : 0);
+  const uint64_t delay_ns = delay_ms * 1000000u;
+  const uint64_t interval_ns = (uint64_t)1000000000u / (uint64_t)ctx->input.repeat.rate;
+
+  // An all-zero it_value would disarm the timer instead.
+  const uint64_t first_ns = (press_ns + delay_ns) ? press_ns + delay_ns : 1;
+
+  if (!_key_repeat_arm(ctx, first_ns, interval_ns)) {
+    ctx->input.repeat.active = false;
+    return;
+  }
+
+  ctx->input.repeat.active = true;
+  ctx->input.repeat.key = key;
+  ctx->input.repeat.next_ns = first_ns;
+  ctx->input.repeat.interval_ns = interval_ns;
+}
+
+void _lvkw_wayland_key_repeat_stop(LVKW_Context_WL *ctx) {
+  if (!ctx->input.repeat.active) return;
+  ctx->input.repeat.active = false;
+  _key_repeat_arm(ctx, 0, 0);
+}
+
+void _lvkw_wayland_key_repeat_process(LVKW_Context_WL *ctx) {
+  if (ctx->input.repeat.timer_fd < 0) return;
+
+  uint64_t expirations = 0;
+  if (read(ctx->input.repeat.timer_fd, &expirations, sizeof(expirations)) !=
+      (ssize_t)sizeof(expirations)) {
+    return;
+  }
+
+  if (!ctx->input.repeat.active || !ctx->input.keyboard_focus || expirations == 0) return;
+
+  // Repeats beyond the burst cap are skipped, but the schedule stays on the timer's cadence.
+  uint64_t skipped = 0;
+  if (expirations > LVKW_WAYLAND_MAX_KEY_REPEAT_BURST) {
+    skipped = expirations - LVKW_WAYLAND_MAX_KEY_REPEAT_BURST;
+    expirations = LVKW_WAYLAND_MAX_KEY_REPEAT_BURST;
+  }
+  ctx->input.repeat.next_ns += skipped * ctx->input.repeat.interval_ns;
+
+  for (uint64_t i = 0; i < expirations; ++i) {
+    _keyboard_dispatch_key(ctx, ctx->input.repeat.key, true, ctx->input.repeat.next_ns, true);
+    ctx->input.repeat.next_ns += ctx->input.repeat.interval_ns;
+
+    // The callback may have destroyed the focused window.
+    if (!ctx->input.repeat.active || !ctx->input.keyboard_focus) break;
+  }
+
+  LVKW_Event sync_evt = {0};
+  _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
+}
+
+static void _keyboard_handle_key(void *data, struct wl_keyboard *keyboard, uint32_t serial,
+                                 uint32_t time, uint32_t key, uint32_t state) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
+
+  LVKW_CONTEXT_ASSUME(&ctx->linux_base.base, ctx != NULL, "Context handle must not be NULL in key handler");
+  LVKW_CONTEXT_ASSUME(&ctx->linux_base.base, keyboard != NULL, "Keyboard must not be NULL in key handler");
+
+  ctx->input.selections[0].serial = serial;
+  if (!ctx->input.keyboard_focus) return;
+
+  const bool pressed = (state == WL_KEYBOARD_KEY_STATE_PRESSED);
+  const uint64_t timestamp_ns = _lvkw_linux_event_time_ns(time);
+
+  // Pressing a non-repeating key (e.g. a modifier) keeps the current repeat going.
+  if (pressed) {
+    _key_repeat_start(ctx, key, timestamp_ns);
+  }
+  else if (ctx->input.repeat.active && ctx->input.repeat.key == key) {
+    _lvkw_wayland_key_repeat_stop(ctx);
+  }
+
+  _keyboard_dispatch_key(ctx, key, pressed, timestamp_ns, false);
+}
+
 static void _keyboard_handle_modifiers(void *data, struct wl_keyboard *keyboard, uint32_t serial,
                                        uint32_t mods_depressed, uint32_t mods_latched,
                                        uint32_t mods_locked, uint32_t group) {
@@ -251,6 +333,11 @@ static void _keyboard_handle_modifiers(void *data, struct wl_keyboard *keyboard,
   if (ctx->linux_base.xkb.state) {
     lvkw_xkb_state_update_mask(ctx, ctx->linux_base.xkb.state, mods_depressed, mods_latched,
                                mods_locked, 0, 0, group);
+
+    // Resolved once here rather than on every key, pointer button and DnD event.
+    xkb_mod_mask_t mask =
+        lvkw_xkb_state_serialize_mods(ctx, ctx->linux_base.xkb.state, XKB_STATE_MODS_EFFECTIVE);
+    ctx->linux_base.xkb.modifiers = _lvkw_linux_modifiers_from_mask(&ctx->linux_base, mask);
   }
 }
 
@@ -259,6 +346,7 @@ static void _keyboard_handle_repeat_info(void *data, struct wl_keyboard *keyboar
   LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
   ctx->input.repeat.rate = rate;
   ctx->input.repeat.delay = delay;
+  if (rate <= 0) _lvkw_wayland_key_repeat_stop(ctx);
 }
 
 static const struct wl_keyboard_listener _keyboard_listener = {
@@ -403,35 +491,6 @@ static const struct zwp_text_input_v3_listener _text_input_listener = {
 
 #define LVKW_WL_DND_OFFER_MAGIC 0x4C564B57u
 
-static LVKW_ModifierFlags _current_modifiers(const LVKW_Context_WL *ctx) {
-  if (!ctx->linux_base.xkb.state) return 0;
-
-  LVKW_ModifierFlags modifiers = 0;
-  xkb_mod_mask_t mask =
-      lvkw_xkb_state_serialize_mods(ctx, ctx->linux_base.xkb.state, XKB_STATE_MODS_EFFECTIVE);
-
-  if (ctx->linux_base.xkb.mod_indices.shift != XKB_MOD_INVALID &&
-      (mask & (1 << ctx->linux_base.xkb.mod_indices.shift)))
-    modifiers |= LVKW_MODIFIER_SHIFT;
-  if (ctx->linux_base.xkb.mod_indices.ctrl != XKB_MOD_INVALID &&
-      (mask & (1 << ctx->linux_base.xkb.mod_indices.ctrl)))
-    modifiers |= LVKW_MODIFIER_CONTROL;
-  if (ctx->linux_base.xkb.mod_indices.alt != XKB_MOD_INVALID &&
-      (mask & (1 << ctx->linux_base.xkb.mod_indices.alt)))
-    modifiers |= LVKW_MODIFIER_ALT;
-  if (ctx->linux_base.xkb.mod_indices.super != XKB_MOD_INVALID &&
-      (mask & (1 << ctx->linux_base.xkb.mod_indices.super)))
-    modifiers |= LVKW_MODIFIER_META;
-  if (ctx->linux_base.xkb.mod_indices.caps != XKB_MOD_INVALID &&
-      (mask & (1 << ctx->linux_base.xkb.mod_indices.caps)))
-    modifiers |= LVKW_MODIFIER_CAPS_LOCK;
-  if (ctx->linux_base.xkb.mod_indices.num != XKB_MOD_INVALID &&
-      (mask & (1 << ctx->linux_base.xkb.mod_indices.num)))
-    modifiers |= LVKW_MODIFIER_NUM_LOCK;
-
-  return modifiers;
-}
-
 static uint32_t _dnd_action_to_wl(LVKW_DndAction action) {
   switch (action) {
     case LVKW_DND_ACTION_MOVE:
@@ -525,7 +584,7 @@ static char *_decode_file_uri_path(LVKW_Context_WL *ctx, const char *uri) {
   }
 
   size_t in_len = strlen(path);
-  char *out = lvkw_context_alloc(&ctx->linux_base.base, in_len + 1);
+  char *out = lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_DND, in_len + 1);
   if (!out) return NULL;
 
   size_t o = 0;
@@ -569,7 +628,7 @@ static LVKW_WaylandDndPayload *_build_dnd_payload_from_uri_list(LVKW_Context_WL
 
     if (path_count == path_capacity) {
       uint16_t new_capacity = path_capacity == 0 ? 4 : (uint16_t)(path_capacity * 2);
-      char **new_paths = lvkw_context_realloc(&ctx->linux_base.base, paths, sizeof(char *) * path_capacity,
+      char **new_paths = lvkw_context_realloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_DND, paths, sizeof(char *) * path_capacity,
                                               sizeof(char *) * new_capacity);
       if (!new_paths) {
         lvkw_context_free(&ctx->linux_base.base, decoded);
@@ -587,7 +646,7 @@ static LVKW_WaylandDndPayload *_build_dnd_payload_from_uri_list(LVKW_Context_WL
     return NULL;
   }
 
-  LVKW_WaylandDndPayload *payload = lvkw_context_alloc(&ctx->linux_base.base, sizeof(LVKW_WaylandDndPayload));
+  LVKW_WaylandDndPayload *payload = lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_DND, sizeof(LVKW_WaylandDndPayload));
   if (!payload) {
     for (uint16_t i = 0; i < path_count; i++) lvkw_context_free(&ctx->linux_base.base, paths[i]);
     lvkw_context_free(&ctx->linux_base.base, paths);
@@ -608,7 +667,7 @@ static bool _dnd_async_ensure_capacity(LVKW_Context_WL *ctx, size_t needed) {
   size_t next_capacity = ctx->input.dnd.async.capacity == 0 ? 2048 : ctx->input.dnd.async.capacity * 2;
   while (next_capacity < needed) next_capacity *= 2;
 
-  uint8_t *next = lvkw_context_realloc(&ctx->linux_base.base, ctx->input.dnd.async.buffer,
+  uint8_t *next = lvkw_context_realloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_DND, ctx->input.dnd.async.buffer,
                                        ctx->input.dnd.async.capacity, next_capacity);
   if (!next) return false;
 
@@ -753,13 +812,13 @@ static void _emit_dnd_hover(LVKW_Context_WL *ctx, LVKW_Window_WL *window, bool e
   // For DND Hover, we push to pending frame. 
   // We could potentially coalesce here if we wanted to avoid spamming the user during a single pump,
   // but let's keep it simple for now as it belongs to the frame.
-  _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_DND_HOVER, window, &evt);
+  _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_DND_HOVER, window, &evt, 0);
 }
 
 static void _emit_dnd_leave(LVKW_Context_WL *ctx, LVKW_Window_WL *window) {
   LVKW_Event evt = {0};
   evt.dnd_leave.session_userdata = &window->base.prv.session_userdata;
-  _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_DND_LEAVE, window, &evt);
+  _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_DND_LEAVE, window, &evt, 0);
 }
 
 static void _emit_dnd_drop(LVKW_Context_WL *ctx, LVKW_Window_WL *window) {
@@ -769,7 +828,7 @@ static void _emit_dnd_drop(LVKW_Context_WL *ctx, LVKW_Window_WL *window) {
   evt.dnd_drop.paths = ctx->input.dnd.payload ? ctx->input.dnd.payload->paths : NULL;
   evt.dnd_drop.path_count = ctx->input.dnd.payload ? ctx->input.dnd.payload->path_count : 0;
   evt.dnd_drop.modifiers = _current_modifiers(ctx);
-  _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_DND_DROP, window, &evt);
+  _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_DND_DROP, window, &evt, 0);
 }
 
 static void _data_offer_handle_offer(void *data, struct wl_data_offer *offer, const char *mime_type) {
@@ -1158,6 +1217,8 @@ static void _pointer_handle_enter(void *data, struct wl_pointer *pointer, uint32
 static void _pointer_handle_leave(void *data, struct wl_pointer *pointer, uint32_t serial,
                                   struct wl_surface *surface) {
   LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
+  ctx->input.pending_pointer.scroll_value120_remainder_x = 0;
+  ctx->input.pending_pointer.scroll_value120_remainder_y = 0;
   if (ctx->input.pointer_focus) {
     ctx->input.pointer_focus->last_cursor_set = false;
   }
@@ -1197,6 +1258,7 @@ static void _pointer_handle_motion(void *data, struct wl_pointer *pointer, uint3
   LVKW_Scalar y = (LVKW_Scalar)wl_fixed_to_scalar(sy);
 
   ctx->input.pending_pointer.mask |= LVKW_EVENT_TYPE_MOUSE_MOTION;
+  ctx->input.pending_pointer.motion_time_ns = _lvkw_linux_event_time_ns(time);
   LVKW_Event *ev = &ctx->input.pending_pointer.motion;
   memset(ev, 0, sizeof(*ev));
   ev->mouse_motion.position.x = x;
@@ -1223,6 +1285,7 @@ static void _pointer_handle_button(void *data, struct wl_pointer *pointer, uint3
   if (lvkw_button == (LVKW_MouseButton)0xFFFFFFFF) return;
 
   ctx->input.pending_pointer.mask |= LVKW_EVENT_TYPE_MOUSE_BUTTON;
+  ctx->input.pending_pointer.button_time_ns = _lvkw_linux_event_time_ns(time);
   LVKW_Event *ev = &ctx->input.pending_pointer.button;
   memset(ev, 0, sizeof(*ev));
   ev->mouse_button.button = lvkw_button;
@@ -1231,19 +1294,23 @@ static void _pointer_handle_button(void *data, struct wl_pointer *pointer, uint3
   ev->mouse_button.modifiers = _current_modifiers(ctx);
 }
 
+static LVKW_Event *_pointer_begin_scroll(LVKW_Context_WL *ctx) {
+  if (!(ctx->input.pending_pointer.mask & LVKW_EVENT_TYPE_MOUSE_SCROLL)) {
+    memset(&ctx->input.pending_pointer.scroll, 0, sizeof(ctx->input.pending_pointer.scroll));
+    ctx->input.pending_pointer.scroll_time_ns = _lvkw_get_timestamp_ns();
+  }
+  ctx->input.pending_pointer.mask |= LVKW_EVENT_TYPE_MOUSE_SCROLL;
+  return &ctx->input.pending_pointer.scroll;
+}
+
 static void _pointer_handle_axis(void *data, struct wl_pointer *pointer, uint32_t time,
                                  uint32_t axis, wl_fixed_t value) {
   LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
   LVKW_Window_WL *window = ctx->input.pointer_focus;
   if (!window) return;
 
-  if (!(ctx->input.pending_pointer.mask & LVKW_EVENT_TYPE_MOUSE_SCROLL)) {
-    memset(&ctx->input.pending_pointer.scroll, 0, sizeof(ctx->input.pending_pointer.scroll));
-    ctx->input.pending_pointer.scroll_steps_x = 0;
-    ctx->input.pending_pointer.scroll_steps_y = 0;
-  }
-  ctx->input.pending_pointer.mask |= LVKW_EVENT_TYPE_MOUSE_SCROLL;
-  LVKW_Event *ev = &ctx->input.pending_pointer.scroll;
+  LVKW_Event *ev = _pointer_begin_scroll(ctx);
+  ctx->input.pending_pointer.scroll_time_ns = _lvkw_linux_event_time_ns(time);
   if (axis == WL_POINTER_AXIS_HORIZONTAL_SCROLL)
     ev->mouse_scroll.delta.x += -wl_fixed_to_scalar(value);
   else if (axis == WL_POINTER_AXIS_VERTICAL_SCROLL)
@@ -1252,45 +1319,104 @@ static void _pointer_handle_axis(void *data, struct wl_pointer *pointer, uint32_
 
 static void _pointer_handle_frame(void *data, struct wl_pointer *pointer) {
   LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
-  
+
   if (ctx->input.pending_pointer.mask & LVKW_EVENT_TYPE_MOUSE_MOTION) {
-    _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_MOUSE_MOTION, ctx->input.pointer_focus, &ctx->input.pending_pointer.motion);
+    _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_MOUSE_MOTION, ctx->input.pointer_focus,
+                             &ctx->input.pending_pointer.motion,
+                             ctx->input.pending_pointer.motion_time_ns);
   }
   if (ctx->input.pending_pointer.mask & LVKW_EVENT_TYPE_MOUSE_BUTTON) {
-    _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_MOUSE_BUTTON, ctx->input.pointer_focus, &ctx->input.pending_pointer.button);
+    _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_MOUSE_BUTTON, ctx->input.pointer_focus,
+                             &ctx->input.pending_pointer.button,
+                             ctx->input.pending_pointer.button_time_ns);
   }
   if (ctx->input.pending_pointer.mask & LVKW_EVENT_TYPE_MOUSE_SCROLL) {
-    ctx->input.pending_pointer.scroll.mouse_scroll.steps.x = ctx->input.pending_pointer.scroll_steps_x;
-    ctx->input.pending_pointer.scroll.mouse_scroll.steps.y = ctx->input.pending_pointer.scroll_steps_y;
-    _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_MOUSE_SCROLL, ctx->input.pointer_focus, &ctx->input.pending_pointer.scroll);
+    ctx->input.pending_pointer.scroll.mouse_scroll.source = ctx->input.pending_pointer.scroll_source;
+    _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_MOUSE_SCROLL, ctx->input.pointer_focus,
+                             &ctx->input.pending_pointer.scroll,
+                             ctx->input.pending_pointer.scroll_time_ns);
     memset(&ctx->input.pending_pointer.scroll, 0, sizeof(ctx->input.pending_pointer.scroll));
-    ctx->input.pending_pointer.scroll_steps_x = 0;
-    ctx->input.pending_pointer.scroll_steps_y = 0;
   }
 
+  // axis_source only describes the frame it was sent in.
+  ctx->input.pending_pointer.scroll_source = LVKW_SCROLL_SOURCE_UNKNOWN;
   ctx->input.pending_pointer.mask = 0;
   _lvkw_wayland_dispatch_pending_frame(ctx);
 }
+
 static void _pointer_handle_axis_source(void *data, struct wl_pointer *pointer,
-                                        uint32_t axis_source) {}
+                                        uint32_t axis_source) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
+
+  switch (axis_source) {
+    case WL_POINTER_AXIS_SOURCE_WHEEL:
+      ctx->input.pending_pointer.scroll_source = LVKW_SCROLL_SOURCE_WHEEL;
+      break;
+    case WL_POINTER_AXIS_SOURCE_FINGER:
+      ctx->input.pending_pointer.scroll_source = LVKW_SCROLL_SOURCE_FINGER;
+      break;
+    case WL_POINTER_AXIS_SOURCE_CONTINUOUS:
+      ctx->input.pending_pointer.scroll_source = LVKW_SCROLL_SOURCE_CONTINUOUS;
+      break;
+    case WL_POINTER_AXIS_SOURCE_WHEEL_TILT:
+      ctx->input.pending_pointer.scroll_source = LVKW_SCROLL_SOURCE_WHEEL_TILT;
+      break;
+    default:
+      ctx->input.pending_pointer.scroll_source = LVKW_SCROLL_SOURCE_UNKNOWN;
+      break;
+  }
+}
+
 static void _pointer_handle_axis_stop(void *data, struct wl_pointer *pointer, uint32_t time,
-                                      uint32_t axis) {}
+                                      uint32_t axis) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
+  if (!ctx->input.pointer_focus) return;
+
+  LVKW_Event *ev = _pointer_begin_scroll(ctx);
+  ctx->input.pending_pointer.scroll_time_ns = _lvkw_linux_event_time_ns(time);
+  if (axis == WL_POINTER_AXIS_HORIZONTAL_SCROLL) {
+    ev->mouse_scroll.flags |= LVKW_SCROLL_STOP_X;
+    ctx->input.pending_pointer.scroll_value120_remainder_x = 0;
+  }
+  else if (axis == WL_POINTER_AXIS_VERTICAL_SCROLL) {
+    ev->mouse_scroll.flags |= LVKW_SCROLL_STOP_Y;
+    ctx->input.pending_pointer.scroll_value120_remainder_y = 0;
+  }
+}
+
+// Pre-v8 seats: whole notches only.
 static void _pointer_handle_axis_discrete(void *data, struct wl_pointer *pointer, uint32_t axis,
                                           int32_t discrete) {
   LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
-  LVKW_Window_WL *window = ctx->input.pointer_focus;
-  if (!window) return;
+  if (!ctx->input.pointer_focus) return;
 
-  if (!(ctx->input.pending_pointer.mask & LVKW_EVENT_TYPE_MOUSE_SCROLL)) {
-    memset(&ctx->input.pending_pointer.scroll, 0, sizeof(ctx->input.pending_pointer.scroll));
-    ctx->input.pending_pointer.scroll_steps_x = 0;
-    ctx->input.pending_pointer.scroll_steps_y = 0;
+  LVKW_Event *ev = _pointer_begin_scroll(ctx);
+  if (axis == WL_POINTER_AXIS_HORIZONTAL_SCROLL) {
+    ev->mouse_scroll.steps.x += -discrete;
+    ev->mouse_scroll.value120.x += -discrete * 120;
   }
-  ctx->input.pending_pointer.mask |= LVKW_EVENT_TYPE_MOUSE_SCROLL;
+  else if (axis == WL_POINTER_AXIS_VERTICAL_SCROLL) {
+    ev->mouse_scroll.steps.y += -discrete;
+    ev->mouse_scroll.value120.y += -discrete * 120;
+  }
+}
+
+// v8+ seats: replaces axis_discrete, with 1/120th notch resolution.
+static void _pointer_handle_axis_value120(void *data, struct wl_pointer *pointer, uint32_t axis,
+                                          int32_t value120) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
+  if (!ctx->input.pointer_focus) return;
+
+  LVKW_Event *ev = _pointer_begin_scroll(ctx);
   if (axis == WL_POINTER_AXIS_HORIZONTAL_SCROLL) {
-    ctx->input.pending_pointer.scroll_steps_x += -discrete;
-  } else if (axis == WL_POINTER_AXIS_VERTICAL_SCROLL) {
-    ctx->input.pending_pointer.scroll_steps_y += -discrete;
+    ev->mouse_scroll.value120.x += -value120;
+    ev->mouse_scroll.steps.x += _lvkw_linux_accumulate_value120(
+        &ctx->input.pending_pointer.scroll_value120_remainder_x, -value120);
+  }
+  else if (axis == WL_POINTER_AXIS_VERTICAL_SCROLL) {
+    ev->mouse_scroll.value120.y += -value120;
+    ev->mouse_scroll.steps.y += _lvkw_linux_accumulate_value120(
+        &ctx->input.pending_pointer.scroll_value120_remainder_y, -value120);
   }
 }
 
@@ -1304,6 +1430,7 @@ static const struct wl_pointer_listener _pointer_listener = {
     .axis_source = _pointer_handle_axis_source,
     .axis_stop = _pointer_handle_axis_stop,
     .axis_discrete = _pointer_handle_axis_discrete,
+    .axis_value120 = _pointer_handle_axis_value120,
 };
 
 /* zwp_relative_pointer_v1 */
@@ -1323,7 +1450,8 @@ static void _relative_pointer_handle_motion(void *data,
   evt.mouse_motion.delta.y = wl_fixed_to_scalar(dy);
   evt.mouse_motion.raw_delta.x = wl_fixed_to_scalar(dx_unaccel);
   evt.mouse_motion.raw_delta.y = wl_fixed_to_scalar(dy_unaccel);
-  _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_MOUSE_MOTION, window, &evt);
+  _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_MOUSE_MOTION, window, &evt,
+                           _lvkw_linux_event_time_us_ns(((uint64_t)time_hi << 32) | time_lo));
 }
 
 const struct zwp_relative_pointer_v1_listener _lvkw_wayland_relative_pointer_listener = {
@@ -1342,6 +1470,616 @@ const struct zwp_locked_pointer_v1_listener _lvkw_wayland_locked_pointer_listene
     .unlocked = _locked_pointer_handle_unlocked,
 };
 
+/* wl_touch */
+
+static bool _touch_reserve_points(LVKW_Context_WL *ctx, uint32_t needed) {
+  uint32_t capacity = ctx->input.touch_frame.point_capacity;
+  if (needed <= capacity) return true;
+
+  uint32_t next_capacity = capacity ? capacity * 2 : 16;
+  while (next_capacity < needed) next_capacity *= 2;
+
+  LVKW_WaylandTouchPoint *points = lvkw_context_realloc_tagged(
+      &ctx->linux_base.base, LVKW_MEMORY_TAG_CORE, ctx->input.touch_frame.points,
+      capacity * sizeof(LVKW_WaylandTouchPoint), next_capacity * sizeof(LVKW_WaylandTouchPoint));
+  if (!points) return false;
+
+  ctx->input.touch_frame.points = points;
+  ctx->input.touch_frame.point_capacity = next_capacity;
+  return true;
+}
+
+// Grows the contact and contact window arrays together, so they always share a capacity.
+static bool _touch_reserve_contacts(LVKW_Context_WL *ctx, uint32_t needed) {
+  uint32_t capacity = ctx->input.touch_frame.contact_capacity;
+  if (needed <= capacity) return true;
+
+  uint32_t next_capacity = capacity ? capacity * 2 : 16;
+  while (next_capacity < needed) next_capacity *= 2;
+
+  LVKW_TouchContact *contacts = lvkw_context_realloc_tagged(
+      &ctx->linux_base.base, LVKW_MEMORY_TAG_CORE, ctx->input.touch_frame.contacts,
+      capacity * sizeof(LVKW_TouchContact), next_capacity * sizeof(LVKW_TouchContact));
+  if (!contacts) return false;
+  ctx->input.touch_frame.contacts = contacts;
+
+  LVKW_Window_WL **windows = lvkw_context_realloc_tagged(
+      &ctx->linux_base.base, LVKW_MEMORY_TAG_CORE, ctx->input.touch_frame.contact_windows,
+      capacity * sizeof(LVKW_Window_WL *), next_capacity * sizeof(LVKW_Window_WL *));
+  if (!windows) return false;
+  ctx->input.touch_frame.contact_windows = windows;
+
+  ctx->input.touch_frame.contact_capacity = next_capacity;
+  return true;
+}
+
+static LVKW_WaylandTouchPoint *_touch_find_point(LVKW_Context_WL *ctx, int32_t id) {
+  for (uint32_t i = 0; i < ctx->input.touch_frame.point_count; ++i) {
+    if (ctx->input.touch_frame.points[i].id == id) return &ctx->input.touch_frame.points[i];
+  }
+  return NULL;
+}
+
+static void _touch_remove_point(LVKW_Context_WL *ctx, LVKW_WaylandTouchPoint *point) {
+  *point = ctx->input.touch_frame.points[--ctx->input.touch_frame.point_count];
+}
+
+// Records a contact change for the current frame. Motion is folded into the contact's
+// pending entry, but down and up are transitions and always get their own entry.
+static void _touch_record(LVKW_Context_WL *ctx, const LVKW_WaylandTouchPoint *point,
+                          LVKW_TouchState state, uint64_t timestamp_ns) {
+  if (state == LVKW_TOUCH_STATE_MOTION) {
+    for (uint32_t i = ctx->input.touch_frame.contact_count; i-- > 0;) {
+      LVKW_TouchContact *contact = &ctx->input.touch_frame.contacts[i];
+      if (contact->id != point->id) continue;
+      if (contact->state == LVKW_TOUCH_STATE_DOWN || contact->state == LVKW_TOUCH_STATE_MOTION) {
+        contact->position = point->position;
+        contact->timestamp_ns = timestamp_ns;
+        return;
+      }
+      break;
+    }
+  }
+
+  uint32_t count = ctx->input.touch_frame.contact_count;
+  if (!_touch_reserve_contacts(ctx, count + 1)) return;
+
+  LVKW_TouchContact *contact = &ctx->input.touch_frame.contacts[count];
+  contact->timestamp_ns = timestamp_ns;
+  contact->position = point->position;
+  contact->id = point->id;
+  contact->state = state;
+  ctx->input.touch_frame.contact_windows[count] = point->window;
+  ctx->input.touch_frame.contact_count = count + 1;
+}
+
+// Emits one TOUCH event per window with the contacts recorded since the last frame.
+static void _touch_flush_frame(LVKW_Context_WL *ctx) {
+  LVKW_TouchContact *contacts = ctx->input.touch_frame.contacts;
+  LVKW_Window_WL **windows = ctx->input.touch_frame.contact_windows;
+  const uint32_t count = ctx->input.touch_frame.contact_count;
+  if (count == 0) return;
+
+  // Stable in-place grouping by window. Nearly always a single window, so nearly free.
+  uint32_t start = 0;
+  while (start < count) {
+    LVKW_Window_WL *window = windows[start];
+    uint32_t end = start + 1;
+    for (uint32_t j = end; j < count; ++j) {
+      if (windows[j] != window) continue;
+      LVKW_TouchContact moved = contacts[j];
+      memmove(&contacts[end + 1], &contacts[end], (j - end) * sizeof(*contacts));
+      memmove(&windows[end + 1], &windows[end], (j - end) * sizeof(*windows));
+      contacts[end] = moved;
+      windows[end] = window;
+      end++;
+    }
+
+    if (window) {
+      uint64_t timestamp_ns = 0;
+      for (uint32_t i = start; i < end; ++i) {
+        if (contacts[i].timestamp_ns > timestamp_ns) timestamp_ns = contacts[i].timestamp_ns;
+      }
+
+      LVKW_Event evt = {0};
+      evt.touch.contacts = &contacts[start];
+      evt.touch.contact_count = end - start;
+      _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_TOUCH, window, &evt, timestamp_ns);
+    }
+    start = end;
+  }
+
+  // The events point into the contact buffer, so it is only reset once they are dispatched.
+  _lvkw_wayland_dispatch_pending_frame(ctx);
+  ctx->input.touch_frame.contact_count = 0;
+}
+
+static void _touch_handle_down(void *data, struct wl_touch *touch, uint32_t serial,
+                               uint32_t time, struct wl_surface *surface, int32_t id,
+                               wl_fixed_t x, wl_fixed_t y) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
+  LVKW_Window_WL *window = _surface_to_live_window(ctx, surface);
+  if (!window) return;
+
+  LVKW_WaylandTouchPoint *point = _touch_find_point(ctx, id);
+  if (!point) {
+    if (!_touch_reserve_points(ctx, ctx->input.touch_frame.point_count + 1)) return;
+    point = &ctx->input.touch_frame.points[ctx->input.touch_frame.point_count++];
+  }
+
+  point->id = id;
+  point->window = window;
+  point->position.x = (LVKW_Scalar)wl_fixed_to_scalar(x);
+  point->position.y = (LVKW_Scalar)wl_fixed_to_scalar(y);
+  _touch_record(ctx, point, LVKW_TOUCH_STATE_DOWN, _lvkw_linux_event_time_ns(time));
+}
+
+static void _touch_handle_up(void *data, struct wl_touch *touch, uint32_t serial, uint32_t time,
+                             int32_t id) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
+  LVKW_WaylandTouchPoint *point = _touch_find_point(ctx, id);
+  if (!point) return;
+
+  _touch_record(ctx, point, LVKW_TOUCH_STATE_UP, _lvkw_linux_event_time_ns(time));
+  _touch_remove_point(ctx, point);
+}
+
+static void _touch_handle_motion(void *data, struct wl_touch *touch, uint32_t time, int32_t id,
+                                 wl_fixed_t x, wl_fixed_t y) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
+  LVKW_WaylandTouchPoint *point = _touch_find_point(ctx, id);
+  if (!point) return;
+
+  point->position.x = (LVKW_Scalar)wl_fixed_to_scalar(x);
+  point->position.y = (LVKW_Scalar)wl_fixed_to_scalar(y);
+  _touch_record(ctx, point, LVKW_TOUCH_STATE_MOTION, _lvkw_linux_event_time_ns(time));
+}
+
+static void _touch_handle_frame(void *data, struct wl_touch *touch) {
+  _touch_flush_frame((LVKW_Context_WL *)data);
+}
+
+// The compositor claimed every active contact: report them all as cancelled right away,
+// since no frame follows.
+static void _touch_handle_cancel(void *data, struct wl_touch *touch) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
+  const uint64_t now_ns = _lvkw_get_timestamp_ns();
+
+  ctx->input.touch_frame.contact_count = 0;
+  for (uint32_t i = 0; i < ctx->input.touch_frame.point_count; ++i) {
+    _touch_record(ctx, &ctx->input.touch_frame.points[i], LVKW_TOUCH_STATE_CANCELLED, now_ns);
+  }
+  ctx->input.touch_frame.point_count = 0;
+
+  _touch_flush_frame(ctx);
+}
+
+static void _touch_handle_shape(void *data, struct wl_touch *touch, int32_t id,
+                                wl_fixed_t major, wl_fixed_t minor) {}
+static void _touch_handle_orientation(void *data, struct wl_touch *touch, int32_t id,
+                                      wl_fixed_t orientation) {}
+
+static const struct wl_touch_listener _touch_listener = {
+    .down = _touch_handle_down,
+    .up = _touch_handle_up,
+    .motion = _touch_handle_motion,
+    .frame = _touch_handle_frame,
+    .cancel = _touch_handle_cancel,
+    .shape = _touch_handle_shape,
+    .orientation = _touch_handle_orientation,
+};
+
+void _lvkw_wayland_touch_forget_window(LVKW_Context_WL *ctx, LVKW_Window_WL *window) {
+  for (uint32_t i = 0; i < ctx->input.touch_frame.point_count;) {
+    if (ctx->input.touch_frame.points[i].window == window) {
+      _touch_remove_point(ctx, &ctx->input.touch_frame.points[i]);
+    }
+    else {
+      ++i;
+    }
+  }
+
+  // Pending contacts may already be referenced by queued events: drop them without compacting.
+  for (uint32_t i = 0; i < ctx->input.touch_frame.contact_count; ++i) {
+    if (ctx->input.touch_frame.contact_windows[i] == window) {
+      ctx->input.touch_frame.contact_windows[i] = NULL;
+    }
+  }
+}
+
+void _lvkw_wayland_touch_cleanup(LVKW_Context_WL *ctx) {
+  if (ctx->input.touch) {
+    lvkw_wl_touch_destroy(ctx, ctx->input.touch);
+    ctx->input.touch = NULL;
+  }
+
+  if (ctx->input.touch_frame.points) {
+    lvkw_context_free(&ctx->linux_base.base, ctx->input.touch_frame.points);
+  }
+  if (ctx->input.touch_frame.contacts) {
+    lvkw_context_free(&ctx->linux_base.base, ctx->input.touch_frame.contacts);
+  }
+  if (ctx->input.touch_frame.contact_windows) {
+    lvkw_context_free(&ctx->linux_base.base, ctx->input.touch_frame.contact_windows);
+  }
+  memset(&ctx->input.touch_frame, 0, sizeof(ctx->input.touch_frame));
+}
+
+/* zwp_tablet_v2 */
+
+static bool _pen_reserve_samples(LVKW_Context_WL *ctx, uint32_t needed) {
+  uint32_t capacity = ctx->input.pen_frame.capacity;
+  if (needed <= capacity) return true;
+
+  uint32_t next_capacity = capacity ? capacity * 2 : 32;
+  while (next_capacity < needed) next_capacity *= 2;
+
+  LVKW_PenSample *samples = lvkw_context_realloc_tagged(
+      &ctx->linux_base.base, LVKW_MEMORY_TAG_CORE, ctx->input.pen_frame.samples,
+      capacity * sizeof(LVKW_PenSample), next_capacity * sizeof(LVKW_PenSample));
+  if (!samples) return false;
+  ctx->input.pen_frame.samples = samples;
+
+  LVKW_WaylandPenTool **tools = lvkw_context_realloc_tagged(
+      &ctx->linux_base.base, LVKW_MEMORY_TAG_CORE, ctx->input.pen_frame.tools,
+      capacity * sizeof(LVKW_WaylandPenTool *), next_capacity * sizeof(LVKW_WaylandPenTool *));
+  if (!tools) return false;
+  ctx->input.pen_frame.tools = tools;
+
+  LVKW_Window_WL **windows = lvkw_context_realloc_tagged(
+      &ctx->linux_base.base, LVKW_MEMORY_TAG_CORE, ctx->input.pen_frame.windows,
+      capacity * sizeof(LVKW_Window_WL *), next_capacity * sizeof(LVKW_Window_WL *));
+  if (!windows) return false;
+  ctx->input.pen_frame.windows = windows;
+
+  ctx->input.pen_frame.capacity = next_capacity;
+  return true;
+}
+
+// Emits one PEN event per (tool, window) with every sample recorded since the last flush.
+void _lvkw_wayland_pen_flush(LVKW_Context_WL *ctx) {
+  LVKW_PenSample *samples = ctx->input.pen_frame.samples;
+  LVKW_WaylandPenTool **tools = ctx->input.pen_frame.tools;
+  LVKW_Window_WL **windows = ctx->input.pen_frame.windows;
+  const uint32_t count = ctx->input.pen_frame.count;
+  if (count == 0) return;
+
+  // Stable in-place grouping, as for touch contacts. There is nearly always a single tool.
+  uint32_t start = 0;
+  while (start < count) {
+    LVKW_WaylandPenTool *tool = tools[start];
+    LVKW_Window_WL *window = windows[start];
+    uint32_t end = start + 1;
+    for (uint32_t j = end; j < count; ++j) {
+      if (tools[j] != tool || windows[j] != window) continue;
+      LVKW_PenSample moved = samples[j];
+      memmove(&samples[end + 1], &samples[end], (j - end) * sizeof(*samples));
+      memmove(&tools[end + 1], &tools[end], (j - end) * sizeof(*tools));
+      memmove(&windows[end + 1], &windows[end], (j - end) * sizeof(*windows));
+      samples[end] = moved;
+      tools[end] = tool;
+      windows[end] = window;
+      end++;
+    }
+
+    if (window) {
+      LVKW_Event evt = {0};
+      evt.pen.samples = &samples[start];
+      evt.pen.sample_count = end - start;
+      evt.pen.tool = tool->type;
+      evt.pen.tool_serial = tool->serial;
+      _lvkw_wayland_push_event(ctx, LVKW_EVENT_TYPE_PEN, window, &evt,
+                               samples[end - 1].timestamp_ns);
+    }
+    start = end;
+  }
+
+  // The events point into the sample buffer, so it is only reset once they are dispatched.
+  _lvkw_wayland_dispatch_pending_frame(ctx);
+  ctx->input.pen_frame.count = 0;
+}
+
+static void _tablet_tool_handle_type(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                     uint32_t tool_type) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  switch (tool_type) {
+    case ZWP_TABLET_TOOL_V2_TYPE_ERASER: tool->type = LVKW_PEN_TOOL_ERASER; break;
+    case ZWP_TABLET_TOOL_V2_TYPE_BRUSH: tool->type = LVKW_PEN_TOOL_BRUSH; break;
+    case ZWP_TABLET_TOOL_V2_TYPE_PENCIL: tool->type = LVKW_PEN_TOOL_PENCIL; break;
+    case ZWP_TABLET_TOOL_V2_TYPE_AIRBRUSH: tool->type = LVKW_PEN_TOOL_AIRBRUSH; break;
+    case ZWP_TABLET_TOOL_V2_TYPE_FINGER: tool->type = LVKW_PEN_TOOL_FINGER; break;
+    case ZWP_TABLET_TOOL_V2_TYPE_MOUSE: tool->type = LVKW_PEN_TOOL_MOUSE; break;
+    case ZWP_TABLET_TOOL_V2_TYPE_LENS: tool->type = LVKW_PEN_TOOL_LENS; break;
+    case ZWP_TABLET_TOOL_V2_TYPE_PEN:
+    default: tool->type = LVKW_PEN_TOOL_PEN; break;
+  }
+}
+
+static void _tablet_tool_handle_hardware_serial(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                                uint32_t hi, uint32_t lo) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  tool->serial = ((uint64_t)hi << 32) | lo;
+}
+
+static void _tablet_tool_handle_hardware_id_wacom(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                                  uint32_t hi, uint32_t lo) {}
+
+static void _tablet_tool_handle_capability(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                           uint32_t capability) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  switch (capability) {
+    case ZWP_TABLET_TOOL_V2_CAPABILITY_TILT: tool->capability_flags |= LVKW_PEN_SAMPLE_HAS_TILT; break;
+    case ZWP_TABLET_TOOL_V2_CAPABILITY_PRESSURE: tool->capability_flags |= LVKW_PEN_SAMPLE_HAS_PRESSURE; break;
+    case ZWP_TABLET_TOOL_V2_CAPABILITY_DISTANCE: tool->capability_flags |= LVKW_PEN_SAMPLE_HAS_DISTANCE; break;
+    case ZWP_TABLET_TOOL_V2_CAPABILITY_ROTATION: tool->capability_flags |= LVKW_PEN_SAMPLE_HAS_ROTATION; break;
+    default: break;
+  }
+}
+
+static void _tablet_tool_handle_done(void *data, struct zwp_tablet_tool_v2 *proxy) {}
+
+static void _tablet_tool_handle_removed(void *data, struct zwp_tablet_tool_v2 *proxy) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  LVKW_Context_WL *ctx = tool->ctx;
+
+  // Pending samples still reference the tool.
+  _lvkw_wayland_pen_flush(ctx);
+
+  LVKW_WaylandPenTool **link = &ctx->input.pen_tools;
+  while (*link && *link != tool) link = &(*link)->next;
+  if (*link) *link = tool->next;
+
+  lvkw_zwp_tablet_tool_v2_destroy(ctx, tool->proxy);
+  lvkw_context_free(&ctx->linux_base.base, tool);
+}
+
+static void _tablet_tool_handle_proximity_in(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                             uint32_t serial, struct zwp_tablet_v2 *tablet,
+                                             struct wl_surface *surface) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  tool->focus = _surface_to_live_window(tool->ctx, surface);
+  tool->state.flags = 0;
+  tool->state.buttons = 0;
+  tool->frame_flags = LVKW_PEN_SAMPLE_PROXIMITY_IN;
+}
+
+static void _tablet_tool_handle_proximity_out(void *data, struct zwp_tablet_tool_v2 *proxy) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  tool->state.flags &= ~(uint32_t)LVKW_PEN_SAMPLE_DOWN;
+  tool->state.buttons = 0;
+  tool->frame_flags |= LVKW_PEN_SAMPLE_PROXIMITY_OUT;
+}
+
+static void _tablet_tool_handle_down(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                     uint32_t serial) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  tool->state.flags |= LVKW_PEN_SAMPLE_DOWN;
+}
+
+static void _tablet_tool_handle_up(void *data, struct zwp_tablet_tool_v2 *proxy) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  tool->state.flags &= ~(uint32_t)LVKW_PEN_SAMPLE_DOWN;
+}
+
+static void _tablet_tool_handle_motion(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                       wl_fixed_t x, wl_fixed_t y) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  tool->state.position.x = (LVKW_Scalar)wl_fixed_to_scalar(x);
+  tool->state.position.y = (LVKW_Scalar)wl_fixed_to_scalar(y);
+}
+
+static void _tablet_tool_handle_pressure(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                         uint32_t pressure) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  tool->state.pressure = (LVKW_Scalar)pressure / (LVKW_Scalar)65535;
+}
+
+static void _tablet_tool_handle_distance(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                         uint32_t distance) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  tool->state.distance = (LVKW_Scalar)distance / (LVKW_Scalar)65535;
+}
+
+static void _tablet_tool_handle_tilt(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                     wl_fixed_t tilt_x, wl_fixed_t tilt_y) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  tool->state.tilt.x = (LVKW_Scalar)wl_fixed_to_scalar(tilt_x);
+  tool->state.tilt.y = (LVKW_Scalar)wl_fixed_to_scalar(tilt_y);
+}
+
+static void _tablet_tool_handle_rotation(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                         wl_fixed_t degrees) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  tool->state.rotation = (LVKW_Scalar)wl_fixed_to_scalar(degrees);
+}
+
+static void _tablet_tool_handle_slider(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                       int32_t position) {}
+static void _tablet_tool_handle_wheel(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                      wl_fixed_t degrees, int32_t clicks) {}
+
+static void _tablet_tool_handle_button(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                       uint32_t serial, uint32_t button, uint32_t state) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  uint32_t bit;
+  switch (button) {
+    case BTN_STYLUS: bit = LVKW_PEN_BUTTON_1; break;
+    case BTN_STYLUS2: bit = LVKW_PEN_BUTTON_2; break;
+    case BTN_STYLUS3: bit = LVKW_PEN_BUTTON_3; break;
+    default: return;
+  }
+
+  if (state == ZWP_TABLET_TOOL_V2_BUTTON_STATE_PRESSED) {
+    tool->state.buttons |= bit;
+  }
+  else {
+    tool->state.buttons &= ~bit;
+  }
+}
+
+// Snapshots the tool state into the pending samples. Nothing is dispatched until the end of
+// the display dispatch, so a burst of frames reaches the application as one event.
+static void _tablet_tool_handle_frame(void *data, struct zwp_tablet_tool_v2 *proxy,
+                                      uint32_t time) {
+  LVKW_WaylandPenTool *tool = (LVKW_WaylandPenTool *)data;
+  LVKW_Context_WL *ctx = tool->ctx;
+
+  if (tool->focus && _pen_reserve_samples(ctx, ctx->input.pen_frame.count + 1)) {
+    const uint32_t idx = ctx->input.pen_frame.count++;
+    LVKW_PenSample *sample = &ctx->input.pen_frame.samples[idx];
+    *sample = tool->state;
+    sample->timestamp_ns = _lvkw_linux_event_time_ns(time);
+    sample->flags |= tool->frame_flags | tool->capability_flags;
+    ctx->input.pen_frame.tools[idx] = tool;
+    ctx->input.pen_frame.windows[idx] = tool->focus;
+  }
+
+  if (tool->frame_flags & LVKW_PEN_SAMPLE_PROXIMITY_OUT) tool->focus = NULL;
+  tool->frame_flags = 0;
+}
+
+static const struct zwp_tablet_tool_v2_listener _tablet_tool_listener = {
+    .type = _tablet_tool_handle_type,
+    .hardware_serial = _tablet_tool_handle_hardware_serial,
+    .hardware_id_wacom = _tablet_tool_handle_hardware_id_wacom,
+    .capability = _tablet_tool_handle_capability,
+    .done = _tablet_tool_handle_done,
+    .removed = _tablet_tool_handle_removed,
+    .proximity_in = _tablet_tool_handle_proximity_in,
+    .proximity_out = _tablet_tool_handle_proximity_out,
+    .down = _tablet_tool_handle_down,
+    .up = _tablet_tool_handle_up,
+    .motion = _tablet_tool_handle_motion,
+    .pressure = _tablet_tool_handle_pressure,
+    .distance = _tablet_tool_handle_distance,
+    .tilt = _tablet_tool_handle_tilt,
+    .rotation = _tablet_tool_handle_rotation,
+    .slider = _tablet_tool_handle_slider,
+    .wheel = _tablet_tool_handle_wheel,
+    .button = _tablet_tool_handle_button,
+    .frame = _tablet_tool_handle_frame,
+};
+
+static void _tablet_handle_name(void *data, struct zwp_tablet_v2 *proxy, const char *name) {}
+static void _tablet_handle_id(void *data, struct zwp_tablet_v2 *proxy, uint32_t vid,
+                              uint32_t pid) {}
+static void _tablet_handle_path(void *data, struct zwp_tablet_v2 *proxy, const char *path) {}
+static void _tablet_handle_done(void *data, struct zwp_tablet_v2 *proxy) {}
+static void _tablet_handle_bustype(void *data, struct zwp_tablet_v2 *proxy, uint32_t bustype) {}
+
+static void _tablet_handle_removed(void *data, struct zwp_tablet_v2 *proxy) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
+
+  LVKW_WaylandTablet **link = &ctx->input.tablets;
+  while (*link && (*link)->proxy != proxy) link = &(*link)->next;
+  if (*link) {
+    LVKW_WaylandTablet *tablet = *link;
+    *link = tablet->next;
+    lvkw_context_free(&ctx->linux_base.base, tablet);
+  }
+
+  lvkw_zwp_tablet_v2_destroy(ctx, proxy);
+}
+
+static const struct zwp_tablet_v2_listener _tablet_listener = {
+    .name = _tablet_handle_name,
+    .id = _tablet_handle_id,
+    .path = _tablet_handle_path,
+    .done = _tablet_handle_done,
+    .removed = _tablet_handle_removed,
+    .bustype = _tablet_handle_bustype,
+};
+
+static void _tablet_seat_handle_tablet_added(void *data, struct zwp_tablet_seat_v2 *seat,
+                                             struct zwp_tablet_v2 *proxy) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
+  LVKW_WaylandTablet *tablet =
+      lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CORE, sizeof(LVKW_WaylandTablet));
+  if (!tablet) {
+    lvkw_zwp_tablet_v2_destroy(ctx, proxy);
+    return;
+  }
+
+  tablet->proxy = proxy;
+  tablet->next = ctx->input.tablets;
+  ctx->input.tablets = tablet;
+  lvkw_zwp_tablet_v2_add_listener(ctx, proxy, &_tablet_listener, ctx);
+}
+
+static void _tablet_seat_handle_tool_added(void *data, struct zwp_tablet_seat_v2 *seat,
+                                           struct zwp_tablet_tool_v2 *proxy) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)data;
+  LVKW_WaylandPenTool *tool = lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CORE,
+                                                        sizeof(LVKW_WaylandPenTool));
+  if (!tool) {
+    lvkw_zwp_tablet_tool_v2_destroy(ctx, proxy);
+    return;
+  }
+
+  memset(tool, 0, sizeof(*tool));
+  tool->ctx = ctx;
+  tool->proxy = proxy;
+  tool->type = LVKW_PEN_TOOL_PEN;
+  tool->next = ctx->input.pen_tools;
+  ctx->input.pen_tools = tool;
+  lvkw_zwp_tablet_tool_v2_add_listener(ctx, proxy, &_tablet_tool_listener, tool);
+}
+
+// Pad buttons, rings and strips are not exposed.
+static void _tablet_seat_handle_pad_added(void *data, struct zwp_tablet_seat_v2 *seat,
+                                          struct zwp_tablet_pad_v2 *proxy) {
+  lvkw_zwp_tablet_pad_v2_destroy((LVKW_Context_WL *)data, proxy);
+}
+
+static const struct zwp_tablet_seat_v2_listener _tablet_seat_listener = {
+    .tablet_added = _tablet_seat_handle_tablet_added,
+    .tool_added = _tablet_seat_handle_tool_added,
+    .pad_added = _tablet_seat_handle_pad_added,
+};
+
+void _lvkw_wayland_pen_forget_window(LVKW_Context_WL *ctx, LVKW_Window_WL *window) {
+  for (LVKW_WaylandPenTool *tool = ctx->input.pen_tools; tool; tool = tool->next) {
+    if (tool->focus == window) tool->focus = NULL;
+  }
+
+  // Pending samples may already be referenced by queued events: drop them without compacting.
+  for (uint32_t i = 0; i < ctx->input.pen_frame.count; ++i) {
+    if (ctx->input.pen_frame.windows[i] == window) ctx->input.pen_frame.windows[i] = NULL;
+  }
+}
+
+void _lvkw_wayland_tablet_cleanup(LVKW_Context_WL *ctx) {
+  while (ctx->input.pen_tools) {
+    LVKW_WaylandPenTool *tool = ctx->input.pen_tools;
+    ctx->input.pen_tools = tool->next;
+    lvkw_zwp_tablet_tool_v2_destroy(ctx, tool->proxy);
+    lvkw_context_free(&ctx->linux_base.base, tool);
+  }
+
+  while (ctx->input.tablets) {
+    LVKW_WaylandTablet *tablet = ctx->input.tablets;
+    ctx->input.tablets = tablet->next;
+    lvkw_zwp_tablet_v2_destroy(ctx, tablet->proxy);
+    lvkw_context_free(&ctx->linux_base.base, tablet);
+  }
+
+  if (ctx->input.tablet_seat) {
+    lvkw_zwp_tablet_seat_v2_destroy(ctx, ctx->input.tablet_seat);
+    ctx->input.tablet_seat = NULL;
+  }
+
+  if (ctx->input.pen_frame.samples) {
+    lvkw_context_free(&ctx->linux_base.base, ctx->input.pen_frame.samples);
+  }
+  if (ctx->input.pen_frame.tools) {
+    lvkw_context_free(&ctx->linux_base.base, ctx->input.pen_frame.tools);
+  }
+  if (ctx->input.pen_frame.windows) {
+    lvkw_context_free(&ctx->linux_base.base, ctx->input.pen_frame.windows);
+  }
+  memset(&ctx->input.pen_frame, 0, sizeof(ctx->input.pen_frame));
+}
+
 /* wl_seat */
 
 static void _seat_handle_capabilities(void *data, struct wl_seat *seat, uint32_t capabilities) {
@@ -1367,6 +2105,14 @@ static void _seat_handle_capabilities(void *data, struct wl_seat *seat, uint32_t
     }
   }
 
+  if (!ctx->input.tablet_seat && ctx->protocols.opt.zwp_tablet_manager_v2) {
+    ctx->input.tablet_seat = lvkw_zwp_tablet_manager_v2_get_tablet_seat(
+        ctx, ctx->protocols.opt.zwp_tablet_manager_v2, seat);
+    if (ctx->input.tablet_seat) {
+      lvkw_zwp_tablet_seat_v2_add_listener(ctx, ctx->input.tablet_seat, &_tablet_seat_listener, ctx);
+    }
+  }
+
   if ((capabilities & WL_SEAT_CAPABILITY_KEYBOARD) && !ctx->input.keyboard) {
     ctx->input.keyboard = lvkw_wl_seat_get_keyboard(ctx, seat);
     lvkw_wl_keyboard_add_listener(ctx, ctx->input.keyboard, &_keyboard_listener, ctx);
@@ -1385,6 +2131,7 @@ static void _seat_handle_capabilities(void *data, struct wl_seat *seat, uint32_t
       lvkw_zwp_text_input_v3_destroy(ctx, ctx->input.text_input);
       ctx->input.text_input = NULL;
     }
+    _lvkw_wayland_key_repeat_stop(ctx);
     lvkw_wl_keyboard_destroy(ctx, ctx->input.keyboard);
     ctx->input.keyboard = NULL;
     ctx->input.keyboard_focus = NULL;
@@ -1447,6 +2194,17 @@ static void _seat_handle_capabilities(void *data, struct wl_seat *seat, uint32_t
     ctx->input.pointer = NULL;
   }
 
+  if ((capabilities & WL_SEAT_CAPABILITY_TOUCH) && !ctx->input.touch) {
+    ctx->input.touch = lvkw_wl_seat_get_touch(ctx, seat);
+    lvkw_wl_touch_add_listener(ctx, ctx->input.touch, &_touch_listener, ctx);
+  }
+  else if (!(capabilities & WL_SEAT_CAPABILITY_TOUCH) && ctx->input.touch) {
+    lvkw_wl_touch_destroy(ctx, ctx->input.touch);
+    ctx->input.touch = NULL;
+    ctx->input.touch_frame.point_count = 0;
+    ctx->input.touch_frame.contact_count = 0;
+  }
+
   if (!(capabilities & WL_SEAT_CAPABILITY_KEYBOARD) &&
       !(capabilities & WL_SEAT_CAPABILITY_POINTER)) {
     if (ctx->input.data_device) {
@@ -1485,7 +2243,7 @@ LVKW_Status lvkw_ctx_createCursor_WL(LVKW_Context *ctx_handle,
   LVKW_API_VALIDATE(ctx_createCursor, ctx_handle, create_info, out_cursor);
 
   LVKW_Context_WL *ctx = (LVKW_Context_WL *)ctx_handle;
-  LVKW_Cursor_WL *cursor = lvkw_context_alloc(&ctx->linux_base.base, sizeof(LVKW_Cursor_WL));
+  LVKW_Cursor_WL *cursor = lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CURSORS, sizeof(LVKW_Cursor_WL));
 
   if (!cursor) return LVKW_ERROR;
 
@@ -18,11 +18,15 @@
 
 #define LVKW_WAYLAND_MAX_EVENTS 4096
 
+// Presentation feedbacks a window may have in flight. Requests are skipped while full.
+#define LVKW_WAYLAND_MAX_PRESENTATION_FEEDBACKS 4
+
 typedef struct LVKW_Window_WL {
   LVKW_Window_Base base;
 
   struct {
     struct wl_surface *surface;
+    struct wl_callback *frame_callback;
   } wl;
 
   struct {
@@ -41,6 +45,7 @@ typedef struct LVKW_Window_WL {
     struct wp_fractional_scale_v1 *fractional_scale;
     struct zwp_idle_inhibitor_v1 *idle_inhibitor;
     struct wp_content_type_v1 *content_type;
+    struct wp_presentation_feedback *presentation_feedbacks[LVKW_WAYLAND_MAX_PRESENTATION_FEEDBACKS];
   } ext;
 
   struct {
@@ -66,9 +71,24 @@ typedef struct LVKW_Window_WL {
   bool is_decorated;
   bool accept_dnd;
   bool primary_selection;
+  bool frame_events;
+  bool presentation_feedback;
+#ifdef LVKW_GATHER_METRICS
+  LVKW_PresentationHistory presentation_history;
+#endif
   LVKW_TextInputType text_input_type;
   LVKW_LogicalRect text_input_rect;
 
+  /* Staged by xdg_toplevel.configure, applied on xdg_surface.configure */
+  struct {
+    int32_t width;
+    int32_t height;
+    bool maximized;
+    bool fullscreen;
+    bool focused;
+    bool pending;
+  } configure;
+
   /* Flags */
   bool transparent;
   bool mouse_passthrough;
@@ -121,6 +141,38 @@ typedef struct LVKW_WaylandTransfer {
   struct LVKW_WaylandTransfer *next;
 } LVKW_WaylandTransfer;
 
+typedef struct LVKW_WaylandPendingEvent {
+  LVKW_Event evt;
+  LVKW_EventType type;
+  LVKW_Window_WL *window;
+  uint64_t timestamp_ns;
+} LVKW_WaylandPendingEvent;
+
+// A touch contact that is currently down.
+typedef struct LVKW_WaylandTouchPoint {
+  int32_t id;
+  LVKW_Window_WL *window;
+  LVKW_LogicalVec position;
+} LVKW_WaylandTouchPoint;
+
+// A tablet tool announced by the tablet seat, along with its axis state as of the last frame.
+typedef struct LVKW_WaylandPenTool {
+  struct LVKW_Context_WL *ctx;
+  struct zwp_tablet_tool_v2 *proxy;
+  LVKW_PenTool type;
+  uint64_t serial;
+  uint32_t capability_flags;  // LVKW_PEN_SAMPLE_HAS_* bits.
+  LVKW_Window_WL *focus;
+  LVKW_PenSample state;       // flags only carries LVKW_PEN_SAMPLE_DOWN.
+  uint32_t frame_flags;       // Proximity transitions since the last frame.
+  struct LVKW_WaylandPenTool *next;
+} LVKW_WaylandPenTool;
+
+typedef struct LVKW_WaylandTablet {
+  struct zwp_tablet_v2 *proxy;
+  struct LVKW_WaylandTablet *next;
+} LVKW_WaylandTablet;
+
 typedef struct LVKW_WaylandSelectionState {
   struct wl_data_offer *offer;
   struct zwp_primary_selection_offer_v1 *primary_offer;
@@ -169,6 +221,8 @@ typedef struct LVKW_Context_WL {
   struct {
     struct wl_keyboard *keyboard;
     struct wl_pointer *pointer;
+    struct wl_touch *touch;
+    struct zwp_tablet_seat_v2 *tablet_seat;
     struct wl_data_device *data_device;
     struct zwp_primary_selection_device_v1 *primary_selection_device;
     struct zwp_text_input_v3 *text_input;
@@ -213,22 +267,61 @@ typedef struct LVKW_Context_WL {
       LVKW_Event motion;
       LVKW_Event button;
       LVKW_Event scroll;
-      int32_t scroll_steps_x;
-      int32_t scroll_steps_y;
+      LVKW_ScrollSource scroll_source;
+      // Sub-notch axis_value120 remainder carried across frames, so steps still add up.
+      int32_t scroll_value120_remainder_x;
+      int32_t scroll_value120_remainder_y;
+      uint64_t motion_time_ns;
+      uint64_t button_time_ns;
+      uint64_t scroll_time_ns;
     } pending_pointer;
 
+    // Events of the protocol frame being assembled. Grows on demand and is reused across
+    // frames, so a frame is never split however many events it holds.
     struct {
-      LVKW_Event events[16];
-      LVKW_EventType types[16];
-      LVKW_Window_WL *windows[16];
+      LVKW_WaylandPendingEvent *entries;
       uint32_t count;
+      uint32_t capacity;
     } pending_frame;
 
+    // Contacts currently down, and the contacts changed since the last wl_touch.frame along
+    // with their windows. The buffers only ever grow, so steady-state touch input doesn't
+    // allocate.
+    struct {
+      LVKW_WaylandTouchPoint *points;
+      uint32_t point_count;
+      uint32_t point_capacity;
+      LVKW_TouchContact *contacts;
+      LVKW_Window_WL **contact_windows;
+      uint32_t contact_count;
+      uint32_t contact_capacity;
+    } touch_frame;
+
+    LVKW_WaylandTablet *tablets;
+    LVKW_WaylandPenTool *pen_tools;
+
+    // One sample per tablet tool frame, with its tool and window, accumulated until the end
+    // of the display dispatch. Grows like touch_frame.
+    struct {
+      LVKW_PenSample *samples;
+      LVKW_WaylandPenTool **tools;
+      LVKW_Window_WL **windows;
+      uint32_t count;
+      uint32_t capacity;
+    } pen_frame;
+
     LVKW_WaylandSelectionState selections[2];
 
     struct {
       int32_t rate;
       int32_t delay;
+
+      // Client-side repeat, armed on key press. The timerfd sits in the pump's poll set.
+      int timer_fd;
+      bool active;
+      uint32_t key;  // evdev scancode of the repeating key.
+      uint64_t next_ns;
+      uint64_t interval_ns;
     } repeat;
   } input;
 
@@ -243,6 +336,12 @@ typedef struct LVKW_Context_WL {
 
   int wake_fd;
 
+  // Set when a FRAME event was dispatched, so lvkw_events_pump() can return early.
+  bool frame_event_dispatched;
+
+  // clockid_t of wp_presentation timestamps, as announced by the compositor.
+  uint32_t presentation_clock_id;
+
   LVKW_WaylandDecorationMode decoration_mode;
   uint32_t dnd_post_drop_timeout_ms;
   bool enforce_client_side_constraints;
@@ -273,9 +372,16 @@ void _lvkw_wayland_apply_size_constraints(LVKW_Window_WL *window);
 void _lvkw_wayland_update_cursor(LVKW_Context_WL *ctx, LVKW_Window_WL *window, uint32_t serial);
 LVKW_Event _lvkw_wayland_make_window_resized_event(LVKW_Window_WL *window);
 void _lvkw_wayland_sync_text_input_state(LVKW_Context_WL *ctx, LVKW_Window_WL *window);
+void _lvkw_wayland_key_repeat_stop(LVKW_Context_WL *ctx);
+void _lvkw_wayland_key_repeat_process(LVKW_Context_WL *ctx);
+void _lvkw_wayland_touch_forget_window(LVKW_Context_WL *ctx, LVKW_Window_WL *window);
+void _lvkw_wayland_touch_cleanup(LVKW_Context_WL *ctx);
+void _lvkw_wayland_pen_flush(LVKW_Context_WL *ctx);
+void _lvkw_wayland_pen_forget_window(LVKW_Context_WL *ctx, LVKW_Window_WL *window);
+void _lvkw_wayland_tablet_cleanup(LVKW_Context_WL *ctx);
 
 void _lvkw_wayland_push_event(LVKW_Context_WL *ctx, LVKW_EventType type, LVKW_Window_WL *window,
-                              const LVKW_Event *evt);
+                              const LVKW_Event *evt, uint64_t timestamp_ns);
 void _lvkw_wayland_dispatch_pending_frame(LVKW_Context_WL *ctx);
 
 void _lvkw_wayland_check_error(LVKW_Context_WL *ctx);
@@ -323,6 +429,7 @@ extern const struct wl_seat_listener _lvkw_wayland_seat_listener;
 extern const struct zwp_relative_pointer_v1_listener _lvkw_wayland_relative_pointer_listener;
 extern const struct zwp_locked_pointer_v1_listener _lvkw_wayland_locked_pointer_listener;
 extern const struct xdg_wm_base_listener _lvkw_wayland_wm_base_listener;
+extern const struct wp_presentation_listener _lvkw_wayland_presentation_listener;
 extern const struct wl_output_listener _lvkw_wayland_output_listener;
 extern const struct wp_fractional_scale_v1_listener _lvkw_wayland_fractional_scale_listener;
 extern const struct wl_surface_listener _lvkw_wayland_surface_listener;
@@ -358,6 +465,7 @@ LVKW_Status lvkw_wnd_getGeometry_WL(LVKW_Window *window, LVKW_WindowGeometry *ou
 LVKW_Status lvkw_wnd_update_WL(LVKW_Window *window, uint32_t field_mask,
                                const LVKW_WindowAttributes *attributes);
 LVKW_Status lvkw_wnd_requestFocus_WL(LVKW_Window *window);
+LVKW_Status lvkw_wnd_ackResize_WL(LVKW_Window *window);
 LVKW_Status lvkw_wnd_setClipboardText_WL(LVKW_Window *window, const char *text);
 LVKW_Status lvkw_wnd_getClipboardText_WL(LVKW_Window *window, const char **out_text);
 LVKW_Status lvkw_wnd_setClipboardData_WL(LVKW_Window *window, const LVKW_ClipboardData *data,
@@ -467,6 +575,11 @@ static inline xkb_mod_index_t lvkw_xkb_keymap_mod_get_index(const LVKW_Context_W
   return ctx->dlib.xkb.keymap_mod_get_index(keymap, name);
 }
 
+static inline int lvkw_xkb_keymap_key_repeats(const LVKW_Context_WL *ctx,
+                                              struct xkb_keymap *keymap, xkb_keycode_t key) {
+  return ctx->dlib.xkb.keymap_key_repeats(keymap, key);
+}
+
 static inline xkb_mod_mask_t lvkw_xkb_state_serialize_mods(const LVKW_Context_WL *ctx,
                                                            struct xkb_state *state,
                                                            enum xkb_state_component type) {
@@ -651,6 +764,7 @@ static inline void lvkw_wl_display_disconnect(LVKW_Context_WL *ctx, struct wl_di
 }
 
 static inline int lvkw_wl_display_roundtrip(LVKW_Context_WL *ctx, struct wl_display *display) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.wl.display_roundtrip(display);
 }
 
@@ -741,6 +855,7 @@ static inline LVKW_Scalar wl_fixed_to_scalar(wl_fixed_t f) {
 #include "protocols/generated/lvkw-fractional-scale-v1-helpers.h"
 #include "protocols/generated/lvkw-idle-inhibit-unstable-v1-helpers.h"
 #include "protocols/generated/lvkw-pointer-constraints-unstable-v1-helpers.h"
+#include "protocols/generated/lvkw-presentation-time-helpers.h"
 #include "protocols/generated/lvkw-primary-selection-unstable-v1-helpers.h"
 #include "protocols/generated/lvkw-relative-pointer-unstable-v1-helpers.h"
 #include "protocols/generated/lvkw-tablet-v2-helpers.h"
@@ -68,6 +68,13 @@ LVKW_Status lvkw_wnd_requestFocus_WL(LVKW_Window *window_handle) {
   return LVKW_SUCCESS;
 }
 
+LVKW_Status lvkw_wnd_ackResize_WL(LVKW_Window *window_handle) {
+  LVKW_API_VALIDATE(wnd_ackResize, window_handle);
+  // Configures are acknowledged as they arrive, and the compositor paces them against our
+  // commits: there is nothing left to signal.
+  return LVKW_SUCCESS;
+}
+
 /* ext_idle_notification_v1 */
 
 static void _idle_handle_idled(void *data, struct ext_idle_notification_v1 *notification) {
@@ -115,7 +122,7 @@ LVKW_WaylandDataOffer *_lvkw_wayland_offer_meta_get(LVKW_Context_WL *ctx,
 
 bool _lvkw_wayland_offer_meta_attach(LVKW_Context_WL *ctx, struct wl_data_offer *offer) {
   if (!offer) return false;
-  LVKW_WaylandDataOffer *meta = lvkw_context_alloc(&ctx->linux_base.base, sizeof(LVKW_WaylandDataOffer));
+  LVKW_WaylandDataOffer *meta = lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, sizeof(LVKW_WaylandDataOffer));
   if (!meta) return false;
   memset(meta, 0, sizeof(*meta));
   meta->magic = LVKW_WL_DND_OFFER_MAGIC;
@@ -139,7 +146,7 @@ bool _lvkw_wayland_offer_meta_append_mime(LVKW_Context_WL *ctx, struct wl_data_o
   if (meta->mime_count == meta->mime_capacity) {
     uint32_t next_capacity = meta->mime_capacity == 0 ? 8 : meta->mime_capacity * 2;
     const char **next =
-        lvkw_context_realloc(&ctx->linux_base.base, (void *)meta->mime_types,
+        lvkw_context_realloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, (void *)meta->mime_types,
                              sizeof(const char *) * meta->mime_capacity,
                              sizeof(const char *) * next_capacity);
     if (!next) return false;
@@ -179,7 +186,7 @@ void _lvkw_wayland_offer_destroy(LVKW_Context_WL *ctx, struct wl_data_offer *off
 
 bool _lvkw_wayland_primary_offer_meta_attach(LVKW_Context_WL *ctx, struct zwp_primary_selection_offer_v1 *offer) {
   if (!offer) return false;
-  LVKW_WaylandDataOffer *meta = lvkw_context_alloc(&ctx->linux_base.base, sizeof(LVKW_WaylandDataOffer));
+  LVKW_WaylandDataOffer *meta = lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, sizeof(LVKW_WaylandDataOffer));
   if (!meta) return false;
   memset(meta, 0, sizeof(*meta));
   meta->magic = LVKW_WL_DND_OFFER_MAGIC;
@@ -211,7 +218,7 @@ bool _lvkw_wayland_primary_offer_meta_append_mime(LVKW_Context_WL *ctx, struct z
   if (meta->mime_count == meta->mime_capacity) {
     uint32_t next_capacity = meta->mime_capacity == 0 ? 8 : meta->mime_capacity * 2;
     const char **next =
-        lvkw_context_realloc(&ctx->linux_base.base, (void *)meta->mime_types,
+        lvkw_context_realloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, (void *)meta->mime_types,
                              sizeof(const char *) * meta->mime_capacity,
                              sizeof(const char *) * next_capacity);
     if (!next) return false;
@@ -315,7 +322,7 @@ static bool _selection_ensure_read_cache_capacity(LVKW_Context_WL *ctx, LVKW_Dat
   LVKW_WaylandSelectionState *state = &ctx->input.selections[target];
   if (capacity <= state->read_cache_capacity) return true;
 
-  uint8_t *next = lvkw_context_realloc(&ctx->linux_base.base, state->read_cache,
+  uint8_t *next = lvkw_context_realloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, state->read_cache,
                                        state->read_cache_capacity, capacity);
   if (!next) return false;
 
@@ -418,7 +425,7 @@ static bool _read_offer_generic(LVKW_Context_WL *ctx, void *offer, const char *m
       size_t next_capacity = capacity == 0 ? 2048 : capacity * 2;
       while (next_capacity < needed) next_capacity *= 2;
 
-      uint8_t *next = lvkw_context_realloc(&ctx->linux_base.base, buffer, capacity, next_capacity);
+      uint8_t *next = lvkw_context_realloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, buffer, capacity, next_capacity);
       if (!next) {
         if (buffer) lvkw_context_free(&ctx->linux_base.base, buffer);
         close(pipefd[0]);
@@ -495,7 +502,7 @@ static void _selection_register_transfer(LVKW_Context_WL *ctx, LVKW_Window_WL *w
   int flags = fcntl(pipefd[0], F_GETFL, 0);
   fcntl(pipefd[0], F_SETFL, flags | O_NONBLOCK);
 
-  LVKW_WaylandTransfer *transfer = lvkw_context_alloc(&ctx->linux_base.base, sizeof(LVKW_WaylandTransfer));
+  LVKW_WaylandTransfer *transfer = lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_TRANSFERS, sizeof(LVKW_WaylandTransfer));
   if (!transfer) {
     close(pipefd[0]);
     return;
@@ -575,7 +582,7 @@ void _lvkw_wayland_process_transfers(LVKW_Context_WL *ctx, const struct pollfd *
         if (transfer->size + (size_t)n > transfer->capacity) {
           size_t next_cap = transfer->capacity == 0 ? 4096 : transfer->capacity * 2;
           while (next_cap < transfer->size + (size_t)n) next_cap *= 2;
-          uint8_t *next_buf = lvkw_context_realloc(&ctx->linux_base.base, transfer->buffer, transfer->capacity, next_cap);
+          uint8_t *next_buf = lvkw_context_realloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_TRANSFERS, transfer->buffer, transfer->capacity, next_cap);
           if (next_buf) {
             transfer->buffer = next_buf;
             transfer->capacity = next_cap;
@@ -902,7 +909,7 @@ LVKW_Status lvkw_wnd_pushData_WL(LVKW_Window *window, LVKW_DataExchangeTarget ta
   }
 
   LVKW_WaylandClipboardMime *owned_copy =
-      lvkw_context_alloc(&ctx->linux_base.base, sizeof(LVKW_WaylandClipboardMime) * count);
+      lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, sizeof(LVKW_WaylandClipboardMime) * count);
   if (!owned_copy) return LVKW_ERROR;
   memset(owned_copy, 0, sizeof(LVKW_WaylandClipboardMime) * count);
 
@@ -915,7 +922,7 @@ LVKW_Status lvkw_wnd_pushData_WL(LVKW_Window *window, LVKW_DataExchangeTarget ta
     }
     owned_copy[i].size = data[i].size;
     if (data[i].size > 0) {
-      owned_copy[i].bytes = lvkw_context_alloc(&ctx->linux_base.base, data[i].size);
+      owned_copy[i].bytes = lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, data[i].size);
       if (!owned_copy[i].bytes) {
         for (uint32_t j = 0; j < i; ++j) lvkw_context_free(&ctx->linux_base.base, owned_copy[j].bytes);
         lvkw_context_free(&ctx->linux_base.base, owned_copy);
@@ -998,7 +1005,7 @@ LVKW_Status lvkw_wnd_listBufferMimeTypes_WL(LVKW_Window *window, LVKW_DataExchan
   uint32_t src_count = 0;
   if (state->owned_mime_count > 0) {
     src_count = state->owned_mime_count;
-    const char **owned_mimes = lvkw_context_alloc(&ctx->linux_base.base, sizeof(const char *) * src_count);
+    const char **owned_mimes = lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, sizeof(const char *) * src_count);
     if (!owned_mimes) return LVKW_ERROR;
     for (uint32_t i = 0; i < src_count; ++i) {
       owned_mimes[i] = state->owned_mimes[i].mime_type;
@@ -1017,7 +1024,7 @@ LVKW_Status lvkw_wnd_listBufferMimeTypes_WL(LVKW_Window *window, LVKW_DataExchan
         src = meta->mime_types;
         src_count = meta->mime_count;
 
-        const char **query_mimes = lvkw_context_alloc(&ctx->linux_base.base, sizeof(const char *) * src_count);
+        const char **query_mimes = lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, sizeof(const char *) * src_count);
         if (!query_mimes) return LVKW_ERROR;
         memcpy(query_mimes, src, sizeof(const char *) * src_count);
         state->mime_query_ptr = query_mimes;
@@ -60,7 +60,7 @@ static void _output_handle_mode(void *data, struct wl_output *wl_output, uint32_
   size_t new_size = new_count * sizeof(LVKW_VideoMode);
 
   LVKW_VideoMode *new_modes =
-      (LVKW_VideoMode *)lvkw_context_realloc(&ctx->linux_base.base, monitor->modes, old_size, new_size);
+      (LVKW_VideoMode *)lvkw_context_realloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_MONITORS, monitor->modes, old_size, new_size);
 
   if (new_modes) {
     new_modes[monitor->mode_count] = mode;
@@ -174,7 +174,7 @@ void _lvkw_wayland_bind_output(LVKW_Context_WL *ctx, uint32_t name, uint32_t ver
   }
 
   LVKW_Monitor_WL *monitor =
-      (LVKW_Monitor_WL *)lvkw_context_alloc(&ctx->linux_base.base, sizeof(LVKW_Monitor_WL));
+      (LVKW_Monitor_WL *)lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_MONITORS, sizeof(LVKW_Monitor_WL));
   if (!monitor) {
     lvkw_wl_output_destroy(ctx, output);
     LVKW_REPORT_CTX_DIAGNOSTIC(&ctx->linux_base.base, LVKW_DIAGNOSTIC_OUT_OF_MEMORY,
@@ -3,6 +3,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "api_constraints.h"
 #include "assume.h"
@@ -41,6 +42,11 @@ static LVKW_Status _lvkw_wnd_setFullscreen_WL(LVKW_Window *window_handle, bool e
 static LVKW_Status _lvkw_wnd_setMaximized_WL(LVKW_Window *window_handle, bool enabled);
 static LVKW_Status _lvkw_wnd_setCursorMode_WL(LVKW_Window *window_handle, LVKW_CursorMode mode);
 static LVKW_Status _lvkw_wnd_setCursor_WL(LVKW_Window *window_handle, LVKW_Cursor *cursor);
+static void _lvkw_wayland_request_frame(LVKW_Window_WL *window);
+static void _lvkw_wayland_cancel_frame(LVKW_Window_WL *window);
+static bool _lvkw_wayland_check_presentation_support(LVKW_Context_WL *ctx);
+static void _lvkw_wayland_request_presentation_feedback(LVKW_Window_WL *window);
+static void _lvkw_wayland_cancel_presentation_feedback(LVKW_Window_WL *window);
 
 LVKW_Status lvkw_ctx_createWindow_WL(LVKW_Context *ctx_handle,
                                      const LVKW_WindowCreateInfo *create_info,
@@ -49,6 +55,7 @@ LVKW_Status lvkw_ctx_createWindow_WL(LVKW_Context *ctx_handle,
   *out_window_handle = NULL;
 
   LVKW_Context_WL *ctx = (LVKW_Context_WL *)ctx_handle;
+  LVKW_METRICS_WINDOW_CREATE_BEGIN(&ctx->linux_base.base);
 
   LVKW_Window_WL *window = (LVKW_Window_WL *)lvkw_context_alloc(&ctx->linux_base.base, sizeof(LVKW_Window_WL));
   if (!window) {
@@ -80,6 +87,9 @@ LVKW_Status lvkw_ctx_createWindow_WL(LVKW_Context *ctx_handle,
   window->is_decorated = create_info->attributes.decorated;
   window->accept_dnd = create_info->attributes.accept_dnd;
   window->primary_selection = create_info->attributes.primary_selection;
+  window->frame_events = create_info->attributes.frame_events;
+  window->presentation_feedback = create_info->attributes.presentation_feedback &&
+                                  _lvkw_wayland_check_presentation_support(ctx);
   window->text_input_type = create_info->attributes.text_input_type;
   window->text_input_rect = create_info->attributes.text_input_rect;
 
@@ -111,12 +121,21 @@ LVKW_Status lvkw_ctx_createWindow_WL(LVKW_Context *ctx_handle,
   _lvkw_wayland_update_opaque_region(window);
   _lvkw_wnd_setCursorMode_WL((LVKW_Window *)window, create_info->attributes.cursor_mode);
 
+  // Rides along with the initial commit; it fires once the surface is first presented.
+  if (window->frame_events || window->presentation_feedback) _lvkw_wayland_request_frame(window);
+  if (window->presentation_feedback) _lvkw_wayland_request_presentation_feedback(window);
+
   lvkw_wl_surface_commit(ctx, window->wl.surface);
   _lvkw_wayland_check_error(ctx);
   if (ctx->linux_base.base.pub.flags & LVKW_CONTEXT_STATE_LOST) return LVKW_ERROR_CONTEXT_LOST;
 
   // Add to context window list
-  _lvkw_window_list_add(&ctx->linux_base.base, &window->base);
+  if (!_lvkw_window_list_add(&ctx->linux_base.base, &window->base, (uintptr_t)window->wl.surface)) {
+    lvkw_wnd_destroy_WL((LVKW_Window *)window);
+    return LVKW_ERROR;
+  }
+
+  LVKW_METRICS_WINDOW_CREATE_END(&ctx->linux_base.base, &window->base);
 
   *out_window_handle = (LVKW_Window *)window;
   return LVKW_SUCCESS;
@@ -129,6 +148,7 @@ LVKW_Status lvkw_wnd_destroy_WL(LVKW_Window *window_handle) {
   LVKW_Context_WL *ctx = (LVKW_Context_WL *)window->base.prv.ctx_base;
 
   if (ctx->input.keyboard_focus == window) {
+    _lvkw_wayland_key_repeat_stop(ctx);
     _lvkw_wayland_sync_text_input_state(ctx, NULL);
     ctx->input.keyboard_focus = NULL;
   }
@@ -137,6 +157,9 @@ LVKW_Status lvkw_wnd_destroy_WL(LVKW_Window *window_handle) {
     ctx->input.pointer_focus = NULL;
   }
 
+  _lvkw_wayland_touch_forget_window(ctx, window);
+  _lvkw_wayland_pen_forget_window(ctx, window);
+
   if (ctx->input.dnd.window == window) {
     _lvkw_wayland_dnd_reset(ctx, true);
   }
@@ -173,6 +196,9 @@ LVKW_Status lvkw_wnd_destroy_WL(LVKW_Window *window_handle) {
     window->input.locked = NULL;
   }
 
+  _lvkw_wayland_cancel_presentation_feedback(window);
+  _lvkw_wayland_cancel_frame(window);
+
   if (window->decor_mode != LVKW_WAYLAND_DECORATION_MODE_CSD) {
     if (window->xdg.toplevel) lvkw_xdg_toplevel_destroy(ctx, window->xdg.toplevel);
     if (window->xdg.surface) lvkw_xdg_surface_destroy(ctx, window->xdg.surface);
@@ -322,6 +348,37 @@ LVKW_Status lvkw_wnd_update_WL(LVKW_Window *window_handle, uint32_t field_mask,
     _lvkw_wayland_update_opaque_region(window);
   }
 
+  if (field_mask & LVKW_WINDOW_ATTR_FRAME_EVENTS) {
+    if (attributes->frame_events && !window->frame_events) {
+      window->frame_events = true;
+      _lvkw_wayland_request_frame(window);
+      // The app may be idle, waiting for that very event: don't wait for its next present.
+      if (window->base.pub.flags & LVKW_WINDOW_STATE_READY) {
+        lvkw_wl_surface_commit(ctx, window->wl.surface);
+      }
+    }
+    else if (!attributes->frame_events) {
+      window->frame_events = false;
+      if (!window->presentation_feedback) _lvkw_wayland_cancel_frame(window);
+    }
+  }
+
+  if (field_mask & LVKW_WINDOW_ATTR_PRESENTATION_FEEDBACK) {
+    if (attributes->presentation_feedback && !window->presentation_feedback) {
+      if (_lvkw_wayland_check_presentation_support(ctx)) {
+        // Both apply to the app's next present; no need to commit on its behalf.
+        window->presentation_feedback = true;
+        _lvkw_wayland_request_frame(window);
+        _lvkw_wayland_request_presentation_feedback(window);
+      }
+    }
+    else if (!attributes->presentation_feedback && window->presentation_feedback) {
+      window->presentation_feedback = false;
+      _lvkw_wayland_cancel_presentation_feedback(window);
+      if (!window->frame_events) _lvkw_wayland_cancel_frame(window);
+    }
+  }
+
   _lvkw_wayland_check_error(ctx);
   if (ctx->linux_base.base.pub.flags & LVKW_CONTEXT_STATE_LOST) return LVKW_ERROR_CONTEXT_LOST;
 
@@ -792,54 +849,209 @@ static void _wl_surface_handle_preferred_buffer_transform(void *data, struct wl_
   }
 }
 
-const struct wl_surface_listener _lvkw_wayland_surface_listener = {
-    .enter = _wl_surface_handle_enter,
-    .leave = _wl_surface_handle_leave,
-    .preferred_buffer_scale = _wl_surface_handle_preferred_buffer_scale,
-    .preferred_buffer_transform = _wl_surface_handle_preferred_buffer_transform};
+static void _wl_frame_callback_handle_done(void *data, struct wl_callback *callback,
+                                           uint32_t time_ms) {
+  LVKW_Window_WL *window = (LVKW_Window_WL *)data;
+  LVKW_WINDOW_ASSUME(data, window != NULL, "Window handle must not be NULL in frame callback handler");
 
-static void _xdg_surface_handle_configure(void *userData, struct xdg_surface *surface,
-                                          uint32_t serial) {
-  LVKW_Window_WL *window = (LVKW_Window_WL *)userData;
-  LVKW_WINDOW_ASSUME(userData, window != NULL,
-                  "Window handle must not be NULL in xdg surface configure handler");
-  LVKW_WINDOW_ASSUME(userData, surface != NULL, "XDG surface must not be NULL in configure handler");
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)window->base.prv.ctx_base;
+  lvkw_wl_callback_destroy(ctx, callback);
+  if (window->wl.frame_callback == callback) window->wl.frame_callback = NULL;
+
+  if (!window->frame_events && !window->presentation_feedback) return;
+
+  // Re-arm before dispatching: the request is double-buffered surface state, so it
+  // applies to whatever the app commits next, typically the frame it is about to render.
+  _lvkw_wayland_request_frame(window);
+  if (window->presentation_feedback) _lvkw_wayland_request_presentation_feedback(window);
+
+  if (!window->frame_events) return;
+
+  uint64_t timestamp_ns = _lvkw_linux_event_time_ns(time_ms);
+  LVKW_Event evt = {0};
+  evt.frame.timestamp_ns = timestamp_ns;
+  _lvkw_dispatch_timed_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_FRAME, (LVKW_Window *)window,
+                             &evt, timestamp_ns);
+
+  LVKW_Event sync_evt = {0};
+  _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
+
+  ctx->frame_event_dispatched = true;
+}
+
+static const struct wl_callback_listener _lvkw_wayland_frame_listener = {
+    .done = _wl_frame_callback_handle_done,
+};
+
+static void _lvkw_wayland_request_frame(LVKW_Window_WL *window) {
+  if (window->wl.frame_callback) return;
 
   LVKW_Context_WL *ctx = (LVKW_Context_WL *)window->base.prv.ctx_base;
-  lvkw_xdg_surface_ack_configure(ctx, surface, serial);
+  window->wl.frame_callback = lvkw_wl_surface_frame(ctx, window->wl.surface);
+  if (window->wl.frame_callback) {
+    lvkw_wl_callback_add_listener(ctx, window->wl.frame_callback, &_lvkw_wayland_frame_listener,
+                                  window);
+  }
+}
 
-  if (!(window->base.pub.flags & LVKW_WINDOW_STATE_READY)) {
-    window->base.pub.flags |= LVKW_WINDOW_STATE_READY;
-    LVKW_Event evt = {0};
-    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_WINDOW_READY,
-                          (LVKW_Window *)window, &evt);
-    
-    LVKW_Event sync_evt = {0};
-    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
+static void _lvkw_wayland_cancel_frame(LVKW_Window_WL *window) {
+  if (!window->wl.frame_callback) return;
+
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)window->base.prv.ctx_base;
+  lvkw_wl_callback_destroy(ctx, window->wl.frame_callback);
+  window->wl.frame_callback = NULL;
+}
+
+/* wp_presentation_feedback */
+
+static bool _lvkw_wayland_check_presentation_support(LVKW_Context_WL *ctx) {
+  if (ctx->protocols.opt.wp_presentation) return true;
+
+  LVKW_REPORT_CTX_DIAGNOSTIC(&ctx->linux_base.base, LVKW_DIAGNOSTIC_FEATURE_UNSUPPORTED,
+                             "Presentation feedback requires wp_presentation");
+  return false;
+}
+
+// The compositor picks the presentation clock. It is CLOCK_MONOTONIC in practice, but
+// rebase through the current time of both clocks when it isn't.
+static uint64_t _lvkw_wayland_presentation_time_ns(LVKW_Context_WL *ctx, uint64_t sec,
+                                                   uint32_t nsec) {
+  const uint64_t time_ns = sec * 1000000000ull + nsec;
+  if (ctx->presentation_clock_id == CLOCK_MONOTONIC) return time_ns;
+
+  const uint64_t now_ns = _lvkw_get_timestamp_ns();
+  struct timespec ts;
+  if (clock_gettime((clockid_t)ctx->presentation_clock_id, &ts) != 0) return now_ns;
+
+  const uint64_t clock_now_ns = (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+  const uint64_t age_ns = clock_now_ns > time_ns ? clock_now_ns - time_ns : 0;
+  return now_ns > age_ns ? now_ns - age_ns : 0;
+}
+
+static void _lvkw_wayland_release_presentation_feedback(LVKW_Window_WL *window,
+                                                        struct wp_presentation_feedback *feedback) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)window->base.prv.ctx_base;
+  for (uint32_t i = 0; i < LVKW_WAYLAND_MAX_PRESENTATION_FEEDBACKS; ++i) {
+    if (window->ext.presentation_feedbacks[i] == feedback) {
+      window->ext.presentation_feedbacks[i] = NULL;
+      break;
+    }
   }
+  lvkw_wp_presentation_feedback_destroy(ctx, feedback);
 }
 
-const struct xdg_surface_listener _lvkw_wayland_xdg_surface_listener = {
-    .configure = _xdg_surface_handle_configure};
+static void _wp_presentation_feedback_handle_sync_output(
+    void *data, struct wp_presentation_feedback *feedback, struct wl_output *output) {
+  (void)data;
+  (void)feedback;
+  (void)output;
+}
 
-static void _xdg_toplevel_handle_configure(void *userData, struct xdg_toplevel *toplevel,
-                                           int32_t width, int32_t height, struct wl_array *states) {
-  LVKW_Window_WL *window = (LVKW_Window_WL *)userData;
-  LVKW_WINDOW_ASSUME(userData, window != NULL,
-                  "Window handle must not be NULL in xdg toplevel configure handler");
-  LVKW_WINDOW_ASSUME(userData, toplevel != NULL, "XDG toplevel must not be NULL in configure handler");
+static void _wp_presentation_feedback_handle_presented(
+    void *data, struct wp_presentation_feedback *feedback, uint32_t tv_sec_hi,
+    uint32_t tv_sec_lo, uint32_t tv_nsec, uint32_t refresh, uint32_t seq_hi, uint32_t seq_lo,
+    uint32_t flags) {
+  LVKW_Window_WL *window = (LVKW_Window_WL *)data;
+  LVKW_WINDOW_ASSUME(data, window != NULL,
+                     "Window handle must not be NULL in presentation feedback handler");
 
-  bool maximized = false;
-  bool fullscreen = false;
-  bool focused = false;
-  uint32_t *state;
-  wl_array_for_each(state, states) {
-    if (*state == XDG_TOPLEVEL_STATE_MAXIMIZED) maximized = true;
-    if (*state == XDG_TOPLEVEL_STATE_FULLSCREEN) fullscreen = true;
-    if (*state == XDG_TOPLEVEL_STATE_ACTIVATED) focused = true;
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)window->base.prv.ctx_base;
+  _lvkw_wayland_release_presentation_feedback(window, feedback);
+
+  const uint64_t present_ns = _lvkw_wayland_presentation_time_ns(
+      ctx, ((uint64_t)tv_sec_hi << 32) | tv_sec_lo, tv_nsec);
+  const uint64_t sequence = ((uint64_t)seq_hi << 32) | seq_lo;
+  LVKW_METRICS_PRESENTED(&ctx->linux_base.base, &window->presentation_history, present_ns,
+                         refresh, sequence);
+
+  LVKW_Event evt = {0};
+  evt.presentation.present_ns = present_ns;
+  evt.presentation.sequence = sequence;
+  evt.presentation.refresh_ns = refresh;
+  if (flags & WP_PRESENTATION_FEEDBACK_KIND_VSYNC) evt.presentation.flags |= LVKW_PRESENTATION_VSYNC;
+  if (flags & WP_PRESENTATION_FEEDBACK_KIND_HW_CLOCK) {
+    evt.presentation.flags |= LVKW_PRESENTATION_HW_CLOCK;
+  }
+  if (flags & WP_PRESENTATION_FEEDBACK_KIND_HW_COMPLETION) {
+    evt.presentation.flags |= LVKW_PRESENTATION_HW_COMPLETION;
+  }
+  if (flags & WP_PRESENTATION_FEEDBACK_KIND_ZERO_COPY) {
+    evt.presentation.flags |= LVKW_PRESENTATION_ZERO_COPY;
+  }
+  _lvkw_dispatch_timed_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_PRESENTATION,
+                             (LVKW_Window *)window, &evt, present_ns);
+
+  LVKW_Event sync_evt = {0};
+  _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
+}
+
+static void _wp_presentation_feedback_handle_discarded(void *data,
+                                                       struct wp_presentation_feedback *feedback) {
+  LVKW_Window_WL *window = (LVKW_Window_WL *)data;
+  LVKW_WINDOW_ASSUME(data, window != NULL,
+                     "Window handle must not be NULL in presentation feedback handler");
+
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)window->base.prv.ctx_base;
+  _lvkw_wayland_release_presentation_feedback(window, feedback);
+  LVKW_METRICS_DISCARDED(&ctx->linux_base.base);
+
+  LVKW_Event evt = {0};
+  evt.presentation.flags = LVKW_PRESENTATION_DISCARDED;
+  _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_PRESENTATION, (LVKW_Window *)window,
+                       &evt);
+
+  LVKW_Event sync_evt = {0};
+  _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
+}
+
+static const struct wp_presentation_feedback_listener _lvkw_wayland_presentation_feedback_listener = {
+    .sync_output = _wp_presentation_feedback_handle_sync_output,
+    .presented = _wp_presentation_feedback_handle_presented,
+    .discarded = _wp_presentation_feedback_handle_discarded,
+};
+
+static void _lvkw_wayland_request_presentation_feedback(LVKW_Window_WL *window) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)window->base.prv.ctx_base;
+
+  // With every slot busy, the compositor is lagging behind: skip this commit.
+  for (uint32_t i = 0; i < LVKW_WAYLAND_MAX_PRESENTATION_FEEDBACKS; ++i) {
+    if (window->ext.presentation_feedbacks[i]) continue;
+
+    struct wp_presentation_feedback *feedback =
+        lvkw_wp_presentation_feedback(ctx, ctx->protocols.opt.wp_presentation, window->wl.surface);
+    if (feedback) {
+      lvkw_wp_presentation_feedback_add_listener(
+          ctx, feedback, &_lvkw_wayland_presentation_feedback_listener, window);
+      window->ext.presentation_feedbacks[i] = feedback;
+    }
+    return;
   }
+}
 
+static void _lvkw_wayland_cancel_presentation_feedback(LVKW_Window_WL *window) {
   LVKW_Context_WL *ctx = (LVKW_Context_WL *)window->base.prv.ctx_base;
+  for (uint32_t i = 0; i < LVKW_WAYLAND_MAX_PRESENTATION_FEEDBACKS; ++i) {
+    if (!window->ext.presentation_feedbacks[i]) continue;
+    lvkw_wp_presentation_feedback_destroy(ctx, window->ext.presentation_feedbacks[i]);
+    window->ext.presentation_feedbacks[i] = NULL;
+  }
+#ifdef LVKW_GATHER_METRICS
+  memset(&window->presentation_history, 0, sizeof(window->presentation_history));
+#endif
+}
+
+const struct wl_surface_listener _lvkw_wayland_surface_listener = {
+    .enter = _wl_surface_handle_enter,
+    .leave = _wl_surface_handle_leave,
+    .preferred_buffer_scale = _wl_surface_handle_preferred_buffer_scale,
+    .preferred_buffer_transform = _wl_surface_handle_preferred_buffer_transform};
+
+// Dispatches MAXIMIZED/FOCUS for states that changed, without a trailing SYNC.
+// Returns true if anything was dispatched.
+static bool _lvkw_wayland_apply_window_states(LVKW_Window_WL *window, bool maximized,
+                                              bool fullscreen, bool focused) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)window->base.prv.ctx_base;
+  bool dispatched = false;
 
   if (window->is_maximized != maximized) {
     window->is_maximized = maximized;
@@ -852,12 +1064,10 @@ static void _xdg_toplevel_handle_configure(void *userData, struct xdg_toplevel *
     evt.maximized.maximized = maximized;
     _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_WINDOW_MAXIMIZED,
                           (LVKW_Window *)window, &evt);
-    
-    LVKW_Event sync_evt = {0};
-    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
+    dispatched = true;
   }
 
-  if (window->is_fullscreen != fullscreen) window->is_fullscreen = fullscreen;
+  window->is_fullscreen = fullscreen;
   if (fullscreen)
     window->base.pub.flags |= LVKW_WINDOW_STATE_FULLSCREEN;
   else
@@ -874,11 +1084,24 @@ static void _xdg_toplevel_handle_configure(void *userData, struct xdg_toplevel *
     evt.focus.focused = focused;
     _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_FOCUS,
                           (LVKW_Window *)window, &evt);
-    
-    LVKW_Event sync_evt = {0};
-    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
+    dispatched = true;
   }
 
+  return dispatched;
+}
+
+// Applies the state staged by the latest xdg_toplevel.configure, without a trailing SYNC.
+// Returns true if anything was dispatched.
+static bool _lvkw_wayland_apply_toplevel_configure(LVKW_Window_WL *window) {
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)window->base.prv.ctx_base;
+  const int32_t width = window->configure.width;
+  const int32_t height = window->configure.height;
+  const bool maximized = window->configure.maximized;
+  const bool fullscreen = window->configure.fullscreen;
+
+  bool dispatched =
+      _lvkw_wayland_apply_window_states(window, maximized, fullscreen, window->configure.focused);
+
   bool size_changed = false;
   if (width != 0 || height != 0) {
     uint32_t pending_width = width > 0 ? (uint32_t)width : (uint32_t)window->size.x;
@@ -900,12 +1123,70 @@ static void _xdg_toplevel_handle_configure(void *userData, struct xdg_toplevel *
     LVKW_Event evt = _lvkw_wayland_make_window_resized_event(window);
     _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_WINDOW_RESIZED,
                           (LVKW_Window *)window, &evt);
-    
+    dispatched = true;
+  }
+
+  return dispatched;
+}
+
+static void _xdg_surface_handle_configure(void *userData, struct xdg_surface *surface,
+                                          uint32_t serial) {
+  LVKW_Window_WL *window = (LVKW_Window_WL *)userData;
+  LVKW_WINDOW_ASSUME(userData, window != NULL,
+                  "Window handle must not be NULL in xdg surface configure handler");
+  LVKW_WINDOW_ASSUME(userData, surface != NULL, "XDG surface must not be NULL in configure handler");
+
+  LVKW_Context_WL *ctx = (LVKW_Context_WL *)window->base.prv.ctx_base;
+  lvkw_xdg_surface_ack_configure(ctx, surface, serial);
+
+  // The whole configure sequence lands as a single event group, however many
+  // xdg_toplevel.configure preceded it.
+  bool dispatched = false;
+  if (window->configure.pending) {
+    window->configure.pending = false;
+    dispatched = _lvkw_wayland_apply_toplevel_configure(window);
+  }
+
+  if (!(window->base.pub.flags & LVKW_WINDOW_STATE_READY)) {
+    window->base.pub.flags |= LVKW_WINDOW_STATE_READY;
+    LVKW_Event evt = {0};
+    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_WINDOW_READY,
+                          (LVKW_Window *)window, &evt);
+    dispatched = true;
+  }
+
+  if (dispatched) {
     LVKW_Event sync_evt = {0};
     _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
   }
 }
 
+const struct xdg_surface_listener _lvkw_wayland_xdg_surface_listener = {
+    .configure = _xdg_surface_handle_configure};
+
+static void _xdg_toplevel_handle_configure(void *userData, struct xdg_toplevel *toplevel,
+                                           int32_t width, int32_t height, struct wl_array *states) {
+  LVKW_Window_WL *window = (LVKW_Window_WL *)userData;
+  LVKW_WINDOW_ASSUME(userData, window != NULL,
+                  "Window handle must not be NULL in xdg toplevel configure handler");
+  LVKW_WINDOW_ASSUME(userData, toplevel != NULL, "XDG toplevel must not be NULL in configure handler");
+
+  // Only staged: the sequence is applied atomically by the xdg_surface.configure that
+  // closes it, and a later xdg_toplevel.configure supersedes this one.
+  window->configure.width = width;
+  window->configure.height = height;
+  window->configure.maximized = false;
+  window->configure.fullscreen = false;
+  window->configure.focused = false;
+  uint32_t *state;
+  wl_array_for_each(state, states) {
+    if (*state == XDG_TOPLEVEL_STATE_MAXIMIZED) window->configure.maximized = true;
+    if (*state == XDG_TOPLEVEL_STATE_FULLSCREEN) window->configure.fullscreen = true;
+    if (*state == XDG_TOPLEVEL_STATE_ACTIVATED) window->configure.focused = true;
+  }
+  window->configure.pending = true;
+}
+
 static void _xdg_toplevel_handle_close(void *userData, struct xdg_toplevel *toplevel) {
   LVKW_Window_WL *window = (LVKW_Window_WL *)userData;
   LVKW_WINDOW_ASSUME(userData, window != NULL,
@@ -968,43 +1249,8 @@ static void _libdecor_frame_handle_configure(struct libdecor_frame *frame,
     if (state_flags & LIBDECOR_WINDOW_STATE_ACTIVE) focused = true;
   }
 
-  if (window->is_maximized != maximized) {
-    window->is_maximized = maximized;
-    if (maximized)
-      window->base.pub.flags |= LVKW_WINDOW_STATE_MAXIMIZED;
-    else
-      window->base.pub.flags &= (uint32_t)~LVKW_WINDOW_STATE_MAXIMIZED;
-
-    LVKW_Event evt = {0};
-    evt.maximized.maximized = maximized;
-    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_WINDOW_MAXIMIZED,
-                          (LVKW_Window *)window, &evt);
-    
-    LVKW_Event sync_evt = {0};
-    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
-  }
-
-  if (window->is_fullscreen != fullscreen) window->is_fullscreen = fullscreen;
-  if (fullscreen)
-    window->base.pub.flags |= LVKW_WINDOW_STATE_FULLSCREEN;
-  else
-    window->base.pub.flags &= (uint32_t)~LVKW_WINDOW_STATE_FULLSCREEN;
-
-  bool old_focused = (window->base.pub.flags & LVKW_WINDOW_STATE_FOCUSED) != 0;
-  if (old_focused != focused) {
-    if (focused)
-      window->base.pub.flags |= LVKW_WINDOW_STATE_FOCUSED;
-    else
-      window->base.pub.flags &= (uint32_t)~LVKW_WINDOW_STATE_FOCUSED;
-
-    LVKW_Event evt = {0};
-    evt.focus.focused = focused;
-    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_FOCUS,
-                          (LVKW_Window *)window, &evt);
-    
-    LVKW_Event sync_evt = {0};
-    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
-  }
+  // libdecor hands over a complete configuration: emit it as a single event group.
+  _lvkw_wayland_apply_window_states(window, maximized, fullscreen, focused);
 
   if (!lvkw_libdecor_configuration_get_content_size(ctx, configuration, frame, &width, &height)) {
     width = (int)window->size.x;
@@ -1034,9 +1280,6 @@ static void _libdecor_frame_handle_configure(struct libdecor_frame *frame,
     LVKW_Event evt = {0};
     _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_WINDOW_READY,
                           (LVKW_Window *)window, &evt);
-    
-    LVKW_Event sync_evt = {0};
-    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
   }
 
   LVKW_Event evt = _lvkw_wayland_make_window_resized_event(window);
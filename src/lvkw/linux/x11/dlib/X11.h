@@ -15,15 +15,11 @@
   LVKW_LIB_FN(CloseDisplay, XCloseDisplay)                   \
   LVKW_LIB_FN(QueryExtension, XQueryExtension)               \
   LVKW_LIB_FN(InternAtom, XInternAtom)                       \
-  LVKW_LIB_FN(rmUniqueQuark, XrmUniqueQuark)                 \
+  LVKW_LIB_FN(InternAtoms, XInternAtoms)                     \
   LVKW_LIB_FN(CreateBitmapFromData, XCreateBitmapFromData)   \
   LVKW_LIB_FN(CreatePixmapCursor, XCreatePixmapCursor)       \
   LVKW_LIB_FN(FreePixmap, XFreePixmap)                       \
   LVKW_LIB_FN(FreeCursor, XFreeCursor)                       \
-  LVKW_LIB_FN(Pending, XPending)                             \
-  LVKW_LIB_FN(NextEvent, XNextEvent)                         \
-  LVKW_LIB_FN(PeekEvent, XPeekEvent)                         \
-  LVKW_LIB_FN(FindContext, XFindContext)                     \
   LVKW_LIB_FN(LookupKeysym, XLookupKeysym)                   \
   LVKW_LIB_FN(WarpPointer, XWarpPointer)                     \
   LVKW_LIB_FN(CreateSimpleWindow, XCreateSimpleWindow)       \
@@ -38,13 +34,9 @@
   LVKW_LIB_FN(SetClassHint, XSetClassHint)                   \
   LVKW_LIB_FN(AllocClassHint, XAllocClassHint)               \
   LVKW_LIB_FN(Free, XFree)                                   \
-  LVKW_LIB_FN(SaveContext, XSaveContext)                     \
   LVKW_LIB_FN(MapWindow, XMapWindow)                         \
-  LVKW_LIB_FN(DeleteContext, XDeleteContext)                 \
   LVKW_LIB_FN(DestroyWindow, XDestroyWindow)                 \
   LVKW_LIB_FN(SendEvent, XSendEvent)                         \
-  LVKW_LIB_FN(GetEventData, XGetEventData)                   \
-  LVKW_LIB_FN(FreeEventData, XFreeEventData)                 \
   LVKW_LIB_FN(GrabPointer, XGrabPointer)                     \
   LVKW_LIB_FN(UngrabPointer, XUngrabPointer)                 \
   LVKW_LIB_FN(UndefineCursor, XUndefineCursor)               \
@@ -63,6 +55,7 @@
   LVKW_LIB_FN(rmDestroyDatabase, XrmDestroyDatabase)         \
   LVKW_LIB_FN(rmInitialize, XrmInitialize)                   \
   LVKW_LIB_FN(Sync, XSync)                                   \
+  LVKW_LIB_FN(Flush, XFlush)                                 \
   LVKW_LIB_FN(ResizeWindow, XResizeWindow)                   \
   LVKW_LIB_FN(AllocSizeHints, XAllocSizeHints)               \
   LVKW_LIB_FN(SetWMNormalHints, XSetWMNormalHints)           \
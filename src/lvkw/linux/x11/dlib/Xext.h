@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: Zlib
+// Copyright (c) 2026 François Chabot
+
+#ifndef LVKW_X11_DLIB_XEXT_H_INCLUDED
+#define LVKW_X11_DLIB_XEXT_H_INCLUDED
+
+#include <X11/extensions/sync.h>
+
+#include "internal.h"
+
+#define LVKW_XEXT_FUNCTIONS_TABLE                                 \
+  LVKW_LIB_FN(SyncInitialize, XSyncInitialize)                    \
+  LVKW_LIB_FN(SyncListSystemCounters, XSyncListSystemCounters)    \
+  LVKW_LIB_FN(SyncFreeSystemCounterList, XSyncFreeSystemCounterList) \
+  LVKW_LIB_FN(SyncCreateAlarm, XSyncCreateAlarm)                  \
+  LVKW_LIB_FN(SyncChangeAlarm, XSyncChangeAlarm)                  \
+  LVKW_LIB_FN(SyncDestroyAlarm, XSyncDestroyAlarm)                \
+  LVKW_LIB_FN(SyncCreateCounter, XSyncCreateCounter)              \
+  LVKW_LIB_FN(SyncSetCounter, XSyncSetCounter)                    \
+  LVKW_LIB_FN(SyncDestroyCounter, XSyncDestroyCounter)
+
+typedef struct LVKW_Lib_Xext {
+  LVKW_External_Lib_Base base;
+#define LVKW_LIB_FN(name, sym) __typeof__(sym) *name;
+  LVKW_XEXT_FUNCTIONS_TABLE
+#undef LVKW_LIB_FN
+} LVKW_Lib_Xext;
+
+#endif
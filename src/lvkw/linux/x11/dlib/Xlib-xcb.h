@@ -8,11 +8,14 @@
 
 #include "internal.h"
 
-#define LVKW_XLIB_XCB_FUNCTIONS_TABLE LVKW_LIB_FN(GetXCBConnection, XGetXCBConnection)
+#define LVKW_XLIB_XCB_FUNCTIONS_TABLE                   \
+  LVKW_LIB_FN(GetXCBConnection, XGetXCBConnection) \
+  LVKW_LIB_FN(SetEventQueueOwner, XSetEventQueueOwner)
 
 typedef struct LVKW_Lib_X11_XCB {
   LVKW_External_Lib_Base base;
   xcb_connection_t *(*GetXCBConnection)(Display *dpy);
+  void (*SetEventQueueOwner)(Display *dpy, enum XEventQueueOwner owner);
 } LVKW_Lib_X11_XCB;
 
 #endif
\ No newline at end of file
@@ -9,9 +9,11 @@
 
 #include "dlib/X11.h"
 #include "dlib/Xcursor.h"
+#include "dlib/Xext.h"
 #include "dlib/Xi.h"
 #include "dlib/Xlib-xcb.h"
 #include "dlib/Xss.h"
+#include "dlib/xcb.h"
 #include "dlib/linux_loader.h"
 #include "internal.h"
 
@@ -82,14 +84,44 @@ static bool x11_xcb_load(struct LVKW_Context_Base* ctx, LVKW_Lib_X11_XCB* lib) {
     return false;
   }
 
-  lib->GetXCBConnection = dlsym(lib->base.handle, "XGetXCBConnection");
-  if (!lib->GetXCBConnection) {
-    _set_diagnostic(ctx, "dlsym(XGetXCBConnection) failed");
+  bool functions_ok = true;
+
+#define LVKW_LIB_FN(name, sym)                             \
+  lib->name = dlsym(lib->base.handle, #sym);               \
+  if (!lib->name) {                                        \
+    _set_diagnostic(ctx, "dlsym(" #sym ") failed");        \
+    functions_ok = false;                                  \
+  }
+  LVKW_XLIB_XCB_FUNCTIONS_TABLE
+#undef LVKW_LIB_FN
+
+  if (!functions_ok) {
     _x11_unload_lib_base(&lib->base);
+  }
+  return lib->base.available;
+}
+
+static bool xcb_load(struct LVKW_Context_Base* ctx, LVKW_Lib_Xcb* lib) {
+  if (lib->base.available) return true;
+
+  if (!_x11_load_lib_base(ctx, "libxcb.so.1", &lib->base)) {
     return false;
   }
+  bool functions_ok = true;
 
-  return true;
+#define LVKW_LIB_FN(name, sym)                                           \
+  lib->name = (__typeof__(sym)*)dlsym(lib->base.handle, #sym);           \
+  if (!lib->name) {                                                      \
+    _set_diagnostic(ctx, "dlsym(" #sym ") failed");                      \
+    functions_ok = false;                                                \
+  }
+  LVKW_XCB_FUNCTIONS_TABLE
+#undef LVKW_LIB_FN
+
+  if (!functions_ok) {
+    _x11_unload_lib_base(&lib->base);
+  }
+  return lib->base.available;
 }
 
 static bool xcursor_load(struct LVKW_Context_Base* ctx, LVKW_Lib_Xcursor* lib) {
@@ -161,6 +193,29 @@ static bool xi_load(struct LVKW_Context_Base* ctx, LVKW_Lib_Xi* lib) {
   return lib->base.available;
 }
 
+static bool xext_load(struct LVKW_Context_Base* ctx, LVKW_Lib_Xext* lib) {
+  if (lib->base.available) return true;
+
+  if (!_x11_load_lib_base(ctx, "libXext.so.6", &lib->base)) {
+    return false;
+  }
+  bool functions_ok = true;
+
+#define LVKW_LIB_FN(name, sym)                                           \
+  lib->name = (__typeof__(sym)*)dlsym(lib->base.handle, #sym);           \
+  if (!lib->name) {                                                      \
+    _set_diagnostic(ctx, "dlsym(" #sym ") failed");                      \
+    functions_ok = false;                                                \
+  }
+  LVKW_XEXT_FUNCTIONS_TABLE
+#undef LVKW_LIB_FN
+
+  if (!functions_ok) {
+    _x11_unload_lib_base(&lib->base);
+  }
+  return lib->base.available;
+}
+
 static bool xrandr_load(struct LVKW_Context_Base* ctx, LVKW_Lib_Xrandr* lib) {
   if (lib->base.available) return true;
 
@@ -187,29 +242,38 @@ static bool xrandr_load(struct LVKW_Context_Base* ctx, LVKW_Lib_Xrandr* lib) {
 #pragma GCC diagnostic pop
 
 bool lvkw_load_x11_symbols(struct LVKW_Context_Base* ctx, LVKW_Lib_X11* x11,
-                           LVKW_Lib_X11_XCB* x11_xcb, LVKW_Lib_Xcursor* xcursor,
-                           LVKW_Lib_Xrandr* xrandr, LVKW_Lib_Xss* xss, LVKW_Lib_Xi* xi,
-                           LVKW_Lib_Xkb* xkb) {
+                           LVKW_Lib_X11_XCB* x11_xcb, LVKW_Lib_Xcb* xcb, LVKW_Lib_Xcursor* xcursor,
+                           LVKW_Lib_Xrandr* xrandr, LVKW_Lib_Xss* xss, LVKW_Lib_Xext* xext,
+                           LVKW_Lib_Xi* xi, LVKW_Lib_Xkb* xkb) {
   if (!x11_load(ctx, x11)) return false;
 
-  x11_xcb_load(ctx, x11_xcb);
+  // The event loop reads straight from the xcb connection underneath Xlib.
+  if (!x11_xcb_load(ctx, x11_xcb) || !xcb_load(ctx, xcb)) {
+    _x11_unload_lib_base(&x11_xcb->base);
+    _x11_unload_lib_base(&x11->base);
+    return false;
+  }
   xcursor_load(ctx, xcursor);
   xrandr_load(ctx, xrandr);
   xss_load(ctx, xss);
+  xext_load(ctx, xext);
   xi_load(ctx, xi);
   lvkw_linux_xkb_load(ctx, xkb);
 
   return true;
 }
 
-void lvkw_unload_x11_symbols(LVKW_Lib_X11* x11, LVKW_Lib_X11_XCB* x11_xcb, LVKW_Lib_Xcursor* xcursor,
-                             LVKW_Lib_Xrandr* xrandr, LVKW_Lib_Xss* xss, LVKW_Lib_Xi* xi,
-                             LVKW_Lib_Xkb* xkb) {
+void lvkw_unload_x11_symbols(LVKW_Lib_X11* x11, LVKW_Lib_X11_XCB* x11_xcb, LVKW_Lib_Xcb* xcb,
+                             LVKW_Lib_Xcursor* xcursor,
+                             LVKW_Lib_Xrandr* xrandr, LVKW_Lib_Xss* xss, LVKW_Lib_Xext* xext,
+                             LVKW_Lib_Xi* xi, LVKW_Lib_Xkb* xkb) {
   lvkw_linux_xkb_unload(xkb);
   _x11_unload_lib_base(&xi->base);
+  _x11_unload_lib_base(&xext->base);
   _x11_unload_lib_base(&xss->base);
   _x11_unload_lib_base(&xrandr->base);
   _x11_unload_lib_base(&xcursor->base);
+  _x11_unload_lib_base(&xcb->base);
   _x11_unload_lib_base(&x11_xcb->base);
   _x11_unload_lib_base(&x11->base);
 }
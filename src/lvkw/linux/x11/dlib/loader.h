@@ -7,21 +7,24 @@
 
 #include "dlib/X11.h"
 #include "dlib/Xcursor.h"
+#include "dlib/Xext.h"
 #include "dlib/Xi.h"
 #include "dlib/Xlib-xcb.h"
 #include "dlib/Xrandr.h"
 #include "dlib/Xss.h"
+#include "dlib/xcb.h"
 #include "dlib/xkbcommon.h"
 
 struct LVKW_Context_Base;
 
 bool lvkw_load_x11_symbols(struct LVKW_Context_Base *ctx, LVKW_Lib_X11 *x11,
-                           LVKW_Lib_X11_XCB *x11_xcb, LVKW_Lib_Xcursor *xcursor,
-                           LVKW_Lib_Xrandr *xrandr, LVKW_Lib_Xss *xss, LVKW_Lib_Xi *xi,
-                           LVKW_Lib_Xkb *xkb);
+                           LVKW_Lib_X11_XCB *x11_xcb, LVKW_Lib_Xcb *xcb, LVKW_Lib_Xcursor *xcursor,
+                           LVKW_Lib_Xrandr *xrandr, LVKW_Lib_Xss *xss, LVKW_Lib_Xext *xext,
+                           LVKW_Lib_Xi *xi, LVKW_Lib_Xkb *xkb);
 
-void lvkw_unload_x11_symbols(LVKW_Lib_X11 *x11, LVKW_Lib_X11_XCB *x11_xcb, LVKW_Lib_Xcursor *xcursor,
-                             LVKW_Lib_Xrandr *xrandr, LVKW_Lib_Xss *xss, LVKW_Lib_Xi *xi,
-                             LVKW_Lib_Xkb *xkb);
+void lvkw_unload_x11_symbols(LVKW_Lib_X11 *x11, LVKW_Lib_X11_XCB *x11_xcb, LVKW_Lib_Xcb *xcb,
+                             LVKW_Lib_Xcursor *xcursor,
+                             LVKW_Lib_Xrandr *xrandr, LVKW_Lib_Xss *xss, LVKW_Lib_Xext *xext,
+                             LVKW_Lib_Xi *xi, LVKW_Lib_Xkb *xkb);
 
 #endif
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: Zlib
+// Copyright (c) 2026 François Chabot
+
+#ifndef LVKW_X11_DLIB_XCB_H_INCLUDED
+#define LVKW_X11_DLIB_XCB_H_INCLUDED
+
+#include <xcb/xcb.h>
+#include <xcb/xproto.h>
+
+#include "internal.h"
+
+#define LVKW_XCB_FUNCTIONS_TABLE                                   \
+  LVKW_LIB_FN(poll_for_event, xcb_poll_for_event)                  \
+  LVKW_LIB_FN(poll_for_queued_event, xcb_poll_for_queued_event)    \
+  LVKW_LIB_FN(connection_has_error, xcb_connection_has_error)      \
+  LVKW_LIB_FN(send_event, xcb_send_event)                          \
+  LVKW_LIB_FN(query_extension, xcb_query_extension)                \
+  LVKW_LIB_FN(query_extension_reply, xcb_query_extension_reply)    \
+  LVKW_LIB_FN(get_property, xcb_get_property)                      \
+  LVKW_LIB_FN(get_property_reply, xcb_get_property_reply)          \
+  LVKW_LIB_FN(get_property_value, xcb_get_property_value)          \
+  LVKW_LIB_FN(get_property_value_length, xcb_get_property_value_length)
+
+typedef struct LVKW_Lib_Xcb {
+  LVKW_External_Lib_Base base;
+#define LVKW_LIB_FN(name, sym) __typeof__(sym)* name;
+  LVKW_XCB_FUNCTIONS_TABLE
+#undef LVKW_LIB_FN
+} LVKW_Lib_Xcb;
+
+#endif
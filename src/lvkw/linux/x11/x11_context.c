@@ -38,6 +38,114 @@ static Cursor _lvkw_x11_create_hidden_cursor(LVKW_Context_X11 *ctx, Display *dis
   return cursor;
 }
 
+typedef enum LVKW_X11Extension {
+  LVKW_X11_EXT_RANDR,
+  LVKW_X11_EXT_SCREEN_SAVER,
+  LVKW_X11_EXT_INPUT,
+  LVKW_X11_EXT_SYNC,
+  LVKW_X11_EXT_COUNT,
+} LVKW_X11Extension;
+
+static const char *const _lvkw_x11_ext_names[LVKW_X11_EXT_COUNT] = {
+    [LVKW_X11_EXT_RANDR] = "RANDR",
+    [LVKW_X11_EXT_SCREEN_SAVER] = "MIT-SCREEN-SAVER",
+    [LVKW_X11_EXT_INPUT] = "XInputExtension",
+    [LVKW_X11_EXT_SYNC] = "SYNC",
+};
+
+// Idle and resume arrive as XSync alarm events on the server's IDLETIME counter, so nothing has
+// to poll XScreenSaver. The idle alarm is a comparison rather than a transition, so it also fires
+// right away for a user who is already idle.
+static void _lvkw_x11_init_idle_alarms(LVKW_Context_X11 *ctx) {
+  int counter_count = 0;
+  XSyncSystemCounter *counters = lvkw_XSyncListSystemCounters(ctx, ctx->display, &counter_count);
+  if (!counters) return;
+  XSyncCounter idletime = None;
+  for (int i = 0; i < counter_count; i++) {
+    if (strcmp(counters[i].name, "IDLETIME") == 0) {
+      idletime = counters[i].counter;
+      break;
+    }
+  }
+  lvkw_XSyncFreeSystemCounterList(ctx, counters);
+  if (idletime == None) return;
+
+  XSyncAlarmAttributes attrs;
+  memset(&attrs, 0, sizeof(attrs));
+  attrs.trigger.counter = idletime;
+  attrs.trigger.value_type = XSyncAbsolute;
+  attrs.trigger.test_type = XSyncPositiveComparison;
+  _XSyncIntsToValue(&attrs.trigger.wait_value, ctx->idle_timeout_ms, 0);
+  _XSyncIntToValue(&attrs.delta, 0);
+  attrs.events = True;
+  const unsigned long mask = XSyncCACounter | XSyncCAValueType | XSyncCAValue | XSyncCATestType |
+                             XSyncCADelta | XSyncCAEvents;
+  ctx->idle_alarm = lvkw_XSyncCreateAlarm(ctx, ctx->display, mask, &attrs);
+
+  attrs.trigger.test_type = XSyncNegativeTransition;
+  _XSyncIntsToValue(&attrs.trigger.wait_value, ctx->idle_timeout_ms - 1, 0);
+  ctx->resume_alarm = lvkw_XSyncCreateAlarm(ctx, ctx->display, mask, &attrs);
+
+  if (ctx->idle_alarm == None || ctx->resume_alarm == None) {
+    if (ctx->idle_alarm != None) lvkw_XSyncDestroyAlarm(ctx, ctx->display, ctx->idle_alarm);
+    if (ctx->resume_alarm != None) lvkw_XSyncDestroyAlarm(ctx, ctx->display, ctx->resume_alarm);
+    ctx->idle_alarm = None;
+    ctx->resume_alarm = None;
+  }
+}
+
+static void _lvkw_x11_intern_atoms(LVKW_Context_X11 *ctx) {
+  static const char *const names[] = {
+      "WM_PROTOCOLS",
+      "WM_DELETE_WINDOW",
+      "WM_TAKE_FOCUS",
+      "_NET_WM_STATE",
+      "_NET_WM_STATE_FULLSCREEN",
+      "_NET_WM_STATE_MAXIMIZED_VERT",
+      "_NET_WM_STATE_MAXIMIZED_HORZ",
+      "_NET_ACTIVE_WINDOW",
+      "_NET_WM_PING",
+      "_NET_WM_SYNC_REQUEST",
+      "_NET_WM_SYNC_REQUEST_COUNTER",
+      "_MOTIF_WM_HINTS",
+      "CLIPBOARD",
+      "TARGETS",
+      "UTF8_STRING",
+      "TEXT",
+      "LVKW_CLIPBOARD_DATA",
+      "INCR",
+      "XdndAware",
+  };
+  Atom *const targets[] = {
+      &ctx->wm_protocols,
+      &ctx->wm_delete_window,
+      &ctx->wm_take_focus,
+      &ctx->net_wm_state,
+      &ctx->net_wm_state_fullscreen,
+      &ctx->net_wm_state_maximized_vert,
+      &ctx->net_wm_state_maximized_horz,
+      &ctx->net_active_window,
+      &ctx->net_wm_ping,
+      &ctx->net_wm_sync_request,
+      &ctx->net_wm_sync_request_counter,
+      &ctx->motif_wm_hints,
+      &ctx->clipboard,
+      &ctx->targets,
+      &ctx->utf8_string,
+      &ctx->text_atom,
+      &ctx->clipboard_property,
+      &ctx->incr,
+      &ctx->xdnd_aware,
+  };
+  _Static_assert(sizeof(names) / sizeof(names[0]) == sizeof(targets) / sizeof(targets[0]),
+                 "atom name/target mismatch");
+  enum { ATOM_COUNT = sizeof(names) / sizeof(names[0]) };
+
+  Atom atoms[ATOM_COUNT] = {0};
+  lvkw_XInternAtoms(ctx, ctx->display, (char **)names, ATOM_COUNT, False, atoms);
+  for (int i = 0; i < ATOM_COUNT; i++) *targets[i] = atoms[i];
+}
+
 #ifdef LVKW_ENABLE_INTERNAL_CHECKS
 static int _lvkw_x11_diagnostic_handler(Display *display, XErrorEvent *event) {
   (void)display;
@@ -70,7 +178,134 @@ static double _lvkw_x11_get_scale(LVKW_Context_X11 *ctx) {
   return scale;
 }
 
+static bool _lvkw_x11_randr_id_listed(const XID *ids, uint32_t count, XID id) {
+  for (uint32_t i = 0; i < count; i++) {
+    if (ids[i] == id) return true;
+  }
+  return false;
+}
+
+static uint32_t _lvkw_x11_refresh_rate_mhz(const XRRModeInfo *mode) {
+  if (!mode->dotClock || !mode->hTotal || !mode->vTotal) return 60000;
+  return (uint32_t)((double)mode->dotClock / ((double)mode->hTotal * (double)mode->vTotal) * 1000.0);
+}
+
+// Re-reads one connected output. Returns false if it turned out not to be a usable monitor.
+static bool _lvkw_x11_refresh_output(LVKW_Context_X11 *ctx, XRRScreenResources *res, RROutput id,
+                                     LVKW_Monitor_X11 *monitor, RROutput primary) {
+  XRROutputInfo *output = lvkw_XRRGetOutputInfo(ctx, ctx->display, res, id);
+  if (!output || output->connection != RR_Connected || output->crtc == None) {
+    if (output) lvkw_XRRFreeOutputInfo(ctx, output);
+    return false;
+  }
+
+  XRRCrtcInfo *crtc = lvkw_XRRGetCrtcInfo(ctx, ctx->display, res, output->crtc);
+  if (!crtc) {
+    lvkw_XRRFreeOutputInfo(ctx, output);
+    return false;
+  }
+
+  // An output that comes back reuses its old, lost monitor and is announced as connected again.
+  bool is_new = monitor == NULL || (monitor->base.pub.flags & LVKW_MONITOR_STATE_LOST);
+  if (!monitor) {
+    monitor = (LVKW_Monitor_X11 *)lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_MONITORS, sizeof(LVKW_Monitor_X11));
+    if (!monitor) {
+      lvkw_XRRFreeCrtcInfo(ctx, crtc);
+      lvkw_XRRFreeOutputInfo(ctx, output);
+      return false;
+    }
+    memset(monitor, 0, sizeof(*monitor));
+    monitor->base.prv.ctx_base = &ctx->linux_base.base;
+    monitor->base.pub.context = &ctx->linux_base.base.pub;
+    monitor->output = id;
+    monitor->base.pub.name = _lvkw_string_cache_intern(&ctx->linux_base.base.prv.string_cache, &ctx->linux_base.base, output->name);
+
+    monitor->base.prv.next = ctx->linux_base.base.prv.monitor_list;
+    ctx->linux_base.base.prv.monitor_list = &monitor->base;
+  }
+
+  LVKW_VideoMode old_mode = monitor->base.pub.current_mode;
+  LVKW_Scalar old_scale = monitor->base.pub.scale;
+  LVKW_LogicalVec old_logical_size = monitor->base.pub.logical_size;
+
+  monitor->crtc = output->crtc;
+  monitor->seen = true;
+  monitor->base.pub.flags &= (uint32_t)~LVKW_MONITOR_STATE_LOST;
+  monitor->base.pub.is_primary = (id == primary);
+  monitor->base.pub.logical_position.x = crtc->x;
+  monitor->base.pub.logical_position.y = crtc->y;
+  monitor->base.pub.logical_size.x = (LVKW_Scalar)crtc->width;
+  monitor->base.pub.logical_size.y = (LVKW_Scalar)crtc->height;
+  monitor->base.pub.physical_size.x = (LVKW_Scalar)output->mm_width;
+  monitor->base.pub.physical_size.y = (LVKW_Scalar)output->mm_height;
+  // X11 logical size is often same as current mode pixel size unless scaling is applied.
+  // LVKW assumes logical size is what we get from CRTC.
+
+  // Mode lists rarely change size, even across mode switches: only reallocate when they do.
+  if (monitor->mode_count != (uint32_t)output->nmode) {
+    if (monitor->modes) lvkw_context_free(&ctx->linux_base.base, monitor->modes);
+    monitor->modes = NULL;
+    monitor->mode_count = 0;
+    if (output->nmode > 0) {
+      monitor->modes = (LVKW_VideoMode *)lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_MONITORS, sizeof(LVKW_VideoMode) * (size_t)output->nmode);
+      if (monitor->modes) monitor->mode_count = (uint32_t)output->nmode;
+    }
+  }
+
+  for (uint32_t j = 0; j < monitor->mode_count; j++) {
+    for (int k = 0; k < res->nmode; k++) {
+      if (res->modes[k].id != output->modes[j]) continue;
+      monitor->modes[j].size.x = (int32_t)res->modes[k].width;
+      monitor->modes[j].size.y = (int32_t)res->modes[k].height;
+      monitor->modes[j].refresh_rate_mhz = _lvkw_x11_refresh_rate_mhz(&res->modes[k]);
+      if (output->modes[j] == crtc->mode) monitor->base.pub.current_mode = monitor->modes[j];
+      break;
+    }
+  }
+
+  monitor->base.pub.scale = ctx->scale; // X11 scale is global in this impl
+
+  if (is_new) {
+    LVKW_Event evt = {0};
+    evt.monitor_connection.monitor_ref = (LVKW_MonitorRef *)&monitor->base.pub;
+    evt.monitor_connection.connected = true;
+    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_MONITOR_CONNECTION, NULL, &evt);
+
+    LVKW_Event sync_evt = {0};
+    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
+  }
+  else {
+    bool mode_changed =
+        old_mode.size.x != monitor->base.pub.current_mode.size.x ||
+        old_mode.size.y != monitor->base.pub.current_mode.size.y ||
+        old_mode.refresh_rate_mhz != monitor->base.pub.current_mode.refresh_rate_mhz ||
+        old_scale != monitor->base.pub.scale ||
+        old_logical_size.x != monitor->base.pub.logical_size.x ||
+        old_logical_size.y != monitor->base.pub.logical_size.y;
+    if (mode_changed) {
+      LVKW_Event evt = {0};
+      evt.monitor_mode.monitor = &monitor->base.pub;
+      _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_MONITOR_MODE, NULL, &evt);
+
+      LVKW_Event sync_evt = {0};
+      _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
+    }
+  }
+
+  lvkw_XRRFreeCrtcInfo(ctx, crtc);
+  lvkw_XRRFreeOutputInfo(ctx, output);
+  return true;
+}
+
 void _lvkw_x11_update_monitors(LVKW_Context_X11 *ctx) {
+  const bool full = ctx->monitors_full_refresh;
+  ctx->monitors_stale = false;
+  ctx->monitors_full_refresh = false;
+  const uint32_t dirty_output_count = ctx->dirty_output_count;
+  const uint32_t dirty_crtc_count = ctx->dirty_crtc_count;
+  ctx->dirty_output_count = 0;
+  ctx->dirty_crtc_count = 0;
+
   if (!ctx->randr_available) return;
 
   XRRScreenResources *res = lvkw_XRRGetScreenResourcesCurrent(ctx, ctx->display, DefaultRootWindow(ctx->display));
@@ -78,24 +313,11 @@ void _lvkw_x11_update_monitors(LVKW_Context_X11 *ctx) {
 
   RROutput primary = lvkw_XRRGetOutputPrimary(ctx, ctx->display, DefaultRootWindow(ctx->display));
 
-  // Mark all existing monitors as potentially lost
   for (LVKW_Monitor_Base *m = ctx->linux_base.base.prv.monitor_list; m; m = m->prv.next) {
-    m->pub.flags |= LVKW_MONITOR_STATE_LOST;
+    ((LVKW_Monitor_X11 *)m)->seen = false;
   }
 
   for (int i = 0; i < res->noutput; i++) {
-    XRROutputInfo *output = lvkw_XRRGetOutputInfo(ctx, ctx->display, res, res->outputs[i]);
-    if (!output || output->connection != RR_Connected || output->crtc == None) {
-      if (output) lvkw_XRRFreeOutputInfo(ctx, output);
-      continue;
-    }
-
-    XRRCrtcInfo *crtc = lvkw_XRRGetCrtcInfo(ctx, ctx->display, res, output->crtc);
-    if (!crtc) {
-      lvkw_XRRFreeOutputInfo(ctx, output);
-      continue;
-    }
-
     LVKW_Monitor_X11 *monitor = NULL;
     for (LVKW_Monitor_Base *m = ctx->linux_base.base.prv.monitor_list; m; m = m->prv.next) {
       LVKW_Monitor_X11 *mx11 = (LVKW_Monitor_X11 *)m;
@@ -105,107 +327,32 @@ void _lvkw_x11_update_monitors(LVKW_Context_X11 *ctx) {
       }
     }
 
-    bool is_new = false;
-    if (!monitor) {
-      monitor = (LVKW_Monitor_X11 *)lvkw_context_alloc(&ctx->linux_base.base, sizeof(LVKW_Monitor_X11));
-      memset(monitor, 0, sizeof(*monitor));
-      monitor->base.prv.ctx_base = &ctx->linux_base.base;
-      monitor->base.pub.context = &ctx->linux_base.base.pub;
-      monitor->output = res->outputs[i];
-      monitor->base.pub.name = _lvkw_string_cache_intern(&ctx->linux_base.base.prv.string_cache, &ctx->linux_base.base, output->name);
-      
-      monitor->base.prv.next = ctx->linux_base.base.prv.monitor_list;
-      ctx->linux_base.base.prv.monitor_list = &monitor->base;
-      is_new = true;
+    // Outputs nothing named keep their state without a round-trip. Unknown outputs only show up
+    // through RRNotify, so they are never skipped by mistake.
+    if (!full && !_lvkw_x11_randr_id_listed(ctx->dirty_outputs, dirty_output_count, res->outputs[i]) &&
+        !(monitor && _lvkw_x11_randr_id_listed(ctx->dirty_crtcs, dirty_crtc_count, monitor->crtc))) {
+      if (monitor && !(monitor->base.pub.flags & LVKW_MONITOR_STATE_LOST)) {
+        monitor->seen = true;
+        monitor->base.pub.is_primary = (res->outputs[i] == primary);
+      }
+      continue;
     }
 
-    LVKW_VideoMode old_mode = monitor->base.pub.current_mode;
-    LVKW_Scalar old_scale = monitor->base.pub.scale;
-    LVKW_LogicalVec old_logical_size = monitor->base.pub.logical_size;
-
-    monitor->base.pub.flags &= (uint32_t)~LVKW_MONITOR_STATE_LOST;
-    monitor->base.pub.is_primary = (res->outputs[i] == primary);
-    monitor->base.pub.logical_position.x = crtc->x;
-    monitor->base.pub.logical_position.y = crtc->y;
-    monitor->base.pub.logical_size.x = (LVKW_Scalar)crtc->width;
-    monitor->base.pub.logical_size.y = (LVKW_Scalar)crtc->height;
-    monitor->base.pub.physical_size.x = (LVKW_Scalar)output->mm_width;
-    monitor->base.pub.physical_size.y = (LVKW_Scalar)output->mm_height;
-    // X11 logical size is often same as current mode pixel size unless scaling is applied.
-    // LVKW assumes logical size is what we get from CRTC.
-    
-    // Update modes
-    if (monitor->modes) {
-        lvkw_context_free(&ctx->linux_base.base, monitor->modes);
-        monitor->modes = NULL;
-        monitor->mode_count = 0;
-    }
-    
-    monitor->mode_count = (uint32_t)output->nmode;
-    monitor->modes = (LVKW_VideoMode *)lvkw_context_alloc(&ctx->linux_base.base, sizeof(LVKW_VideoMode) * monitor->mode_count);
-    
-    for (uint32_t j = 0; j < monitor->mode_count; j++) {
-        for (int k = 0; k < res->nmode; k++) {
-            if (res->modes[k].id == output->modes[j]) {
-                monitor->modes[j].size.x = (int32_t)res->modes[k].width;
-                monitor->modes[j].size.y = (int32_t)res->modes[k].height;
-                if (res->modes[k].dotClock && res->modes[k].hTotal && res->modes[k].vTotal) {
-                    monitor->modes[j].refresh_rate_mhz = (uint32_t)((double)res->modes[k].dotClock / ((double)res->modes[k].hTotal * (double)res->modes[k].vTotal) * 1000.0);
-                } else {
-                    monitor->modes[j].refresh_rate_mhz = 60000;
-                }
-                
-                if (output->modes[j] == crtc->mode) {
-                    monitor->base.pub.current_mode = monitor->modes[j];
-                }
-                break;
-            }
-        }
-    }
+    _lvkw_x11_refresh_output(ctx, res, res->outputs[i], monitor, primary);
+  }
 
-    monitor->base.pub.scale = ctx->scale; // X11 scale is global in this impl
-    
-    if (is_new) {
-        LVKW_Event evt = {0};
-        evt.monitor_connection.monitor_ref = (LVKW_MonitorRef *)&monitor->base.pub;
-        evt.monitor_connection.connected = true;
-        _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_MONITOR_CONNECTION, NULL, &evt);
-    } else {
-        bool mode_changed =
-            old_mode.size.x != monitor->base.pub.current_mode.size.x ||
-            old_mode.size.y != monitor->base.pub.current_mode.size.y ||
-            old_mode.refresh_rate_mhz != monitor->base.pub.current_mode.refresh_rate_mhz ||
-            old_scale != monitor->base.pub.scale ||
-            old_logical_size.x != monitor->base.pub.logical_size.x ||
-            old_logical_size.y != monitor->base.pub.logical_size.y;
-        if (mode_changed) {
-          LVKW_Event evt = {0};
-          evt.monitor_mode.monitor = &monitor->base.pub;
-          _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_MONITOR_MODE, NULL, &evt);
-        }
-    }
+  // Handle removed monitors. Lost monitors stay listed, and are only announced once.
+  for (LVKW_Monitor_Base *curr = ctx->linux_base.base.prv.monitor_list; curr; curr = curr->prv.next) {
+    if (((LVKW_Monitor_X11 *)curr)->seen || (curr->pub.flags & LVKW_MONITOR_STATE_LOST)) continue;
+    curr->pub.flags |= LVKW_MONITOR_STATE_LOST;
+
+    LVKW_Event evt = {0};
+    evt.monitor_connection.monitor_ref = (LVKW_MonitorRef *)&curr->pub;
+    evt.monitor_connection.connected = false;
+    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_MONITOR_CONNECTION, NULL, &evt);
 
     LVKW_Event sync_evt = {0};
     _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
-
-    lvkw_XRRFreeCrtcInfo(ctx, crtc);
-    lvkw_XRRFreeOutputInfo(ctx, output);
-  }
-
-  // Handle removed monitors
-  LVKW_Monitor_Base **prev = &ctx->linux_base.base.prv.monitor_list;
-  while (*prev) {
-    LVKW_Monitor_Base *curr = *prev;
-    if (curr->pub.flags & LVKW_MONITOR_STATE_LOST) {
-        LVKW_Event evt = {0};
-        evt.monitor_connection.monitor_ref = (LVKW_MonitorRef *)&curr->pub;
-        evt.monitor_connection.connected = false;
-        _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_MONITOR_CONNECTION, NULL, &evt);
-        
-        LVKW_Event sync_evt = {0};
-        _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
-    }
-    prev = &curr->prv.next;
   }
 
   lvkw_XRRFreeScreenResources(ctx, res);
@@ -218,6 +365,41 @@ static void _ctrl_push_event_bridge(LVKW_EventType type, LVKW_Window *window, co
 }
 #endif
 
+// X keycodes are keymap positions: resolve them to keys and modifier flags once, rather than
+// looking up and translating a keysym on every event. The X11 xkb state is never updated after
+// creation, so the table matches what a per-event lookup would return.
+static void _lvkw_x11_build_key_tables(LVKW_Context_X11 *ctx) {
+  struct xkb_keymap *keymap = ctx->linux_base.xkb.keymap;
+  if (keymap && ctx->linux_base.xkb.state) {
+    ctx->linux_base.xkb.mod_indices.shift =
+        lvkw_xkb_keymap_mod_get_index(ctx, keymap, XKB_MOD_NAME_SHIFT);
+    ctx->linux_base.xkb.mod_indices.ctrl =
+        lvkw_xkb_keymap_mod_get_index(ctx, keymap, XKB_MOD_NAME_CTRL);
+    ctx->linux_base.xkb.mod_indices.alt = lvkw_xkb_keymap_mod_get_index(ctx, keymap, XKB_MOD_NAME_ALT);
+    ctx->linux_base.xkb.mod_indices.super =
+        lvkw_xkb_keymap_mod_get_index(ctx, keymap, XKB_MOD_NAME_LOGO);
+    ctx->linux_base.xkb.mod_indices.caps =
+        lvkw_xkb_keymap_mod_get_index(ctx, keymap, XKB_MOD_NAME_CAPS);
+    ctx->linux_base.xkb.mod_indices.num = lvkw_xkb_keymap_mod_get_index(ctx, keymap, XKB_MOD_NAME_NUM);
+
+    for (uint32_t keycode = 0; keycode < LVKW_LINUX_KEYCODE_TABLE_SIZE; ++keycode) {
+      xkb_keysym_t sym = lvkw_xkb_state_key_get_one_sym(ctx, ctx->linux_base.xkb.state, keycode);
+      ctx->linux_base.xkb.keycode_lut[keycode] = lvkw_linux_translate_keysym(sym);
+    }
+  }
+  else {
+    // Core protocol state bits.
+    ctx->linux_base.xkb.mod_indices.shift = 0;
+    ctx->linux_base.xkb.mod_indices.caps = 1;
+    ctx->linux_base.xkb.mod_indices.ctrl = 2;
+    ctx->linux_base.xkb.mod_indices.alt = 3;
+    ctx->linux_base.xkb.mod_indices.super = 6;
+    ctx->linux_base.xkb.mod_indices.num = XKB_MOD_INVALID;
+  }
+
+  _lvkw_linux_build_modifier_lut(&ctx->linux_base);
+}
+
 LVKW_Status lvkw_ctx_create_X11(const LVKW_ContextCreateInfo *create_info,
                                 LVKW_Context **out_ctx_handle) {
   LVKW_API_VALIDATE(createContext, create_info, out_ctx_handle);
@@ -238,6 +420,8 @@ LVKW_Status lvkw_ctx_create_X11(const LVKW_ContextCreateInfo *create_info,
       (create_info->tuning && create_info->tuning->x11.idle_poll_interval_ms > 0)
           ? create_info->tuning->x11.idle_poll_interval_ms
           : 250;
+  ctx->idle_timeout_ms = 60000;
+  ctx->coalesce_events = create_info->tuning && create_info->tuning->x11.coalesce_events;
 
   if (_lvkw_context_init_base(&ctx->linux_base.base, create_info) != LVKW_SUCCESS) {
     _ctx_free(ctx, ctx);
@@ -247,11 +431,13 @@ LVKW_Status lvkw_ctx_create_X11(const LVKW_ContextCreateInfo *create_info,
   ctx->linux_base.base.prv.backend = &_lvkw_x11_backend;
 #endif
 
-  if (!lvkw_load_x11_symbols(&ctx->linux_base.base, &ctx->dlib.x11, &ctx->dlib.x11_xcb, &ctx->dlib.xcursor,
-                             &ctx->dlib.xrandr, &ctx->dlib.xss, &ctx->dlib.xi, &ctx->dlib.xkb)) {
+  LVKW_METRICS_STAMP(load_start);
+  if (!lvkw_load_x11_symbols(&ctx->linux_base.base, &ctx->dlib.x11, &ctx->dlib.x11_xcb, &ctx->dlib.xcb, &ctx->dlib.xcursor,
+                             &ctx->dlib.xrandr, &ctx->dlib.xss, &ctx->dlib.xext, &ctx->dlib.xi, &ctx->dlib.xkb)) {
     _ctx_free(ctx, ctx);
     return LVKW_ERROR;
   }
+  LVKW_METRICS_RECORD_PHASE(&ctx->linux_base.base, LVKW_STARTUP_PHASE_LIBRARY_LOAD, load_start);
 
   lvkw_XrmInitialize(ctx);
 
@@ -265,12 +451,17 @@ LVKW_Status lvkw_ctx_create_X11(const LVKW_ContextCreateInfo *create_info,
   #endif
   #endif
 
+  LVKW_METRICS_STAMP(connect_start);
   ctx->display = lvkw_XOpenDisplay(ctx, NULL);
   if (!ctx->display) {
     LVKW_REPORT_CTX_DIAGNOSTIC(&ctx->linux_base.base, LVKW_DIAGNOSTIC_RESOURCE_UNAVAILABLE,
                                "XOpenDisplay failed");
     goto cleanup_display;
   }
+  // Events are read and decoded straight from xcb; Xlib's own queue would copy and lock per event.
+  ctx->connection = lvkw_XGetXCBConnection(ctx, ctx->display);
+  lvkw_XSetEventQueueOwner(ctx, ctx->display, XCBOwnsEventQueue);
+  LVKW_METRICS_RECORD_PHASE(&ctx->linux_base.base, LVKW_STARTUP_PHASE_CONNECT, connect_start);
 
   {
     int pipefd[2];
@@ -288,74 +479,116 @@ LVKW_Status lvkw_ctx_create_X11(const LVKW_ContextCreateInfo *create_info,
     }
   }
 
+  LVKW_METRICS_STAMP(ext_start);
+  // Every server query lvkw needs up front goes out before the first reply is awaited, so the
+  // extension probes and all atoms cost a single round-trip.
+  xcb_query_extension_cookie_t ext_cookies[LVKW_X11_EXT_COUNT];
+  for (int i = 0; i < LVKW_X11_EXT_COUNT; i++) {
+    ext_cookies[i] = lvkw_xcb_query_extension(ctx, ctx->connection,
+                                              (uint16_t)strlen(_lvkw_x11_ext_names[i]),
+                                              _lvkw_x11_ext_names[i]);
+  }
+  _lvkw_x11_intern_atoms(ctx);
+
+  xcb_query_extension_reply_t *ext_replies[LVKW_X11_EXT_COUNT];
+  for (int i = 0; i < LVKW_X11_EXT_COUNT; i++) {
+    ext_replies[i] = lvkw_xcb_query_extension_reply(ctx, ctx->connection, ext_cookies[i], NULL);
+    if (ext_replies[i] && !ext_replies[i]->present) {
+      free(ext_replies[i]);
+      ext_replies[i] = NULL;
+    }
+  }
+
   // Initialize Xrandr
-  if (ctx->dlib.xrandr.base.available) {
-    if (lvkw_XRRQueryExtension(ctx, ctx->display, &ctx->randr_event_base, &ctx->randr_error_base)) {
-      int major, minor;
-      if (lvkw_XRRQueryVersion(ctx, ctx->display, &major, &minor)) {
-        ctx->randr_available = true;
-        lvkw_XRRSelectInput(ctx, ctx->display, DefaultRootWindow(ctx->display),
-                            RROutputChangeNotifyMask | RRScreenChangeNotifyMask);
-      }
+  if (ctx->dlib.xrandr.base.available && ext_replies[LVKW_X11_EXT_RANDR]) {
+    ctx->randr_event_base = ext_replies[LVKW_X11_EXT_RANDR]->first_event;
+    ctx->randr_error_base = ext_replies[LVKW_X11_EXT_RANDR]->first_error;
+    int major, minor;
+    if (lvkw_XRRQueryVersion(ctx, ctx->display, &major, &minor)) {
+      ctx->randr_available = true;
+      lvkw_XRRSelectInput(ctx, ctx->display, DefaultRootWindow(ctx->display),
+                          RROutputChangeNotifyMask | RRCrtcChangeNotifyMask |
+                              RRScreenChangeNotifyMask);
     }
   }
 
   // Initialize XScreenSaver extension support (server-side extension, not just libXss presence).
-  if (ctx->dlib.xss.base.available) {
-    int xss_event_base = 0;
-    int xss_error_base = 0;
-    ctx->xss_available =
-        lvkw_XScreenSaverQueryExtension(ctx, ctx->display, &xss_event_base, &xss_error_base) ? true : false;
+  ctx->xss_available = ctx->dlib.xss.base.available && ext_replies[LVKW_X11_EXT_SCREEN_SAVER];
+
+  if (ctx->dlib.xext.base.available && ext_replies[LVKW_X11_EXT_SYNC]) {
+    int major, minor;
+    if (lvkw_XSyncInitialize(ctx, ctx->display, &major, &minor)) {
+      ctx->sync_available = true;
+      ctx->sync_event_base = ext_replies[LVKW_X11_EXT_SYNC]->first_event;
+      _lvkw_x11_init_idle_alarms(ctx);
+    }
+  }
+
+  ctx->xi_opcode = -1;
+  if (ctx->dlib.xi.base.available && ext_replies[LVKW_X11_EXT_INPUT]) {
+    int major = 2, minor = 2;
+    if (lvkw_XIQueryVersion(ctx, ctx->display, &major, &minor) == Success) {
+      ctx->xi_opcode = ext_replies[LVKW_X11_EXT_INPUT]->major_opcode;
+      // Smooth scrolling needs 2.1. Below that, windows keep using core pointer events.
+      ctx->xi_pointer = major > 2 || minor >= 1;
+      XIEventMask mask;
+      mask.deviceid = XIAllMasterDevices;
+      mask.mask_len = XIMaskLen(XI_LASTEVENT);
+      mask.mask = (unsigned char *)calloc(1, (size_t)mask.mask_len);
+      if (mask.mask) {
+        XISetMask(mask.mask, XI_RawMotion);
+        if (ctx->xi_pointer) XISetMask(mask.mask, XI_DeviceChanged);
+        lvkw_XISelectEvents(ctx, ctx->display, DefaultRootWindow(ctx->display), &mask, 1);
+        free(mask.mask);
+      }
+      if (ctx->xi_pointer) _lvkw_x11_xi_refresh_scroll_valuators(ctx, XIAllMasterDevices);
+    }
   }
 
+  for (int i = 0; i < LVKW_X11_EXT_COUNT; i++) free(ext_replies[i]);
+
+  LVKW_METRICS_RECORD_PHASE(&ctx->linux_base.base, LVKW_STARTUP_PHASE_PROTOCOL_DISCOVERY, ext_start);
+
   // Initialize XKB
+  LVKW_METRICS_STAMP(xkb_start);
   if (ctx->dlib.xkb.base.available) {
     ctx->linux_base.xkb.ctx = lvkw_xkb_context_new(ctx, XKB_CONTEXT_NO_FLAGS);
-    if (ctx->linux_base.xkb.ctx && ctx->dlib.x11_xcb.base.available && ctx->dlib.xkb.x11_base.available) {
-      xcb_connection_t *conn = lvkw_XGetXCBConnection(ctx, ctx->display);
-      if (conn) {
-        uint16_t major, minor;
-        uint8_t base_evt, base_err;
-        if (lvkw_xkb_x11_setup_xkb_extension(
-                ctx, conn, XKB_X11_MIN_MAJOR_XKB_VERSION, XKB_X11_MIN_MINOR_XKB_VERSION,
-                XKB_X11_SETUP_XKB_EXTENSION_NO_FLAGS, &major, &minor, &base_evt, &base_err)) {
-          int32_t device_id = lvkw_xkb_x11_get_core_keyboard_device_id(ctx, conn);
-          if (device_id != -1) {
-            ctx->linux_base.xkb.keymap = lvkw_xkb_x11_keymap_new_from_device(
-                ctx, ctx->linux_base.xkb.ctx, conn, device_id, XKB_KEYMAP_COMPILE_NO_FLAGS);
-            if (ctx->linux_base.xkb.keymap) {
-              ctx->linux_base.xkb.state =
-                  lvkw_xkb_x11_state_new_from_device(ctx, ctx->linux_base.xkb.keymap, conn, device_id);
-            }
+    if (ctx->linux_base.xkb.ctx && ctx->dlib.xkb.x11_base.available) {
+      xcb_connection_t *conn = ctx->connection;
+      uint16_t major, minor;
+      uint8_t base_evt, base_err;
+      // libxkbcommon-x11 talks to xcb directly; count one round-trip per blocking call.
+      LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
+      if (lvkw_xkb_x11_setup_xkb_extension(
+              ctx, conn, XKB_X11_MIN_MAJOR_XKB_VERSION, XKB_X11_MIN_MINOR_XKB_VERSION,
+              XKB_X11_SETUP_XKB_EXTENSION_NO_FLAGS, &major, &minor, &base_evt, &base_err)) {
+        LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
+        int32_t device_id = lvkw_xkb_x11_get_core_keyboard_device_id(ctx, conn);
+        if (device_id != -1) {
+          LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
+          ctx->linux_base.xkb.keymap = lvkw_xkb_x11_keymap_new_from_device(
+              ctx, ctx->linux_base.xkb.ctx, conn, device_id, XKB_KEYMAP_COMPILE_NO_FLAGS);
+          if (ctx->linux_base.xkb.keymap) {
+            LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
+            ctx->linux_base.xkb.state =
+                lvkw_xkb_x11_state_new_from_device(ctx, ctx->linux_base.xkb.keymap, conn, device_id);
           }
         }
       }
     }
   }
 
+  _lvkw_x11_build_key_tables(ctx);
+
+  LVKW_METRICS_RECORD_PHASE(&ctx->linux_base.base, LVKW_STARTUP_PHASE_KEYMAP, xkb_start);
+
+  LVKW_METRICS_STAMP(resources_start);
   ctx->scale = (LVKW_Scalar)_lvkw_x11_get_scale(ctx);
 
-  ctx->wm_protocols = lvkw_XInternAtom(ctx, ctx->display, "WM_PROTOCOLS", False);
-  ctx->wm_delete_window = lvkw_XInternAtom(ctx, ctx->display, "WM_DELETE_WINDOW", False);
-  ctx->window_context = lvkw_XUniqueContext(ctx);
   ctx->hidden_cursor =
       _lvkw_x11_create_hidden_cursor(ctx, ctx->display, DefaultRootWindow(ctx->display));
-  ctx->net_wm_state = lvkw_XInternAtom(ctx, ctx->display, "_NET_WM_STATE", False);
-  ctx->net_wm_state_fullscreen = lvkw_XInternAtom(ctx, ctx->display, "_NET_WM_STATE_FULLSCREEN", False);
-  ctx->net_wm_state_maximized_vert =
-      lvkw_XInternAtom(ctx, ctx->display, "_NET_WM_STATE_MAXIMIZED_VERT", False);
-  ctx->net_wm_state_maximized_horz =
-      lvkw_XInternAtom(ctx, ctx->display, "_NET_WM_STATE_MAXIMIZED_HORZ", False);
-  ctx->net_active_window = lvkw_XInternAtom(ctx, ctx->display, "_NET_ACTIVE_WINDOW", False);
-  ctx->net_wm_ping = lvkw_XInternAtom(ctx, ctx->display, "_NET_WM_PING", False);
-  ctx->wm_take_focus = lvkw_XInternAtom(ctx, ctx->display, "WM_TAKE_FOCUS", False);
-  ctx->motif_wm_hints = lvkw_XInternAtom(ctx, ctx->display, "_MOTIF_WM_HINTS", False);
-  ctx->clipboard = lvkw_XInternAtom(ctx, ctx->display, "CLIPBOARD", False);
-  ctx->targets = lvkw_XInternAtom(ctx, ctx->display, "TARGETS", False);
-  ctx->utf8_string = lvkw_XInternAtom(ctx, ctx->display, "UTF8_STRING", False);
-  ctx->text_atom = lvkw_XInternAtom(ctx, ctx->display, "TEXT", False);
-  ctx->clipboard_property = lvkw_XInternAtom(ctx, ctx->display, "LVKW_CLIPBOARD_DATA", False);
-  ctx->xdnd_aware = lvkw_XInternAtom(ctx, ctx->display, "XdndAware", False);
+  LVKW_METRICS_RECORD_PHASE(&ctx->linux_base.base, LVKW_STARTUP_PHASE_PROTOCOL_DISCOVERY,
+                            resources_start);
 
   for (int i = 1; i <= 12; i++) {
     ctx->linux_base.base.prv.standard_cursors[i].pub.flags = LVKW_CURSOR_FLAG_SYSTEM;
@@ -366,35 +599,18 @@ LVKW_Status lvkw_ctx_create_X11(const LVKW_ContextCreateInfo *create_info,
     ctx->linux_base.base.prv.standard_cursors[i].prv.shape = (LVKW_CursorShape)i;
   }
 
-  ctx->xi_opcode = -1;
-  if (ctx->dlib.xi.base.available) {
-    int ev, err;
-    if (lvkw_XQueryExtension(ctx, ctx->display, "XInputExtension", &ctx->xi_opcode, &ev, &err)) {
-      int major = 2, minor = 2;
-      if (lvkw_XIQueryVersion(ctx, ctx->display, &major, &minor) == Success) {
-        XIEventMask mask;
-        mask.deviceid = XIAllMasterDevices;
-        mask.mask_len = XIMaskLen(XI_LASTEVENT);
-        mask.mask = (unsigned char *)calloc(1, (size_t)mask.mask_len);
-        if (mask.mask) {
-          XISetMask(mask.mask, XI_RawMotion);
-          lvkw_XISelectEvents(ctx, ctx->display, DefaultRootWindow(ctx->display), &mask, 1);
-          free(mask.mask);
-        }
-      }
-    }
-    else {
-      ctx->xi_opcode = -1;
-    }
-  }
-
   *out_ctx_handle = (LVKW_Context *)ctx;
 
 #ifdef LVKW_ENABLE_CONTROLLER
+  LVKW_METRICS_STAMP(ctrl_start);
   _lvkw_ctrl_init_context_Linux(&ctx->linux_base.base, &ctx->linux_base.controller, _ctrl_push_event_bridge, &ctx->linux_base.base);
+  LVKW_METRICS_RECORD_PHASE(&ctx->linux_base.base, LVKW_STARTUP_PHASE_CONTROLLER_SCAN, ctrl_start);
 #endif
 
+  LVKW_METRICS_STAMP(monitors_start);
+  ctx->monitors_full_refresh = true;
   _lvkw_x11_update_monitors(ctx);
+  LVKW_METRICS_RECORD_PHASE(&ctx->linux_base.base, LVKW_STARTUP_PHASE_MONITORS, monitors_start);
 
   // Apply initial attributes
   _lvkw_update_base_attributes(&ctx->linux_base.base, LVKW_CONTEXT_ATTR_ALL, &create_info->attributes);
@@ -424,8 +640,8 @@ cleanup_display:
   if (ctx->hidden_cursor) lvkw_XFreeCursor(ctx, ctx->display, ctx->hidden_cursor);
   if (ctx->display) lvkw_XCloseDisplay(ctx, ctx->display);
   _lvkw_context_cleanup_base(&ctx->linux_base.base);
-  lvkw_unload_x11_symbols(&ctx->dlib.x11, &ctx->dlib.x11_xcb, &ctx->dlib.xcursor, &ctx->dlib.xrandr,
-                          &ctx->dlib.xss, &ctx->dlib.xi, &ctx->dlib.xkb);
+  lvkw_unload_x11_symbols(&ctx->dlib.x11, &ctx->dlib.x11_xcb, &ctx->dlib.xcb, &ctx->dlib.xcursor, &ctx->dlib.xrandr,
+                          &ctx->dlib.xss, &ctx->dlib.xext, &ctx->dlib.xi, &ctx->dlib.xkb);
   _ctx_free(ctx, ctx);
   return LVKW_ERROR;
 }
@@ -472,12 +688,15 @@ LVKW_Status lvkw_ctx_destroy_X11(LVKW_Context *ctx_handle) {
     }
   }
 
+  if (ctx->idle_alarm != None) lvkw_XSyncDestroyAlarm(ctx, ctx->display, ctx->idle_alarm);
+  if (ctx->resume_alarm != None) lvkw_XSyncDestroyAlarm(ctx, ctx->display, ctx->resume_alarm);
+
   _lvkw_context_cleanup_base(&ctx->linux_base.base);
   lvkw_XFreeCursor(ctx, ctx->display, ctx->hidden_cursor);
   lvkw_XCloseDisplay(ctx, ctx->display);
 
-    lvkw_unload_x11_symbols(&ctx->dlib.x11, &ctx->dlib.x11_xcb, &ctx->dlib.xcursor, &ctx->dlib.xrandr,
-                             &ctx->dlib.xss, &ctx->dlib.xi, &ctx->dlib.xkb);
+    lvkw_unload_x11_symbols(&ctx->dlib.x11, &ctx->dlib.x11_xcb, &ctx->dlib.xcb, &ctx->dlib.xcursor, &ctx->dlib.xrandr,
+                             &ctx->dlib.xss, &ctx->dlib.xext, &ctx->dlib.xi, &ctx->dlib.xkb);
   _ctx_free(ctx, ctx);
 
   return LVKW_SUCCESS;
@@ -555,9 +774,5 @@ LVKW_Status lvkw_ctx_getVkExtensions_X11(LVKW_Context *ctx_handle, uint32_t *cou
 LVKW_Status lvkw_ctx_getMetrics_X11(LVKW_Context *ctx, LVKW_MetricsCategory category,
                                       void *out_data, bool reset) {
   LVKW_API_VALIDATE(ctx_getMetrics, ctx, category, out_data, reset);
-  (void)ctx;
-  (void)category;
-  (void)out_data;
-  (void)reset;
-  return LVKW_ERROR;
+  return _lvkw_context_get_base_metrics((LVKW_Context_Base *)ctx, category, out_data, reset);
 }
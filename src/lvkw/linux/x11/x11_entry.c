@@ -27,13 +27,14 @@ const LVKW_Backend _lvkw_x11_backend = {
             .get_geometry = lvkw_wnd_getGeometry_X11,
             .update = lvkw_wnd_update_X11,
             .request_focus = lvkw_wnd_requestFocus_X11,
+            .ack_resize = lvkw_wnd_ackResize_X11,
             .push_text = lvkw_wnd_setClipboardText_X11,
             .pull_text = lvkw_wnd_getClipboardText_X11,
             .push_data = lvkw_wnd_setClipboardData_X11,
             .pull_data = lvkw_wnd_getClipboardData_X11,
             .list_buffer_mime_types = lvkw_wnd_getClipboardMimeTypes_X11,
-            .pull_text_async = NULL,
-            .pull_data_async = NULL,
+            .pull_text_async = lvkw_wnd_pullTextAsync_X11,
+            .pull_data_async = lvkw_wnd_pullDataAsync_X11,
         },
     .cursor =
         {
@@ -122,6 +123,10 @@ LVKW_Status lvkw_display_requestWindowFocus(LVKW_Window *window) {
   LVKW_API_VALIDATE(wnd_requestFocus, window);
   return lvkw_wnd_requestFocus_X11(window);
 }
+LVKW_Status lvkw_display_ackWindowResize(LVKW_Window *window) {
+  LVKW_API_VALIDATE(wnd_ackResize, window);
+  return lvkw_wnd_ackResize_X11(window);
+}
 
 LVKW_Status lvkw_data_setClipboardText(LVKW_Window *window, const char *text) {
   return lvkw_data_pushText(window, LVKW_DATA_EXCHANGE_TARGET_CLIPBOARD, text);
@@ -182,13 +187,13 @@ LVKW_Status lvkw_data_listBufferMimeTypes(LVKW_Window *window, LVKW_DataExchange
 LVKW_Status lvkw_data_pullTextAsync(LVKW_Window *window, LVKW_DataExchangeTarget target,
                                     void *user_tag) {
   LVKW_API_VALIDATE(data_pullTextAsync, window, target, user_tag);
-  return LVKW_ERROR;
+  return lvkw_wnd_pullTextAsync_X11(window, target, user_tag);
 }
 
 LVKW_Status lvkw_data_pullDataAsync(LVKW_Window *window, LVKW_DataExchangeTarget target,
                                     const char *mime_type, void *user_tag) {
   LVKW_API_VALIDATE(data_pullDataAsync, window, target, mime_type, user_tag);
-  return LVKW_ERROR;
+  return lvkw_wnd_pullDataAsync_X11(window, target, mime_type, user_tag);
 }
 
 LVKW_Status lvkw_display_getStandardCursor(LVKW_Context *ctx, LVKW_CursorShape shape,
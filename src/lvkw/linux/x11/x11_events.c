@@ -4,6 +4,7 @@
 #include <errno.h>
 #include <poll.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 
@@ -13,6 +14,7 @@
 #include "dlib/Xi.h"
 #include "dlib/Xrandr.h"
 #include "dlib/Xss.h"
+#include "dlib/xcb.h"
 #include "lvkw/lvkw.h"
 #include "api_constraints.h"
 #include "x11_internal.h"
@@ -22,57 +24,200 @@
 #endif
 
 LVKW_Status _lvkw_wnd_setCursor_X11(LVKW_Window *window_handle, LVKW_Cursor *cursor);
-static bool _lvkw_x11_has_wm_state_atom(LVKW_Context_X11 *ctx, LVKW_Window_X11 *window, Atom atom);
-
-static LVKW_ModifierFlags _lvkw_x11_get_modifiers(unsigned int state) {
-  LVKW_ModifierFlags mods = 0;
-  if (state & ShiftMask) mods |= LVKW_MODIFIER_SHIFT;
-  if (state & ControlMask) mods |= LVKW_MODIFIER_CONTROL;
-  if (state & Mod1Mask) mods |= LVKW_MODIFIER_ALT;
-  if (state & Mod4Mask) mods |= LVKW_MODIFIER_META;
-  if (state & LockMask) mods |= LVKW_MODIFIER_CAPS_LOCK;
-  return mods;
+
+// Only the low byte of a core state carries modifiers; the rest are pointer buttons.
+static LVKW_ModifierFlags _lvkw_x11_get_modifiers(const LVKW_Context_X11 *ctx, unsigned int state) {
+  return _lvkw_linux_modifiers_from_mask(&ctx->linux_base, state & 0xff);
 }
 
-static LVKW_Key _lvkw_x11_get_key(LVKW_Context_X11 *ctx, XKeyEvent *ev) {
+static LVKW_Key _lvkw_x11_get_key(LVKW_Context_X11 *ctx, xcb_keycode_t keycode, uint16_t state) {
+  // X keycodes are 8-bit, so keycode_lut covers all of them.
   if (ctx->linux_base.xkb.state) {
-    xkb_keysym_t sym = lvkw_xkb_state_key_get_one_sym(ctx, ctx->linux_base.xkb.state, ev->keycode);
-    return lvkw_linux_translate_keysym(sym);
+    return ctx->linux_base.xkb.keycode_lut[keycode];
   }
-  KeySym sym = lvkw_XLookupKeysym(ctx, ev, 0);
+  XKeyEvent key_event;
+  memset(&key_event, 0, sizeof(key_event));
+  key_event.type = KeyPress;
+  key_event.display = ctx->display;
+  key_event.keycode = keycode;
+  key_event.state = state;
+  KeySym sym = lvkw_XLookupKeysym(ctx, &key_event, 0);
   return lvkw_linux_translate_keysym((xkb_keysym_t)sym);
 }
 
-static bool _lvkw_x11_has_wm_state_atom(LVKW_Context_X11 *ctx, LVKW_Window_X11 *window, Atom atom) {
-  Atom actual_type = None;
-  int actual_format = 0;
-  unsigned long count = 0;
-  unsigned long bytes_after = 0;
-  unsigned char *data = NULL;
+static LVKW_Window_X11 *_lvkw_x11_find_window(LVKW_Context_X11 *ctx, xcb_window_t xid) {
+  return (LVKW_Window_X11 *)_lvkw_window_map_find(&ctx->linux_base.base.prv.window_map, xid);
+}
 
-  if (lvkw_XGetWindowProperty(ctx, ctx->display, window->window, ctx->net_wm_state, 0, 32, False,
-                              XA_ATOM, &actual_type, &actual_format, &count, &bytes_after,
-                              &data) != Success) {
-    return false;
+void _lvkw_x11_check_error(LVKW_Context_X11 *ctx) {
+  if (ctx->linux_base.base.pub.flags & LVKW_CONTEXT_STATE_LOST) return;
+  if (!ctx->connection || !lvkw_xcb_connection_has_error(ctx, ctx->connection)) return;
+
+  _lvkw_context_mark_lost(&ctx->linux_base.base);
+  LVKW_REPORT_CTX_DIAGNOSTIC(&ctx->linux_base.base, LVKW_DIAGNOSTIC_RESOURCE_UNAVAILABLE,
+                             "X11 connection lost");
+}
+
+static uint32_t _lvkw_x11_decode_wm_state(const LVKW_Context_X11 *ctx, const xcb_atom_t *atoms,
+                                          uint32_t count) {
+  uint32_t state = 0;
+  for (uint32_t i = 0; i < count; ++i) {
+    if (atoms[i] == ctx->net_wm_state_maximized_vert) state |= LVKW_X11_WM_STATE_MAXIMIZED_VERT;
+    else if (atoms[i] == ctx->net_wm_state_maximized_horz) state |= LVKW_X11_WM_STATE_MAXIMIZED_HORZ;
+    else if (atoms[i] == ctx->net_wm_state_fullscreen) state |= LVKW_X11_WM_STATE_FULLSCREEN;
   }
+  return state;
+}
 
-  bool found = false;
-  if (actual_type == XA_ATOM && actual_format == 32 && data) {
-    const Atom *atoms = (const Atom *)data;
-    for (unsigned long i = 0; i < count; ++i) {
-      if (atoms[i] == atom) {
-        found = true;
+static void _lvkw_x11_apply_wm_state(LVKW_Context_X11 *ctx, LVKW_Window_X11 *window,
+                                     uint32_t state) {
+  const uint32_t changed = window->wm_state ^ state;
+  window->wm_state = state;
+  if (!changed) return;
+
+  const uint32_t maximized_mask = LVKW_X11_WM_STATE_MAXIMIZED_VERT | LVKW_X11_WM_STATE_MAXIMIZED_HORZ;
+  bool was_maximized = (window->base.pub.flags & LVKW_WINDOW_STATE_MAXIMIZED) != 0;
+  bool is_maximized = (state & maximized_mask) == maximized_mask;
+  if (was_maximized != is_maximized) {
+    if (is_maximized) window->base.pub.flags |= LVKW_WINDOW_STATE_MAXIMIZED;
+    else window->base.pub.flags &= (uint32_t)~LVKW_WINDOW_STATE_MAXIMIZED;
+
+    LVKW_Event ev = {0};
+    ev.maximized.maximized = is_maximized;
+    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_WINDOW_MAXIMIZED,
+                         (LVKW_Window *)window, &ev);
+  }
+
+  if (state & LVKW_X11_WM_STATE_FULLSCREEN) window->base.pub.flags |= LVKW_WINDOW_STATE_FULLSCREEN;
+  else window->base.pub.flags &= (uint32_t)~LVKW_WINDOW_STATE_FULLSCREEN;
+}
+
+// Window managers rewrite _NET_WM_STATE several times per transition. All stale windows are
+// queried together, so a batch costs a single round-trip regardless of window or event count.
+static void _lvkw_x11_refresh_wm_states(LVKW_Context_X11 *ctx) {
+  if (!ctx->wm_state_stale) return;
+  ctx->wm_state_stale = false;
+
+  for (LVKW_Window_Base *w = ctx->linux_base.base.prv.window_list; w; w = w->prv.next) {
+    LVKW_Window_X11 *window = (LVKW_Window_X11 *)w;
+    if (!window->wm_state_stale) continue;
+    window->wm_state_cookie =
+        lvkw_xcb_get_property(ctx, ctx->connection, 0, (xcb_window_t)window->window,
+                              (xcb_atom_t)ctx->net_wm_state, XCB_ATOM_ATOM, 0, 32);
+  }
+
+  // Every reply is collected before anything is dispatched: a callback may destroy a window, which
+  // must not happen while a request for it is still unanswered.
+  for (LVKW_Window_Base *w = ctx->linux_base.base.prv.window_list; w; w = w->prv.next) {
+    LVKW_Window_X11 *window = (LVKW_Window_X11 *)w;
+    if (!window->wm_state_stale) continue;
+    window->wm_state_stale = false;
+
+    xcb_generic_error_t *error = NULL;
+    xcb_get_property_reply_t *reply =
+        lvkw_xcb_get_property_reply(ctx, ctx->connection, window->wm_state_cookie, &error);
+    free(error);
+    if (!reply) continue;
+
+    uint32_t state = 0;
+    if (reply->type == XCB_ATOM_ATOM && reply->format == 32) {
+      state = _lvkw_x11_decode_wm_state(
+          ctx, (const xcb_atom_t *)lvkw_xcb_get_property_value(ctx, reply),
+          (uint32_t)lvkw_xcb_get_property_value_length(ctx, reply) / sizeof(xcb_atom_t));
+    }
+    free(reply);
+
+    window->wm_state_fetched = true;
+    window->wm_state_fetched_value = state;
+  }
+
+  // Callbacks may destroy any window, so the list is walked afresh after each one.
+  for (;;) {
+    LVKW_Window_X11 *window = NULL;
+    for (LVKW_Window_Base *w = ctx->linux_base.base.prv.window_list; w; w = w->prv.next) {
+      if (((LVKW_Window_X11 *)w)->wm_state_fetched) {
+        window = (LVKW_Window_X11 *)w;
         break;
       }
     }
+    if (!window) return;
+
+    window->wm_state_fetched = false;
+    _lvkw_x11_apply_wm_state(ctx, window, window->wm_state_fetched_value);
   }
+}
+
+// RRNotify on the wire, for the two sub-events that name what changed.
+typedef struct LVKW_X11RandrNotifyEvent {
+  uint8_t response_type;
+  uint8_t sub_code;
+  uint16_t sequence;
+  uint32_t timestamp;
+  union {
+    struct {
+      uint32_t window;
+      uint32_t crtc;
+    } crtc_change;
+    struct {
+      uint32_t config_timestamp;
+      uint32_t window;
+      uint32_t output;
+      uint32_t crtc;
+    } output_change;
+  };
+} LVKW_X11RandrNotifyEvent;
+
+static void _lvkw_x11_add_randr_id(LVKW_Context_X11 *ctx, XID *ids, uint32_t *count, XID id) {
+  for (uint32_t i = 0; i < *count; i++) {
+    if (ids[i] == id) return;
+  }
+  if (*count == LVKW_X11_MAX_DIRTY_RANDR_IDS) {
+    ctx->monitors_full_refresh = true;
+    return;
+  }
+  ids[(*count)++] = id;
+}
 
-  if (data) lvkw_XFree(ctx, data);
-  return found;
+// RandR changes come in bursts. They are collected here and applied once per batch.
+static void _lvkw_x11_note_randr_change(LVKW_Context_X11 *ctx, const xcb_generic_event_t *xev) {
+  ctx->monitors_stale = true;
+  if ((xev->response_type & 0x7f) != ctx->randr_event_base + RRNotify) return;
+
+  const LVKW_X11RandrNotifyEvent *nev = (const LVKW_X11RandrNotifyEvent *)xev;
+  switch (nev->sub_code) {
+    case RRNotify_CrtcChange:
+      _lvkw_x11_add_randr_id(ctx, ctx->dirty_crtcs, &ctx->dirty_crtc_count,
+                             nev->crtc_change.crtc);
+      break;
+    case RRNotify_OutputChange:
+      _lvkw_x11_add_randr_id(ctx, ctx->dirty_outputs, &ctx->dirty_output_count,
+                             nev->output_change.output);
+      break;
+    default:
+      break;
+  }
+}
+
+static void _lvkw_x11_flush_monitors(LVKW_Context_X11 *ctx) {
+  if (!ctx->monitors_stale) return;
+  // A batch with only RRScreenChangeNotify names nothing to re-read.
+  if (ctx->dirty_output_count == 0 && ctx->dirty_crtc_count == 0) ctx->monitors_full_refresh = true;
+  _lvkw_x11_update_monitors(ctx);
+}
+
+static void _lvkw_x11_set_idle(LVKW_Context_X11 *ctx, bool is_idle) {
+  if (is_idle == ctx->is_idle) return;
+
+  ctx->is_idle = is_idle;
+  LVKW_Event evt = {0};
+  evt.idle.timeout_ms = ctx->idle_timeout_ms;
+  evt.idle.is_idle = is_idle;
+  _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_IDLE_STATE_CHANGED, NULL, &evt);
 }
 
+// Fallback for servers without the IDLETIME counter.
 static void _lvkw_x11_update_idle_state(LVKW_Context_X11 *ctx) {
-  if (!ctx->xss_available) return;
+  if (!ctx->xss_available || ctx->idle_alarm != None) return;
 
   uint64_t now_ms = _lvkw_get_timestamp_ms();
   if (ctx->next_idle_probe_ms != 0 && now_ms < ctx->next_idle_probe_ms) return;
@@ -82,61 +227,393 @@ static void _lvkw_x11_update_idle_state(LVKW_Context_X11 *ctx) {
   memset(&info, 0, sizeof(info));
   if (!lvkw_XScreenSaverQueryInfo(ctx, ctx->display, DefaultRootWindow(ctx->display), &info)) return;
 
-  bool is_idle = info.state != ScreenSaverOff;
-  if (is_idle == ctx->is_idle) return;
+  _lvkw_x11_set_idle(ctx, info.idle >= ctx->idle_timeout_ms);
+}
 
-  ctx->is_idle = is_idle;
-  LVKW_Event evt = {0};
-  evt.idle.timeout_ms = 0;
-  evt.idle.is_idle = is_idle;
-  _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_IDLE_STATE_CHANGED, NULL, &evt);
+// XSync AlarmNotify on the wire.
+typedef struct LVKW_X11SyncAlarmEvent {
+  uint8_t response_type;
+  uint8_t kind;
+  uint16_t sequence;
+  uint32_t alarm;
+  int32_t counter_value_hi;
+  uint32_t counter_value_lo;
+  int32_t alarm_value_hi;
+  uint32_t alarm_value_lo;
+  uint32_t timestamp;
+  uint8_t state;
+  uint8_t pad[3];
+} LVKW_X11SyncAlarmEvent;
+
+static void _lvkw_x11_process_idle_alarm(LVKW_Context_X11 *ctx, const LVKW_X11SyncAlarmEvent *aev) {
+  if (aev->alarm == ctx->idle_alarm) {
+    _lvkw_x11_set_idle(ctx, true);
+  }
+  else if (aev->alarm == ctx->resume_alarm) {
+    // The idle alarm went inactive when it fired. Changing it makes it active again.
+    XSyncAlarmAttributes attrs;
+    memset(&attrs, 0, sizeof(attrs));
+    attrs.trigger.test_type = XSyncPositiveComparison;
+    _XSyncIntsToValue(&attrs.trigger.wait_value, ctx->idle_timeout_ms, 0);
+    lvkw_XSyncChangeAlarm(ctx, ctx->display, ctx->idle_alarm, XSyncCAValue | XSyncCATestType,
+                          &attrs);
+    _lvkw_x11_set_idle(ctx, false);
+  }
 }
 
-static void _lvkw_x11_process_xi_event(LVKW_Context_X11 *ctx, XEvent *xev) {
-  if (ctx->xi_opcode < 0 || xev->xcookie.extension != ctx->xi_opcode) return;
-  if (xev->xcookie.evtype != XI_RawMotion) return;
-  if (!lvkw_XGetEventData(ctx, ctx->display, &xev->xcookie)) return;
-
-  XIRawEvent *raw = (XIRawEvent *)xev->xcookie.data;
-  if (raw) {
-    LVKW_Scalar dx = 0;
-    LVKW_Scalar dy = 0;
-    double *raw_values = raw->raw_values;
-    for (int axis = 0; axis < raw->valuators.mask_len * 8; ++axis) {
-      if (!XIMaskIsSet(raw->valuators.mask, axis)) continue;
-      double value = *raw_values++;
-      if (axis == 0) dx = (LVKW_Scalar)value;
-      else if (axis == 1) dy = (LVKW_Scalar)value;
+// XI2 raw events as xcb delivers them: the wire header, xcb's full_sequence, then the valuator
+// mask, the processed axis values and the raw ones, both as FP3232.
+typedef struct LVKW_X11RawEvent {
+  uint8_t response_type;
+  uint8_t extension;
+  uint16_t sequence;
+  uint32_t length;
+  uint16_t event_type;
+  uint16_t deviceid;
+  uint32_t time;
+  uint32_t detail;
+  uint16_t sourceid;
+  uint16_t valuators_len;
+  uint32_t flags;
+  uint32_t pad;
+  uint32_t full_sequence;
+} LVKW_X11RawEvent;
+
+typedef struct LVKW_X11FP3232 {
+  int32_t integral;
+  uint32_t frac;
+} LVKW_X11FP3232;
+
+// XI2 device events (motion, buttons), laid out the same way: the wire header up to the 32-byte
+// boundary, xcb's full_sequence, the rest of the header, then the button mask, the valuator mask
+// and the set valuators as FP3232.
+typedef struct LVKW_X11DeviceEvent {
+  uint8_t response_type;
+  uint8_t extension;
+  uint16_t sequence;
+  uint32_t length;
+  uint16_t event_type;
+  uint16_t deviceid;
+  uint32_t time;
+  uint32_t detail;
+  uint32_t root;
+  uint32_t event;
+  uint32_t child;
+  uint32_t full_sequence;
+  int32_t root_x;  // FP1616
+  int32_t root_y;
+  int32_t event_x;
+  int32_t event_y;
+  uint16_t buttons_len;
+  uint16_t valuators_len;
+  uint16_t sourceid;
+  uint16_t pad;
+  uint32_t flags;
+  uint32_t mods_base;
+  uint32_t mods_latched;
+  uint32_t mods_locked;
+  uint32_t mods_effective;
+  uint8_t group[4];
+} LVKW_X11DeviceEvent;
+
+_Static_assert(sizeof(LVKW_X11RawEvent) == 36, "XI2 raw event header size");
+_Static_assert(sizeof(LVKW_X11DeviceEvent) == 84, "XI2 device event header size");
+
+static double _lvkw_x11_fp3232(const LVKW_X11FP3232 *fp) {
+  return (double)fp->integral + (double)fp->frac / 4294967296.0;
+}
+
+static void _lvkw_x11_flush_motion(LVKW_Context_X11 *ctx) {
+  LVKW_Window_X11 *window = ctx->pending_motion.window;
+  if (!window) return;
+  ctx->pending_motion.window = NULL;
+
+  LVKW_Event *ev = &ctx->pending_motion.event;
+  if (ctx->has_pending_raw_delta) {
+    ev->mouse_motion.raw_delta = ctx->pending_raw_delta;
+    ctx->pending_raw_delta.x = 0;
+    ctx->pending_raw_delta.y = 0;
+    ctx->has_pending_raw_delta = false;
+  }
+
+  _lvkw_dispatch_timed_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_MOUSE_MOTION,
+                             (LVKW_Window *)window, ev, ctx->pending_motion.timestamp_ns);
+}
+
+static void _lvkw_x11_flush_resizes(LVKW_Context_X11 *ctx) {
+  if (!ctx->resize_pending) return;
+  ctx->resize_pending = false;
+
+  // Callbacks may destroy any window, so the list is walked afresh after each one. Clearing
+  // resize_pending before dispatching makes this terminate.
+  for (;;) {
+    LVKW_Window_X11 *window = NULL;
+    for (LVKW_Window_Base *w = ctx->linux_base.base.prv.window_list; w; w = w->prv.next) {
+      if (((LVKW_Window_X11 *)w)->resize_pending) {
+        window = (LVKW_Window_X11 *)w;
+        break;
+      }
     }
-    ctx->pending_raw_delta.x += dx;
-    ctx->pending_raw_delta.y += dy;
-    ctx->has_pending_raw_delta = true;
+    if (!window) return;
+    window->resize_pending = false;
+
+    LVKW_Event ev = {0};
+    ev.resized.geometry.logical_size = window->size;
+    ev.resized.geometry.pixel_size = window->pending_pixel_size;
+    _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_WINDOW_RESIZED,
+                         (LVKW_Window *)window, &ev);
   }
+}
+
+static void _lvkw_x11_queue_motion(LVKW_Context_X11 *ctx, LVKW_Window_X11 *window,
+                                   LVKW_LogicalVec position, uint64_t timestamp_ns) {
+  if (ctx->pending_motion.window != window) {
+    _lvkw_x11_flush_motion(ctx);
+    ctx->pending_motion.window = window;
+    memset(&ctx->pending_motion.event, 0, sizeof(ctx->pending_motion.event));
+  }
+
+  LVKW_Event *ev = &ctx->pending_motion.event;
+  ev->mouse_motion.position = position;
+  if (window->last_cursor_set) {
+    ev->mouse_motion.delta.x += position.x - window->last_x;
+    ev->mouse_motion.delta.y += position.y - window->last_y;
+  }
+  ctx->pending_motion.timestamp_ns = timestamp_ns;
 
-  lvkw_XFreeEventData(ctx, ctx->display, &xev->xcookie);
+  window->last_x = position.x;
+  window->last_y = position.y;
+  window->last_cursor_set = true;
+
+  if (!ctx->coalesce_events) _lvkw_x11_flush_motion(ctx);
 }
 
-static void _lvkw_x11_process_event(LVKW_Context_X11 *ctx, XEvent *xev) {
-  LVKW_Window_X11 *window = NULL;
-  if (lvkw_XFindContext(ctx, ctx->display, xev->xany.window, ctx->window_context,
-                        (XPointer *)&window) != 0) {
-    window = NULL;
+// Buttons 4-7: one wheel notch each, from devices without smooth-scroll valuators.
+static void _lvkw_x11_dispatch_wheel_button(LVKW_Context_X11 *ctx, LVKW_Window_X11 *window,
+                                            uint32_t button, uint64_t timestamp_ns) {
+  LVKW_Event ev = {0};
+  switch (button) {
+    case 4: ev.mouse_scroll.steps.y = 1; break;
+    case 5: ev.mouse_scroll.steps.y = -1; break;
+    case 6: ev.mouse_scroll.steps.x = -1; break;
+    case 7: ev.mouse_scroll.steps.x = 1; break;
+    default: return;
   }
+  ev.mouse_scroll.delta.x = (LVKW_Scalar)ev.mouse_scroll.steps.x;
+  ev.mouse_scroll.delta.y = (LVKW_Scalar)ev.mouse_scroll.steps.y;
+  ev.mouse_scroll.value120.x = ev.mouse_scroll.steps.x * 120;
+  ev.mouse_scroll.value120.y = ev.mouse_scroll.steps.y * 120;
+  ev.mouse_scroll.source = LVKW_SCROLL_SOURCE_WHEEL;
+
+  _lvkw_dispatch_timed_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_MOUSE_SCROLL,
+                             (LVKW_Window *)window, &ev, timestamp_ns);
+}
+
+static void _lvkw_x11_process_raw_motion(LVKW_Context_X11 *ctx, const LVKW_X11RawEvent *raw) {
+  const uint32_t *mask = (const uint32_t *)(raw + 1);
 
-  switch (xev->type) {
-    case KeyPress:
-    case KeyRelease: {
+  uint32_t value_count = 0;
+  for (uint16_t i = 0; i < raw->valuators_len; ++i) {
+    value_count += (uint32_t)__builtin_popcount(mask[i]);
+  }
+  const size_t payload_size = (size_t)raw->valuators_len * 4 + (size_t)value_count * 16;
+  if (payload_size > (size_t)raw->length * 4) return;
+
+  const LVKW_X11FP3232 *raw_values =
+      (const LVKW_X11FP3232 *)(mask + raw->valuators_len) + value_count;
+
+  LVKW_Scalar dx = 0;
+  LVKW_Scalar dy = 0;
+  uint32_t value_index = 0;
+  for (uint32_t axis = 0; axis < 2u && axis < (uint32_t)raw->valuators_len * 32u; ++axis) {
+    if (!(mask[axis / 32] & (1u << (axis % 32)))) continue;
+    const LVKW_Scalar value = (LVKW_Scalar)_lvkw_x11_fp3232(&raw_values[value_index++]);
+    if (axis == 0) dx = value;
+    else dy = value;
+  }
+
+  ctx->pending_raw_delta.x += dx;
+  ctx->pending_raw_delta.y += dy;
+  ctx->has_pending_raw_delta = true;
+}
+
+static LVKW_X11ScrollValuator *_lvkw_x11_find_scroll_valuator(LVKW_Context_X11 *ctx, int deviceid,
+                                                              uint32_t number) {
+  for (uint32_t i = 0; i < ctx->scroll_valuator_count; ++i) {
+    LVKW_X11ScrollValuator *sv = &ctx->scroll_valuators[i];
+    if (sv->deviceid == deviceid && (uint32_t)sv->number == number) return sv;
+  }
+  return NULL;
+}
+
+// Returns true if the valuator moved. Notches follow the core wheel convention: positive y is
+// up, positive x is right.
+static bool _lvkw_x11_accumulate_scroll(LVKW_X11ScrollValuator *sv, double value, LVKW_Event *ev) {
+  if (!sv->has_last) {
+    sv->last = value;
+    sv->has_last = true;
+    return false;
+  }
+  double notches = (value - sv->last) / sv->increment;
+  sv->last = value;
+  if (notches == 0.0) return false;
+  if (sv->vertical) notches = -notches;
+
+  const int32_t value120 = (int32_t)(notches * 120.0 + (notches < 0.0 ? -0.5 : 0.5));
+  const int32_t steps = _lvkw_linux_accumulate_value120(&sv->value120_remainder, value120);
+  if (sv->vertical) {
+    ev->mouse_scroll.delta.y += (LVKW_Scalar)notches;
+    ev->mouse_scroll.value120.y += value120;
+    ev->mouse_scroll.steps.y += steps;
+  }
+  else {
+    ev->mouse_scroll.delta.x += (LVKW_Scalar)notches;
+    ev->mouse_scroll.value120.x += value120;
+    ev->mouse_scroll.steps.x += steps;
+  }
+  return true;
+}
+
+static void _lvkw_x11_process_xi_motion(LVKW_Context_X11 *ctx, const LVKW_X11DeviceEvent *dev,
+                                        LVKW_Window_X11 *window) {
+  const uint64_t timestamp_ns = _lvkw_linux_event_time_ns(dev->time);
+
+  LVKW_LogicalVec position;
+  position.x = (LVKW_Scalar)((double)dev->event_x / 65536.0) / ctx->scale;
+  position.y = (LVKW_Scalar)((double)dev->event_y / 65536.0) / ctx->scale;
+  // Scrolling also arrives as XI_Motion, with the pointer standing still.
+  if (!window->last_cursor_set || position.x != window->last_x || position.y != window->last_y) {
+    _lvkw_x11_queue_motion(ctx, window, position, timestamp_ns);
+  }
+
+  if (!ctx->scroll_valuator_count) return;
+
+  const uint32_t *mask = (const uint32_t *)(dev + 1) + dev->buttons_len;
+
+  uint32_t value_count = 0;
+  for (uint16_t i = 0; i < dev->valuators_len; ++i) {
+    value_count += (uint32_t)__builtin_popcount(mask[i]);
+  }
+  const size_t header_size = sizeof(LVKW_X11DeviceEvent) - 36;
+  const size_t payload_size =
+      ((size_t)dev->buttons_len + dev->valuators_len) * 4 + (size_t)value_count * 8;
+  if (header_size + payload_size > (size_t)dev->length * 4) return;
+
+  const LVKW_X11FP3232 *values = (const LVKW_X11FP3232 *)(mask + dev->valuators_len);
+
+  LVKW_Event ev = {0};
+  bool scrolled = false;
+  uint32_t value_index = 0;
+  for (uint32_t word = 0; word < dev->valuators_len; ++word) {
+    for (uint32_t bits = mask[word]; bits; bits &= bits - 1) {
+      const uint32_t number = word * 32u + (uint32_t)__builtin_ctz(bits);
+      const double value = _lvkw_x11_fp3232(&values[value_index++]);
+      LVKW_X11ScrollValuator *sv = _lvkw_x11_find_scroll_valuator(ctx, dev->deviceid, number);
+      if (sv && _lvkw_x11_accumulate_scroll(sv, value, &ev)) scrolled = true;
+    }
+  }
+  if (!scrolled) return;
+
+  _lvkw_x11_flush_motion(ctx);
+  _lvkw_dispatch_timed_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_MOUSE_SCROLL,
+                             (LVKW_Window *)window, &ev, timestamp_ns);
+}
+
+static void _lvkw_x11_process_xi_button(LVKW_Context_X11 *ctx, const LVKW_X11DeviceEvent *dev,
+                                        LVKW_Window_X11 *window) {
+  _lvkw_x11_flush_motion(ctx);
+  const uint64_t timestamp_ns = _lvkw_linux_event_time_ns(dev->time);
+
+  if (dev->detail >= 4 && dev->detail <= 7) {
+    // Wheel buttons the server emulates from scroll valuators; those were already reported.
+    if (dev->flags & XIPointerEmulated) return;
+    if (dev->event_type == XI_ButtonPress) {
+      _lvkw_x11_dispatch_wheel_button(ctx, window, dev->detail, timestamp_ns);
+    }
+    return;
+  }
+
+  LVKW_Event ev = {0};
+  ev.mouse_button.button = _lvkw_x11_translate_button(dev->detail);
+  if (ev.mouse_button.button == (LVKW_MouseButton)0xFFFFFFFF) return;
+  ev.mouse_button.state = (dev->event_type == XI_ButtonPress) ? LVKW_BUTTON_STATE_PRESSED
+                                                              : LVKW_BUTTON_STATE_RELEASED;
+  ev.mouse_button.modifiers = _lvkw_x11_get_modifiers(ctx, dev->mods_effective);
+  _lvkw_dispatch_timed_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_MOUSE_BUTTON,
+                             (LVKW_Window *)window, &ev, timestamp_ns);
+}
+
+static void _lvkw_x11_process_xi_event(LVKW_Context_X11 *ctx, const xcb_ge_generic_event_t *ge) {
+  if (ctx->xi_opcode < 0 || ge->extension != ctx->xi_opcode) return;
+
+  switch (ge->event_type) {
+    case XI_RawMotion:
+      _lvkw_x11_process_raw_motion(ctx, (const LVKW_X11RawEvent *)ge);
+      break;
+
+    case XI_Motion:
+    case XI_ButtonPress:
+    case XI_ButtonRelease: {
+      const LVKW_X11DeviceEvent *dev = (const LVKW_X11DeviceEvent *)ge;
+      const size_t header_size = sizeof(LVKW_X11DeviceEvent) - 36;
+      if (header_size + ((size_t)dev->buttons_len + dev->valuators_len) * 4 >
+          (size_t)dev->length * 4) {
+        break;
+      }
+      LVKW_Window_X11 *window = _lvkw_x11_find_window(ctx, dev->event);
+      if (!window) break;
+      if (ge->event_type == XI_Motion) _lvkw_x11_process_xi_motion(ctx, dev, window);
+      else _lvkw_x11_process_xi_button(ctx, dev, window);
+      break;
+    }
+
+    case XI_DeviceChanged:
+      // Same leading layout as every XI2 event.
+      _lvkw_x11_xi_refresh_scroll_valuators(ctx, ((const LVKW_X11RawEvent *)ge)->deviceid);
+      break;
+
+    default:
+      break;
+  }
+}
+
+static void _lvkw_x11_process_event(LVKW_Context_X11 *ctx, const xcb_generic_event_t *xev) {
+  const uint8_t type = xev->response_type & 0x7f;
+
+  // Anything that may dispatch ends the current motion run, so ordering is preserved. XI2 events
+  // carry motion and raw deltas too, and flush for themselves when they dispatch anything else.
+  if (type != XCB_MOTION_NOTIFY && type != XCB_GE_GENERIC) _lvkw_x11_flush_motion(ctx);
+
+  switch (type) {
+    case 0: {
+#ifdef LVKW_ENABLE_INTERNAL_CHECKS
+#ifdef LVKW_ENABLE_DIAGNOSTICS
+      const xcb_generic_error_t *error = (const xcb_generic_error_t *)xev;
+      char msg[128];
+      snprintf(msg, sizeof(msg), "X11 error: request code %d, minor code %d, error code %d",
+               error->major_code, error->minor_code, error->error_code);
+      LVKW_REPORT_CTX_DIAGNOSTIC(&ctx->linux_base.base, LVKW_DIAGNOSTIC_BACKEND_FAILURE, msg);
+#endif
+#endif
+      break;
+    }
+
+    case XCB_KEY_PRESS:
+    case XCB_KEY_RELEASE: {
+      const xcb_key_press_event_t *kev = (const xcb_key_press_event_t *)xev;
+      LVKW_Window_X11 *window = _lvkw_x11_find_window(ctx, kev->event);
       if (!window) break;
       LVKW_Event ev = {0};
-      ev.key.key = _lvkw_x11_get_key(ctx, &xev->xkey);
-      ev.key.state = (xev->type == KeyPress) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
-      ev.key.modifiers = _lvkw_x11_get_modifiers(xev->xkey.state);
-      _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_KEY, (LVKW_Window *)window, &ev);
+      ev.key.key = _lvkw_x11_get_key(ctx, kev->detail, kev->state);
+      ev.key.state = (type == XCB_KEY_PRESS) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
+      ev.key.modifiers = _lvkw_x11_get_modifiers(ctx, kev->state);
+      _lvkw_dispatch_timed_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_KEY, (LVKW_Window *)window, &ev,
+                                 _lvkw_linux_event_time_ns(kev->time));
 
-      if (xev->type == KeyPress && ctx->linux_base.xkb.state) {
+      if (type == XCB_KEY_PRESS && ctx->linux_base.xkb.state) {
         char buffer[64];
         int len =
-            lvkw_xkb_state_key_get_utf8(ctx, ctx->linux_base.xkb.state, xev->xkey.keycode, buffer, sizeof(buffer));
+            lvkw_xkb_state_key_get_utf8(ctx, ctx->linux_base.xkb.state, kev->detail, buffer, sizeof(buffer));
         if (len > 0) {
           LVKW_Event text_evt = {0};
           text_evt.text_input.text = buffer;
@@ -148,117 +625,100 @@ static void _lvkw_x11_process_event(LVKW_Context_X11 *ctx, XEvent *xev) {
       break;
     }
 
-    case ButtonPress:
-    case ButtonRelease: {
+    case XCB_BUTTON_PRESS:
+    case XCB_BUTTON_RELEASE: {
+      const xcb_button_press_event_t *bev = (const xcb_button_press_event_t *)xev;
+      LVKW_Window_X11 *window = _lvkw_x11_find_window(ctx, bev->event);
       if (!window) break;
       LVKW_Event ev = {0};
-      ev.mouse_button.button = _lvkw_x11_translate_button(xev->xbutton.button);
+      ev.mouse_button.button = _lvkw_x11_translate_button(bev->detail);
       
-      if (xev->xbutton.button >= 4 && xev->xbutton.button <= 7) {
-        if (xev->type == ButtonPress) {
-            LVKW_Event sev = {0};
-            if (xev->xbutton.button == 4) {
-              sev.mouse_scroll.delta.y = 1.0f;
-              sev.mouse_scroll.steps.y = 1;
-            }
-            else if (xev->xbutton.button == 5) {
-              sev.mouse_scroll.delta.y = -1.0f;
-              sev.mouse_scroll.steps.y = -1;
-            }
-            else if (xev->xbutton.button == 6) {
-              sev.mouse_scroll.delta.x = -1.0f;
-              sev.mouse_scroll.steps.x = -1;
-            }
-            else if (xev->xbutton.button == 7) {
-              sev.mouse_scroll.delta.x = 1.0f;
-              sev.mouse_scroll.steps.x = 1;
-            }
-            
-            _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_MOUSE_SCROLL, (LVKW_Window *)window, &sev);
+      if (bev->detail >= 4 && bev->detail <= 7) {
+        if (type == XCB_BUTTON_PRESS) {
+          _lvkw_x11_dispatch_wheel_button(ctx, window, bev->detail,
+                                          _lvkw_linux_event_time_ns(bev->time));
         }
         break;
       }
       
       if (ev.mouse_button.button != (LVKW_MouseButton)0xFFFFFFFF) {
-          ev.mouse_button.state = (xev->type == ButtonPress) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
-          ev.mouse_button.modifiers = _lvkw_x11_get_modifiers(xev->xbutton.state);
-          _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_MOUSE_BUTTON, (LVKW_Window *)window, &ev);
+          ev.mouse_button.state = (type == XCB_BUTTON_PRESS) ? LVKW_BUTTON_STATE_PRESSED : LVKW_BUTTON_STATE_RELEASED;
+          ev.mouse_button.modifiers = _lvkw_x11_get_modifiers(ctx, bev->state);
+          _lvkw_dispatch_timed_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_MOUSE_BUTTON,
+                                     (LVKW_Window *)window, &ev,
+                                     _lvkw_linux_event_time_ns(bev->time));
       }
       break;
     }
 
-    case MotionNotify: {
+    case XCB_MOTION_NOTIFY: {
+      const xcb_motion_notify_event_t *mev = (const xcb_motion_notify_event_t *)xev;
+      LVKW_Window_X11 *window = _lvkw_x11_find_window(ctx, mev->event);
       if (!window) break;
-      LVKW_Event ev = {0};
-      ev.mouse_motion.position.x = (LVKW_Scalar)xev->xmotion.x / ctx->scale;
-      ev.mouse_motion.position.y = (LVKW_Scalar)xev->xmotion.y / ctx->scale;
-
-      if (window->last_cursor_set) {
-        ev.mouse_motion.delta.x = ev.mouse_motion.position.x - window->last_x;
-        ev.mouse_motion.delta.y = ev.mouse_motion.position.y - window->last_y;
-      }
-
-      window->last_x = ev.mouse_motion.position.x;
-      window->last_y = ev.mouse_motion.position.y;
-      window->last_cursor_set = true;
-
-      if (ctx->locked_window == window && window->cursor_mode == LVKW_CURSOR_LOCKED &&
-          ctx->has_pending_raw_delta) {
-        ev.mouse_motion.raw_delta = ctx->pending_raw_delta;
-        ctx->pending_raw_delta.x = 0;
-        ctx->pending_raw_delta.y = 0;
-        ctx->has_pending_raw_delta = false;
-      }
+      LVKW_LogicalVec position;
+      position.x = (LVKW_Scalar)mev->event_x / ctx->scale;
+      position.y = (LVKW_Scalar)mev->event_y / ctx->scale;
+      _lvkw_x11_queue_motion(ctx, window, position, _lvkw_linux_event_time_ns(mev->time));
+      break;
+    }
 
-      _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_MOUSE_MOTION, (LVKW_Window *)window, &ev);
+    case XCB_ENTER_NOTIFY: {
+      // Whatever the pointer did elsewhere is not ours: scroll valuators and raw deltas restart.
+      const xcb_enter_notify_event_t *eev = (const xcb_enter_notify_event_t *)xev;
+      if (!_lvkw_x11_find_window(ctx, eev->event)) break;
+      _lvkw_x11_xi_reset_scroll_valuators(ctx);
+      ctx->pending_raw_delta.x = 0;
+      ctx->pending_raw_delta.y = 0;
+      ctx->has_pending_raw_delta = false;
       break;
     }
 
-    case ConfigureNotify: {
+    case XCB_CONFIGURE_NOTIFY: {
+      const xcb_configure_notify_event_t *cev = (const xcb_configure_notify_event_t *)xev;
+      LVKW_Window_X11 *window = _lvkw_x11_find_window(ctx, cev->window);
       if (!window) break;
-      uint32_t new_w = (uint32_t)((LVKW_Scalar)xev->xconfigure.width / ctx->scale);
-      uint32_t new_h = (uint32_t)((LVKW_Scalar)xev->xconfigure.height / ctx->scale);
+      uint32_t new_w = (uint32_t)((LVKW_Scalar)cev->width / ctx->scale);
+      uint32_t new_h = (uint32_t)((LVKW_Scalar)cev->height / ctx->scale);
       
       if (new_w != window->size.x || new_h != window->size.y) {
           window->size.x = new_w;
           window->size.y = new_h;
-          
-          LVKW_Event ev = {0};
-          ev.resized.geometry.logical_size = window->size;
-          ev.resized.geometry.pixel_size.x = xev->xconfigure.width;
-          ev.resized.geometry.pixel_size.y = xev->xconfigure.height;
-          
-          _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_WINDOW_RESIZED, (LVKW_Window *)window, &ev);
+          window->pending_pixel_size.x = cev->width;
+          window->pending_pixel_size.y = cev->height;
+          window->resize_pending = true;
+          ctx->resize_pending = true;
+
+          if (!ctx->coalesce_events) _lvkw_x11_flush_resizes(ctx);
       }
       break;
     }
 
-    case PropertyNotify: {
+    case XCB_PROPERTY_NOTIFY: {
+      const xcb_property_notify_event_t *pev = (const xcb_property_notify_event_t *)xev;
+      if (_lvkw_x11_process_transfer_property(ctx, pev)) break;
+      if (pev->atom != ctx->net_wm_state) break;
+      LVKW_Window_X11 *window = _lvkw_x11_find_window(ctx, pev->window);
       if (!window) break;
-      if (xev->xproperty.atom != ctx->net_wm_state) break;
-
-      bool was_maximized = (window->base.pub.flags & LVKW_WINDOW_STATE_MAXIMIZED) != 0;
-      bool is_maximized =
-          _lvkw_x11_has_wm_state_atom(ctx, window, ctx->net_wm_state_maximized_vert) &&
-          _lvkw_x11_has_wm_state_atom(ctx, window, ctx->net_wm_state_maximized_horz);
-      if (was_maximized != is_maximized) {
-        if (is_maximized) window->base.pub.flags |= LVKW_WINDOW_STATE_MAXIMIZED;
-        else window->base.pub.flags &= (uint32_t)~LVKW_WINDOW_STATE_MAXIMIZED;
-
-        LVKW_Event ev = {0};
-        ev.maximized.maximized = is_maximized;
-        _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_WINDOW_MAXIMIZED,
-                              (LVKW_Window *)window, &ev);
+
+      if (pev->state == XCB_PROPERTY_DELETE) {
+        window->wm_state_stale = false;
+        _lvkw_x11_apply_wm_state(ctx, window, 0);
       }
+      else {
+        window->wm_state_stale = true;
+        ctx->wm_state_stale = true;
+      }
+      break;
+    }
 
-      bool is_fullscreen =
-          _lvkw_x11_has_wm_state_atom(ctx, window, ctx->net_wm_state_fullscreen);
-      if (is_fullscreen) window->base.pub.flags |= LVKW_WINDOW_STATE_FULLSCREEN;
-      else window->base.pub.flags &= (uint32_t)~LVKW_WINDOW_STATE_FULLSCREEN;
+    case XCB_SELECTION_NOTIFY: {
+      _lvkw_x11_process_selection_notify(ctx, (const xcb_selection_notify_event_t *)xev);
       break;
     }
 
-    case MapNotify: {
+    case XCB_MAP_NOTIFY: {
+      const xcb_map_notify_event_t *mev = (const xcb_map_notify_event_t *)xev;
+      LVKW_Window_X11 *window = _lvkw_x11_find_window(ctx, mev->window);
       if (!window) break;
       if (!(window->base.pub.flags & LVKW_WINDOW_STATE_READY)) {
           window->base.pub.flags |= LVKW_WINDOW_STATE_READY;
@@ -269,28 +729,39 @@ static void _lvkw_x11_process_event(LVKW_Context_X11 *ctx, XEvent *xev) {
       break;
     }
 
-    case ClientMessage: {
+    case XCB_CLIENT_MESSAGE: {
+      const xcb_client_message_event_t *cev = (const xcb_client_message_event_t *)xev;
+      LVKW_Window_X11 *window = _lvkw_x11_find_window(ctx, cev->window);
       if (!window) break;
-      if (xev->xclient.message_type == ctx->wm_protocols) {
-        Atom protocol = (Atom)xev->xclient.data.l[0];
+      if (cev->type == ctx->wm_protocols) {
+        Atom protocol = (Atom)cev->data.data32[0];
         if (protocol == ctx->wm_delete_window) {
           LVKW_Event ev = {0};
           _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_CLOSE_REQUESTED, (LVKW_Window *)window,
                                 &ev);
+        } else if (protocol == ctx->net_wm_sync_request && window->sync_counter != None) {
+          // The ConfigureNotify it announces follows. The counter is set once the app has drawn.
+          _XSyncIntsToValue(&window->sync_value, cev->data.data32[2], (int)cev->data.data32[3]);
+          window->sync_pending = true;
+          ctx->sync_request_pending = true;
         } else if (protocol == ctx->net_wm_ping) {
-          XEvent reply = *xev;
-          reply.xclient.window = DefaultRootWindow(ctx->display);
-          lvkw_XSendEvent(ctx, ctx->display, reply.xclient.window, False,
-                          SubstructureNotifyMask | SubstructureRedirectMask, &reply);
+          xcb_client_message_event_t reply = *cev;
+          reply.response_type = XCB_CLIENT_MESSAGE;
+          reply.window = (xcb_window_t)DefaultRootWindow(ctx->display);
+          lvkw_xcb_send_event(ctx, ctx->connection, 0, reply.window,
+                              XCB_EVENT_MASK_SUBSTRUCTURE_NOTIFY | XCB_EVENT_MASK_SUBSTRUCTURE_REDIRECT,
+                              (const char *)&reply);
         }
       }
       break;
     }
 
-    case FocusIn:
-    case FocusOut: {
+    case XCB_FOCUS_IN:
+    case XCB_FOCUS_OUT: {
+      const xcb_focus_in_event_t *fev = (const xcb_focus_in_event_t *)xev;
+      LVKW_Window_X11 *window = _lvkw_x11_find_window(ctx, fev->event);
       if (!window) break;
-      bool focused = (xev->type == FocusIn);
+      bool focused = (type == XCB_FOCUS_IN);
       bool old_focused = (window->base.pub.flags & LVKW_WINDOW_STATE_FOCUSED) != 0;
       if (!focused) window->last_cursor_set = false;
       if (focused != old_focused) {
@@ -305,34 +776,94 @@ static void _lvkw_x11_process_event(LVKW_Context_X11 *ctx, XEvent *xev) {
     }
 
     default: {
-      if (xev->type == GenericEvent) {
-        _lvkw_x11_process_xi_event(ctx, xev);
+      if (type == XCB_GE_GENERIC) {
+        _lvkw_x11_process_xi_event(ctx, (const xcb_ge_generic_event_t *)xev);
+      }
+      if (ctx->idle_alarm != None && type == ctx->sync_event_base + XSyncAlarmNotify) {
+        _lvkw_x11_process_idle_alarm(ctx, (const LVKW_X11SyncAlarmEvent *)xev);
       }
-      if (ctx->randr_available && (xev->type == ctx->randr_event_base + RRScreenChangeNotify ||
-                                   xev->type == ctx->randr_event_base + RRNotify)) {
-          _lvkw_x11_update_monitors(ctx);
+      if (ctx->randr_available && (type == ctx->randr_event_base + RRScreenChangeNotify ||
+                                   type == ctx->randr_event_base + RRNotify)) {
+        _lvkw_x11_note_randr_change(ctx, xev);
       }
       break;
     }
   }
 }
 
+void _lvkw_x11_ack_sync_request(LVKW_Context_X11 *ctx, LVKW_Window_X11 *window) {
+  if (!window->sync_pending) return;
+  window->sync_pending = false;
+  lvkw_XSyncSetCounter(ctx, ctx->display, window->sync_counter, window->sync_value);
+}
+
+// Resizes the app has not acknowledged itself are acknowledged on the next pump, after the frame
+// drawn in between. A loop that pumps once per frame is paced without calling ackWindowResize.
+static void _lvkw_x11_ack_sync_requests(LVKW_Context_X11 *ctx) {
+  if (!ctx->sync_request_pending) return;
+  ctx->sync_request_pending = false;
+
+  for (LVKW_Window_Base *w = ctx->linux_base.base.prv.window_list; w; w = w->prv.next) {
+    _lvkw_x11_ack_sync_request(ctx, (LVKW_Window_X11 *)w);
+  }
+}
+
+// The first call reads whatever the socket holds; the rest only drain what xcb already queued,
+// without going back to the kernel for every event.
+static void _lvkw_x11_drain_events(LVKW_Context_X11 *ctx, xcb_generic_event_t *event) {
+  while (event) {
+    _lvkw_x11_process_event(ctx, event);
+    free(event);
+    event = lvkw_xcb_poll_for_queued_event(ctx, ctx->connection);
+  }
+  _lvkw_x11_flush_motion(ctx);
+  _lvkw_x11_flush_resizes(ctx);
+  _lvkw_x11_refresh_wm_states(ctx);
+  _lvkw_x11_flush_monitors(ctx);
+}
+
+// Blocks until a synchronous transfer completes. Everything else that arrives in the meantime is
+// dispatched as a pump would.
+void _lvkw_x11_wait_for_transfer(LVKW_Context_X11 *ctx, LVKW_X11Transfer *transfer) {
+  while (!transfer->done) {
+    _lvkw_x11_drain_events(ctx, lvkw_xcb_poll_for_event(ctx, ctx->connection));
+    _lvkw_x11_check_error(ctx);
+    if (ctx->linux_base.base.pub.flags & LVKW_CONTEXT_STATE_LOST) return;
+    _lvkw_x11_expire_transfers(ctx);
+    if (transfer->done) return;
+
+    lvkw_XFlush(ctx, ctx->display);
+    xcb_generic_event_t *queued = lvkw_xcb_poll_for_queued_event(ctx, ctx->connection);
+    if (queued) {
+      _lvkw_x11_drain_events(ctx, queued);
+      continue;
+    }
+
+    struct pollfd pfd;
+    pfd.fd = lvkw_XConnectionNumber(ctx, ctx->display);
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    if (poll(&pfd, 1, _lvkw_x11_transfer_poll_timeout(ctx, -1)) < 0 && errno != EINTR) return;
+  }
+}
+
 LVKW_Status lvkw_ctx_pumpEvents_X11(LVKW_Context *ctx_handle, uint32_t timeout_ms) {
   LVKW_Context_X11 *ctx = (LVKW_Context_X11 *)ctx_handle;
   
   if (ctx->linux_base.base.pub.flags & LVKW_CONTEXT_STATE_LOST) return LVKW_ERROR_CONTEXT_LOST;
 
   _lvkw_notification_ring_dispatch_all(&ctx->linux_base.base);
+  _lvkw_x11_deliver_completed_transfers(ctx);
+  _lvkw_x11_ack_sync_requests(ctx);
 
   uint64_t start_time = (timeout_ms != LVKW_NEVER && timeout_ms > 0) ? _lvkw_get_timestamp_ms() : 0;
 
   for (;;) {
     _lvkw_x11_update_idle_state(ctx);
-    while (lvkw_XPending(ctx, ctx->display)) {
-      XEvent xev;
-      lvkw_XNextEvent(ctx, ctx->display, &xev);
-      _lvkw_x11_process_event(ctx, &xev);
-    }
+    _lvkw_x11_drain_events(ctx, lvkw_xcb_poll_for_event(ctx, ctx->connection));
+    _lvkw_x11_check_error(ctx);
+    if (ctx->linux_base.base.pub.flags & LVKW_CONTEXT_STATE_LOST) return LVKW_ERROR_CONTEXT_LOST;
+    _lvkw_x11_expire_transfers(ctx);
 
 #ifdef LVKW_ENABLE_CONTROLLER
     _lvkw_ctrl_poll_Linux(&ctx->linux_base.base, &ctx->linux_base.controller);
@@ -350,6 +881,15 @@ LVKW_Status lvkw_ctx_pumpEvents_X11(LVKW_Context *ctx_handle, uint32_t timeout_m
       poll_timeout = (int)(timeout_ms - elapsed);
     }
 
+    // Requests issued through Xlib sit in its output buffer until flushed, and replies read since
+    // the drain may have queued events behind them: both must be dealt with before blocking.
+    lvkw_XFlush(ctx, ctx->display);
+    xcb_generic_event_t *queued = lvkw_xcb_poll_for_queued_event(ctx, ctx->connection);
+    if (queued) {
+      _lvkw_x11_drain_events(ctx, queued);
+      continue;
+    }
+
     struct pollfd pfds[2];
     nfds_t pfd_count = 1;
     pfds[0].fd = lvkw_XConnectionNumber(ctx, ctx->display);
@@ -363,8 +903,14 @@ LVKW_Status lvkw_ctx_pumpEvents_X11(LVKW_Context *ctx_handle, uint32_t timeout_m
       pfd_count = 2;
     }
 
-    int ret = poll(pfds, pfd_count, poll_timeout);
-    if (ret <= 0) break;
+    // A clipboard owner that stops answering must not hold the pump past its transfer's deadline.
+    const int wait_timeout = _lvkw_x11_transfer_poll_timeout(ctx, poll_timeout);
+    int ret = poll(pfds, pfd_count, wait_timeout);
+    if (ret < 0) break;
+    if (ret == 0) {
+      if (wait_timeout == poll_timeout) break;
+      continue;
+    }
 
     if (pfd_count > 1 && (pfds[1].revents & POLLIN)) {
       char buf[64];
@@ -3,6 +3,7 @@
 
 #include <X11/Xlib.h>
 #include <X11/keysym.h>
+#include <string.h>
 
 #include "lvkw/lvkw.h"
 #include "linux_internal.h"
@@ -24,3 +25,71 @@ LVKW_MouseButton _lvkw_x11_translate_button(unsigned int button) {
       return (LVKW_MouseButton)0xFFFFFFFF;
   }
 }
+
+void _lvkw_x11_xi_select_window(LVKW_Context_X11 *ctx, Window window) {
+  if (!ctx->xi_pointer) return;
+
+  unsigned char bits[XIMaskLen(XI_LASTEVENT)] = {0};
+  XISetMask(bits, XI_Motion);
+  XISetMask(bits, XI_ButtonPress);
+  XISetMask(bits, XI_ButtonRelease);
+
+  XIEventMask mask;
+  mask.deviceid = XIAllMasterDevices;
+  mask.mask_len = (int)sizeof(bits);
+  mask.mask = bits;
+  lvkw_XISelectEvents(ctx, ctx->display, window, &mask, 1);
+}
+
+void _lvkw_x11_xi_reset_scroll_valuators(LVKW_Context_X11 *ctx) {
+  for (uint32_t i = 0; i < ctx->scroll_valuator_count; ++i) {
+    ctx->scroll_valuators[i].has_last = false;
+    ctx->scroll_valuators[i].value120_remainder = 0;
+  }
+}
+
+// Re-reads the scroll classes of one master pointer, or of all of them for XIAllMasterDevices.
+// A master's classes follow whichever slave last moved it, so this runs on XI_DeviceChanged.
+void _lvkw_x11_xi_refresh_scroll_valuators(LVKW_Context_X11 *ctx, int deviceid) {
+  uint32_t kept = 0;
+  for (uint32_t i = 0; i < ctx->scroll_valuator_count; ++i) {
+    if (deviceid == XIAllMasterDevices || ctx->scroll_valuators[i].deviceid == deviceid) continue;
+    ctx->scroll_valuators[kept++] = ctx->scroll_valuators[i];
+  }
+  ctx->scroll_valuator_count = kept;
+
+  int device_count = 0;
+  XIDeviceInfo *devices = lvkw_XIQueryDevice(ctx, ctx->display, deviceid, &device_count);
+  if (!devices) return;
+
+  for (int d = 0; d < device_count; ++d) {
+    const XIDeviceInfo *device = &devices[d];
+    if (device->use != XIMasterPointer) continue;
+
+    for (int c = 0; c < device->num_classes; ++c) {
+      if (device->classes[c]->type != XIScrollClass) continue;
+      const XIScrollClassInfo *scroll = (const XIScrollClassInfo *)device->classes[c];
+      if (scroll->increment == 0.0) continue;
+      if (ctx->scroll_valuator_count >= LVKW_X11_MAX_SCROLL_VALUATORS) break;
+
+      LVKW_X11ScrollValuator *sv = &ctx->scroll_valuators[ctx->scroll_valuator_count++];
+      memset(sv, 0, sizeof(*sv));
+      sv->deviceid = device->deviceid;
+      sv->number = scroll->number;
+      sv->vertical = scroll->scroll_type == XIScrollTypeVertical;
+      sv->increment = scroll->increment;
+
+      // Seed the baseline from the valuator's current value, so the first scroll is not lost.
+      for (int v = 0; v < device->num_classes; ++v) {
+        if (device->classes[v]->type != XIValuatorClass) continue;
+        const XIValuatorClassInfo *valuator = (const XIValuatorClassInfo *)device->classes[v];
+        if (valuator->number != scroll->number) continue;
+        sv->last = valuator->value;
+        sv->has_last = true;
+        break;
+      }
+    }
+  }
+
+  lvkw_XIFreeDeviceInfo(ctx, devices);
+}
@@ -9,14 +9,17 @@
 #include <X11/Xutil.h>
 #include <X11/extensions/XInput2.h>
 #include <X11/extensions/scrnsaver.h>
+#include <X11/extensions/sync.h>
 #include <X11/keysym.h>
 
 #include "dlib/X11.h"
 #include "dlib/Xcursor.h"
+#include "dlib/Xext.h"
 #include "dlib/Xi.h"
 #include "dlib/Xlib-xcb.h"
 #include "dlib/Xrandr.h"
 #include "dlib/Xss.h"
+#include "dlib/xcb.h"
 #include "dlib/xkbcommon.h"
 #include "internal.h"
 #include "linux_internal.h"
@@ -33,10 +36,33 @@ typedef struct LVKW_Cursor_X11 {
 typedef struct LVKW_Monitor_X11 {
   LVKW_Monitor_Base base;
   RROutput output;
+  RRCrtc crtc;
+  bool seen;  // Still connected as of the refresh in progress.
   LVKW_VideoMode *modes;
   uint32_t mode_count;
 } LVKW_Monitor_X11;
 
+// One smooth-scroll axis of a master pointer, from its XI2 scroll class.
+typedef struct LVKW_X11ScrollValuator {
+  int deviceid;
+  int number;
+  bool vertical;
+  double increment;  // Valuator units per wheel notch.
+  double last;       // Valuators are absolute; deltas are taken against this.
+  bool has_last;
+  int32_t value120_remainder;
+} LVKW_X11ScrollValuator;
+
+#define LVKW_X11_MAX_SCROLL_VALUATORS 8
+#define LVKW_X11_MAX_DIRTY_RANDR_IDS 16
+
+// Known _NET_WM_STATE atoms, as cached on each window.
+typedef enum LVKW_X11WmStateFlags {
+  LVKW_X11_WM_STATE_MAXIMIZED_VERT = 1 << 0,
+  LVKW_X11_WM_STATE_MAXIMIZED_HORZ = 1 << 1,
+  LVKW_X11_WM_STATE_FULLSCREEN = 1 << 2,
+} LVKW_X11WmStateFlags;
+
 typedef struct LVKW_X11ClipboardMime {
   const char *mime_type;
   Atom atom;
@@ -44,28 +70,65 @@ typedef struct LVKW_X11ClipboardMime {
   size_t size;
 } LVKW_X11ClipboardMime;
 
+// A clipboard conversion. Every conversion is delivered through clipboard_property on the
+// requesting window, so they run one at a time: only the head of LVKW_Context_X11::transfers has
+// been sent to the owner, the rest wait their turn.
+typedef struct LVKW_X11Transfer {
+  LVKW_Window_X11 *window;
+  Atom target;
+  Atom fallback;     // Asked for if the owner refuses target. None when there is nothing to try.
+  bool converting;   // ConvertSelection sent.
+  bool incr;         // The owner is streaming the data through INCR chunks.
+  bool synchronous;  // Waited on by a blocking pull, which owns the transfer and reads the result.
+  bool done;
+  bool failed;
+  uint64_t deadline_ms;  // Pushed back by every chunk received.
+
+  Atom type;
+  int format;
+  uint8_t *buffer;
+  size_t size;
+  size_t capacity;
+
+  LVKW_DataExchangeTarget exchange_target;
+  const char *mime_type;
+  void *user_tag;
+
+  struct LVKW_X11Transfer *next;
+} LVKW_X11Transfer;
+
 typedef struct LVKW_Context_X11 {
   LVKW_Context_Linux linux_base;
 
   struct {
     LVKW_Lib_X11 x11;
     LVKW_Lib_X11_XCB x11_xcb;
+    LVKW_Lib_Xcb xcb;
     LVKW_Lib_Xcursor xcursor;
     LVKW_Lib_Xrandr xrandr;
     LVKW_Lib_Xss xss;
+    LVKW_Lib_Xext xext;
     LVKW_Lib_Xi xi;
     LVKW_Lib_Xkb xkb;
   } dlib;
 
   LVKW_Scalar scale;
   Display *display;
+  xcb_connection_t *connection;  // Owns the event queue; Xlib is kept for requests and Vulkan.
   int randr_event_base;
   int randr_error_base;
   bool randr_available;
+  // RandR changes seen in the current batch. Outputs and CRTCs named by RRNotify are re-read on
+  // their own; a batch that names none, or too many, re-reads every output.
+  bool monitors_stale;
+  bool monitors_full_refresh;
+  uint32_t dirty_output_count;
+  uint32_t dirty_crtc_count;
+  RROutput dirty_outputs[LVKW_X11_MAX_DIRTY_RANDR_IDS];
+  RRCrtc dirty_crtcs[LVKW_X11_MAX_DIRTY_RANDR_IDS];
   bool xss_available;
   Atom wm_protocols;
   Atom wm_delete_window;
-  XContext window_context;
   Cursor hidden_cursor;
   Atom net_wm_state;
   Atom net_wm_state_fullscreen;
@@ -73,6 +136,8 @@ typedef struct LVKW_Context_X11 {
   Atom net_wm_state_maximized_horz;
   Atom net_active_window;
   Atom net_wm_ping;
+  Atom net_wm_sync_request;
+  Atom net_wm_sync_request_counter;
   Atom wm_take_focus;
   Atom motif_wm_hints;
   Atom clipboard;
@@ -80,13 +145,32 @@ typedef struct LVKW_Context_X11 {
   Atom utf8_string;
   Atom text_atom;
   Atom clipboard_property;
+  Atom incr;
   Atom xdnd_aware;
   uint32_t idle_poll_interval_ms;
+  uint32_t idle_timeout_ms;
   bool is_idle;
   uint64_t next_idle_probe_ms;
+  bool sync_available;
+  bool sync_request_pending;  // Some window has an unacknowledged _NET_WM_SYNC_REQUEST.
+  // SYNC IDLETIME alarms. When set up, idle changes arrive as events and XScreenSaver is not polled.
+  int sync_event_base;
+  XSyncAlarm idle_alarm;    // Counter >= idle_timeout_ms. Goes inactive once fired; re-armed on resume.
+  XSyncAlarm resume_alarm;  // Counter drops back below idle_timeout_ms.
   int xi_opcode;
+  bool xi_pointer;  // XI 2.1+: pointer motion, buttons and scrolling come from XI2, not core events.
+  LVKW_X11ScrollValuator scroll_valuators[LVKW_X11_MAX_SCROLL_VALUATORS];
+  uint32_t scroll_valuator_count;
   bool has_pending_raw_delta;
   LVKW_LogicalVec pending_raw_delta;
+  bool wm_state_stale;  // Some window's wm_state needs re-reading.
+  bool coalesce_events;
+  bool resize_pending;  // Some window has an undispatched WINDOW_RESIZED.
+  struct {
+    LVKW_Window_X11 *window;  // NULL when nothing is pending.
+    LVKW_Event event;
+    uint64_t timestamp_ns;
+  } pending_motion;
   int wake_pipe_read;
   int wake_pipe_write;
   Window clipboard_owner_window;
@@ -97,6 +181,8 @@ typedef struct LVKW_Context_X11 {
   size_t clipboard_read_cache_capacity;
   const char **clipboard_mime_query_ptr;
   uint32_t clipboard_mime_query_count;
+  LVKW_X11Transfer *transfers;
+  LVKW_X11Transfer *completed_transfers;  // Served from our own clipboard, delivered by the next pump.
   LVKW_Window_X11 *locked_window;
 } LVKW_Context_X11;
 
@@ -120,6 +206,22 @@ typedef struct LVKW_Window_X11 {
   bool mouse_passthrough;
   bool accept_dnd;
   bool transparent;
+
+  // _NET_WM_STATE as last read back. PropertyNotify only marks it stale; the property is re-read
+  // once per window at the end of the event batch, however many notifications came in.
+  uint32_t wm_state;
+  bool wm_state_stale;
+  xcb_get_property_cookie_t wm_state_cookie;
+  bool wm_state_fetched;  // wm_state_fetched_value was read back and is waiting to be applied.
+  uint32_t wm_state_fetched_value;
+
+  // size already holds the latest geometry; this is the pixel size to report with it.
+  bool resize_pending;
+  LVKW_PixelVec pending_pixel_size;
+  // _NET_WM_SYNC_REQUEST: the WM holds further configures until the counter reaches sync_value.
+  XSyncCounter sync_counter;
+  XSyncValue sync_value;
+  bool sync_pending;
 } LVKW_Window_X11;
 
 /* X11 backend functions */
@@ -149,6 +251,7 @@ LVKW_Status lvkw_wnd_update_X11(LVKW_Window *window, uint32_t field_mask,
                                 const LVKW_WindowAttributes *attributes);
 LVKW_Status _lvkw_wnd_setCursor_X11(LVKW_Window *window_handle, LVKW_Cursor *cursor_handle);
 LVKW_Status lvkw_wnd_requestFocus_X11(LVKW_Window *window_handle);
+LVKW_Status lvkw_wnd_ackResize_X11(LVKW_Window *window_handle);
 LVKW_Status lvkw_wnd_setClipboardText_X11(LVKW_Window *window, LVKW_DataExchangeTarget target, const char *text);
 LVKW_Status lvkw_wnd_getClipboardText_X11(LVKW_Window *window, LVKW_DataExchangeTarget target, const char **out_text);
 LVKW_Status lvkw_wnd_setClipboardData_X11(LVKW_Window *window, LVKW_DataExchangeTarget target, const LVKW_DataBuffer *data,
@@ -157,6 +260,9 @@ LVKW_Status lvkw_wnd_getClipboardData_X11(LVKW_Window *window, LVKW_DataExchange
                                           const void **out_data, size_t *out_size);
 LVKW_Status lvkw_wnd_getClipboardMimeTypes_X11(LVKW_Window *window, LVKW_DataExchangeTarget target, const char ***out_mime_types,
                                                uint32_t *count);
+LVKW_Status lvkw_wnd_pullTextAsync_X11(LVKW_Window *window, LVKW_DataExchangeTarget target, void *user_tag);
+LVKW_Status lvkw_wnd_pullDataAsync_X11(LVKW_Window *window, LVKW_DataExchangeTarget target, const char *mime_type,
+                                       void *user_tag);
 
 LVKW_Status lvkw_ctx_getStandardCursor_X11(LVKW_Context *ctx, LVKW_CursorShape shape,
                                            LVKW_Cursor **out_cursor);
@@ -164,9 +270,21 @@ LVKW_Status lvkw_ctx_createCursor_X11(LVKW_Context *ctx, const LVKW_CursorCreate
                                       LVKW_Cursor **out_cursor);
 LVKW_Status lvkw_cursor_destroy_X11(LVKW_Cursor *cursor);
 
-static inline void _lvkw_x11_check_error(LVKW_Context_X11 *ctx) {}
+void _lvkw_x11_check_error(LVKW_Context_X11 *ctx);
+void _lvkw_x11_ack_sync_request(LVKW_Context_X11 *ctx, LVKW_Window_X11 *window);
+
+void _lvkw_x11_process_selection_notify(LVKW_Context_X11 *ctx, const xcb_selection_notify_event_t *sev);
+bool _lvkw_x11_process_transfer_property(LVKW_Context_X11 *ctx, const xcb_property_notify_event_t *pev);
+void _lvkw_x11_expire_transfers(LVKW_Context_X11 *ctx);
+void _lvkw_x11_deliver_completed_transfers(LVKW_Context_X11 *ctx);
+int _lvkw_x11_transfer_poll_timeout(const LVKW_Context_X11 *ctx, int poll_timeout);
+void _lvkw_x11_cancel_transfers(LVKW_Context_X11 *ctx, LVKW_Window_X11 *window);
+void _lvkw_x11_wait_for_transfer(LVKW_Context_X11 *ctx, LVKW_X11Transfer *transfer);
 
 LVKW_MouseButton _lvkw_x11_translate_button(unsigned int button);
+void _lvkw_x11_xi_select_window(LVKW_Context_X11 *ctx, Window window);
+void _lvkw_x11_xi_refresh_scroll_valuators(LVKW_Context_X11 *ctx, int deviceid);
+void _lvkw_x11_xi_reset_scroll_valuators(LVKW_Context_X11 *ctx);
 
 /* X11 helpers */
 
@@ -179,15 +297,20 @@ static inline int lvkw_XCloseDisplay(struct LVKW_Context_X11 *ctx, Display *disp
 static inline Bool lvkw_XQueryExtension(struct LVKW_Context_X11 *ctx, Display *display,
                                          const char *name, int *major_opcode_return,
                                          int *first_event_return, int *first_error_return) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.x11.QueryExtension(display, name, major_opcode_return, first_event_return,
                                       first_error_return);
 }
 static inline Atom lvkw_XInternAtom(struct LVKW_Context_X11 *ctx, Display *display,
                                      const char *atom_name, Bool only_if_exists) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.x11.InternAtom(display, atom_name, only_if_exists);
 }
-static inline XContext lvkw_XUniqueContext(struct LVKW_Context_X11 *ctx) {
-  return (XContext)ctx->dlib.x11.rmUniqueQuark();
+// Pipelines every request, then waits once.
+static inline Status lvkw_XInternAtoms(struct LVKW_Context_X11 *ctx, Display *display, char **names,
+                                       int count, Bool only_if_exists, Atom *atoms_return) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
+  return ctx->dlib.x11.InternAtoms(display, names, count, only_if_exists, atoms_return);
 }
 static inline Pixmap lvkw_XCreateBitmapFromData(struct LVKW_Context_X11 *ctx, Display *display,
                                                  Drawable d, const char *data, unsigned int width,
@@ -207,21 +330,6 @@ static inline int lvkw_XFreePixmap(struct LVKW_Context_X11 *ctx, Display *displa
 static inline int lvkw_XFreeCursor(struct LVKW_Context_X11 *ctx, Display *display, Cursor cursor) {
   return ctx->dlib.x11.FreeCursor(display, cursor);
 }
-static inline int lvkw_XPending(struct LVKW_Context_X11 *ctx, Display *display) {
-  return ctx->dlib.x11.Pending(display);
-}
-static inline int lvkw_XNextEvent(struct LVKW_Context_X11 *ctx, Display *display,
-                                  XEvent *event_return) {
-  return ctx->dlib.x11.NextEvent(display, event_return);
-}
-static inline int lvkw_XPeekEvent(struct LVKW_Context_X11 *ctx, Display *display,
-                                  XEvent *event_return) {
-  return ctx->dlib.x11.PeekEvent(display, event_return);
-}
-static inline int lvkw_XFindContext(struct LVKW_Context_X11 *ctx, Display *display, Window w,
-                                    XContext context, XPointer *data_return) {
-  return ctx->dlib.x11.FindContext(display, w, context, data_return);
-}
 static inline KeySym lvkw_XLookupKeysym(struct LVKW_Context_X11 *ctx, XKeyEvent *key_event,
                                         int index) {
   return ctx->dlib.x11.LookupKeysym(key_event, index);
@@ -258,6 +366,7 @@ static inline void lvkw_XSetSelectionOwner(struct LVKW_Context_X11 *ctx, Display
 }
 static inline Window lvkw_XGetSelectionOwner(struct LVKW_Context_X11 *ctx, Display *display,
                                              Atom selection) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.x11.GetSelectionOwner(display, selection);
 }
 static inline void lvkw_XConvertSelection(struct LVKW_Context_X11 *ctx, Display *display,
@@ -270,6 +379,7 @@ static inline int lvkw_XDeleteProperty(struct LVKW_Context_X11 *ctx, Display *di
   return ctx->dlib.x11.DeleteProperty(display, w, property);
 }
 static inline char *lvkw_XGetAtomName(struct LVKW_Context_X11 *ctx, Display *display, Atom atom) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.x11.GetAtomName(display, atom);
 }
 static inline int lvkw_XSetClassHint(struct LVKW_Context_X11 *ctx, Display *display, Window w,
@@ -283,17 +393,9 @@ static inline XClassHint *lvkw_XAllocClassHint(struct LVKW_Context_X11 *ctx) {
 static inline int lvkw_XFree(struct LVKW_Context_X11 *ctx, void *data) {
   return ctx->dlib.x11.Free(data);
 }
-static inline int lvkw_XSaveContext(struct LVKW_Context_X11 *ctx, Display *display, Window w,
-                                    XContext context, const char *data) {
-  return ctx->dlib.x11.SaveContext(display, w, context, data);
-}
 static inline int lvkw_XMapWindow(struct LVKW_Context_X11 *ctx, Display *display, Window w) {
   return ctx->dlib.x11.MapWindow(display, w);
 }
-static inline int lvkw_XDeleteContext(struct LVKW_Context_X11 *ctx, Display *display, Window w,
-                                      XContext context) {
-  return ctx->dlib.x11.DeleteContext(display, w, context);
-}
 static inline int lvkw_XDestroyWindow(struct LVKW_Context_X11 *ctx, Display *display, Window w) {
   return ctx->dlib.x11.DestroyWindow(display, w);
 }
@@ -301,18 +403,11 @@ static inline Status lvkw_XSendEvent(struct LVKW_Context_X11 *ctx, Display *disp
                                       Bool propagate, long event_mask, XEvent *event_send) {
   return ctx->dlib.x11.SendEvent(display, w, propagate, event_mask, event_send);
 }
-static inline Bool lvkw_XGetEventData(struct LVKW_Context_X11 *ctx, Display *display,
-                                       XGenericEventCookie *cookie) {
-  return ctx->dlib.x11.GetEventData(display, cookie);
-}
-static inline void lvkw_XFreeEventData(struct LVKW_Context_X11 *ctx, Display *display,
-                                        XGenericEventCookie *cookie) {
-  ctx->dlib.x11.FreeEventData(display, cookie);
-}
 static inline int lvkw_XGrabPointer(struct LVKW_Context_X11 *ctx, Display *display,
                                     Window grab_window, Bool owner_events, unsigned int event_mask,
                                     int pointer_mode, int keyboard_mode, Window confine_to,
                                     Cursor cursor, Time time) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.x11.GrabPointer(display, grab_window, owner_events, event_mask, pointer_mode,
                                    keyboard_mode, confine_to, cursor, time);
 }
@@ -370,6 +465,7 @@ static inline int lvkw_XGetWindowProperty(struct LVKW_Context_X11 *ctx, Display
                                           unsigned long *nitems_return,
                                           unsigned long *bytes_after_return,
                                           unsigned char **prop_return) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.x11.GetWindowProperty(display, w, property, long_offset, long_length, del,
                                          req_type, actual_type_return, actual_format_return,
                                          nitems_return, bytes_after_return, prop_return);
@@ -392,8 +488,12 @@ static inline void lvkw_XrmInitialize(struct LVKW_Context_X11 *ctx) {
   ctx->dlib.x11.rmInitialize();
 }
 static inline int lvkw_XSync(struct LVKW_Context_X11 *ctx, Display *display, Bool discard) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.x11.Sync(display, discard);
 }
+static inline int lvkw_XFlush(struct LVKW_Context_X11 *ctx, Display *display) {
+  return ctx->dlib.x11.Flush(display);
+}
 static inline int lvkw_XResizeWindow(struct LVKW_Context_X11 *ctx, Display *display, Window w,
                                      unsigned int width, unsigned int height) {
   return ctx->dlib.x11.ResizeWindow(display, w, width, height);
@@ -443,6 +543,7 @@ static inline void lvkw_XcursorImageDestroy(struct LVKW_Context_X11 *ctx, Xcurso
 
 static inline Status lvkw_XIQueryVersion(struct LVKW_Context_X11 *ctx, Display *display,
                                          int *major_version_inout, int *minor_version_inout) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.xi.QueryVersion(display, major_version_inout, minor_version_inout);
 }
 static inline int lvkw_XISelectEvents(struct LVKW_Context_X11 *ctx, Display *display, Window win,
@@ -451,6 +552,7 @@ static inline int lvkw_XISelectEvents(struct LVKW_Context_X11 *ctx, Display *dis
 }
 static inline XIDeviceInfo *lvkw_XIQueryDevice(struct LVKW_Context_X11 *ctx, Display *display,
                                                int deviceid, int *num_devices_return) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.xi.QueryDevice(display, deviceid, num_devices_return);
 }
 static inline void lvkw_XIFreeDeviceInfo(struct LVKW_Context_X11 *ctx, XIDeviceInfo *info) {
@@ -463,15 +565,75 @@ static inline void lvkw_XIFreeDeviceInfo(struct LVKW_Context_X11 *ctx, XIDeviceI
 static inline xcb_connection_t *lvkw_XGetXCBConnection(struct LVKW_Context_X11 *ctx, Display *dpy) {
   return ctx->dlib.x11_xcb.GetXCBConnection(dpy);
 }
+static inline void lvkw_XSetEventQueueOwner(struct LVKW_Context_X11 *ctx, Display *dpy,
+                                            enum XEventQueueOwner owner) {
+  ctx->dlib.x11_xcb.SetEventQueueOwner(dpy, owner);
+}
+
+/* xcb helpers */
+
+static inline xcb_generic_event_t *lvkw_xcb_poll_for_event(struct LVKW_Context_X11 *ctx,
+                                                          xcb_connection_t *c) {
+  return ctx->dlib.xcb.poll_for_event(c);
+}
+static inline xcb_generic_event_t *lvkw_xcb_poll_for_queued_event(struct LVKW_Context_X11 *ctx,
+                                                                 xcb_connection_t *c) {
+  return ctx->dlib.xcb.poll_for_queued_event(c);
+}
+static inline int lvkw_xcb_connection_has_error(struct LVKW_Context_X11 *ctx, xcb_connection_t *c) {
+  return ctx->dlib.xcb.connection_has_error(c);
+}
+static inline xcb_void_cookie_t lvkw_xcb_send_event(struct LVKW_Context_X11 *ctx,
+                                                    xcb_connection_t *c, uint8_t propagate,
+                                                    xcb_window_t destination, uint32_t event_mask,
+                                                    const char *event) {
+  return ctx->dlib.xcb.send_event(c, propagate, destination, event_mask, event);
+}
+static inline xcb_query_extension_cookie_t lvkw_xcb_query_extension(struct LVKW_Context_X11 *ctx,
+                                                                    xcb_connection_t *c,
+                                                                    uint16_t name_len,
+                                                                    const char *name) {
+  return ctx->dlib.xcb.query_extension(c, name_len, name);
+}
+// Blocks until the reply is in; callers account for the round-trip, which is shared by every
+// request sent before it.
+static inline xcb_query_extension_reply_t *lvkw_xcb_query_extension_reply(
+    struct LVKW_Context_X11 *ctx, xcb_connection_t *c, xcb_query_extension_cookie_t cookie,
+    xcb_generic_error_t **e) {
+  return ctx->dlib.xcb.query_extension_reply(c, cookie, e);
+}
+static inline xcb_get_property_cookie_t lvkw_xcb_get_property(struct LVKW_Context_X11 *ctx,
+                                                              xcb_connection_t *c, uint8_t _delete,
+                                                              xcb_window_t window,
+                                                              xcb_atom_t property, xcb_atom_t type,
+                                                              uint32_t long_offset,
+                                                              uint32_t long_length) {
+  return ctx->dlib.xcb.get_property(c, _delete, window, property, type, long_offset, long_length);
+}
+static inline xcb_get_property_reply_t *lvkw_xcb_get_property_reply(
+    struct LVKW_Context_X11 *ctx, xcb_connection_t *c, xcb_get_property_cookie_t cookie,
+    xcb_generic_error_t **e) {
+  return ctx->dlib.xcb.get_property_reply(c, cookie, e);
+}
+static inline void *lvkw_xcb_get_property_value(struct LVKW_Context_X11 *ctx,
+                                                const xcb_get_property_reply_t *r) {
+  return ctx->dlib.xcb.get_property_value(r);
+}
+static inline int lvkw_xcb_get_property_value_length(struct LVKW_Context_X11 *ctx,
+                                                     const xcb_get_property_reply_t *r) {
+  return ctx->dlib.xcb.get_property_value_length(r);
+}
 
 /* XScreenSaver helpers */
 
 static inline Bool lvkw_XScreenSaverQueryExtension(struct LVKW_Context_X11 *ctx, Display *display,
                                                    int *event_base_return, int *error_base_return) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.xss.QueryExtension(display, event_base_return, error_base_return);
 }
 static inline Status lvkw_XScreenSaverQueryInfo(struct LVKW_Context_X11 *ctx, Display *display,
                                                 Drawable drawable, XScreenSaverInfo *saver_info) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.xss.QueryInfo(display, drawable, saver_info);
 }
 static inline XScreenSaverInfo *lvkw_XScreenSaverAllocInfo(struct LVKW_Context_X11 *ctx) {
@@ -483,26 +645,74 @@ static inline void lvkw_XScreenSaverSuspend(struct LVKW_Context_X11 *ctx, Displa
   ctx->dlib.xss.Suspend(display, suspend);
 }
 
+/* XSync helpers */
+
+static inline Status lvkw_XSyncInitialize(struct LVKW_Context_X11 *ctx, Display *dpy,
+                                          int *major_version_return, int *minor_version_return) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
+  return ctx->dlib.xext.SyncInitialize(dpy, major_version_return, minor_version_return);
+}
+static inline XSyncSystemCounter *lvkw_XSyncListSystemCounters(struct LVKW_Context_X11 *ctx,
+                                                              Display *dpy, int *n_counters_return) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
+  return ctx->dlib.xext.SyncListSystemCounters(dpy, n_counters_return);
+}
+static inline void lvkw_XSyncFreeSystemCounterList(struct LVKW_Context_X11 *ctx,
+                                                   XSyncSystemCounter *list) {
+  ctx->dlib.xext.SyncFreeSystemCounterList(list);
+}
+static inline XSyncAlarm lvkw_XSyncCreateAlarm(struct LVKW_Context_X11 *ctx, Display *dpy,
+                                               unsigned long values_mask,
+                                               XSyncAlarmAttributes *values) {
+  return ctx->dlib.xext.SyncCreateAlarm(dpy, values_mask, values);
+}
+static inline Status lvkw_XSyncChangeAlarm(struct LVKW_Context_X11 *ctx, Display *dpy,
+                                           XSyncAlarm alarm, unsigned long values_mask,
+                                           XSyncAlarmAttributes *values) {
+  return ctx->dlib.xext.SyncChangeAlarm(dpy, alarm, values_mask, values);
+}
+static inline XSyncCounter lvkw_XSyncCreateCounter(struct LVKW_Context_X11 *ctx, Display *dpy,
+                                                    XSyncValue initial_value) {
+  return ctx->dlib.xext.SyncCreateCounter(dpy, initial_value);
+}
+static inline Status lvkw_XSyncSetCounter(struct LVKW_Context_X11 *ctx, Display *dpy,
+                                          XSyncCounter counter, XSyncValue value) {
+  return ctx->dlib.xext.SyncSetCounter(dpy, counter, value);
+}
+static inline Status lvkw_XSyncDestroyCounter(struct LVKW_Context_X11 *ctx, Display *dpy,
+                                              XSyncCounter counter) {
+  return ctx->dlib.xext.SyncDestroyCounter(dpy, counter);
+}
+static inline Status lvkw_XSyncDestroyAlarm(struct LVKW_Context_X11 *ctx, Display *dpy,
+                                            XSyncAlarm alarm) {
+  return ctx->dlib.xext.SyncDestroyAlarm(dpy, alarm);
+}
+
 /* Xrandr helpers */
 
 static inline Bool lvkw_XRRQueryExtension(struct LVKW_Context_X11 *ctx, Display *dpy,
                                           int *event_base_return, int *error_base_return) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.xrandr.QueryExtension(dpy, event_base_return, error_base_return);
 }
 static inline Status lvkw_XRRQueryVersion(struct LVKW_Context_X11 *ctx, Display *dpy,
                                           int *major_version_return, int *minor_version_return) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.xrandr.QueryVersion(dpy, major_version_return, minor_version_return);
 }
 static inline XRRScreenResources *lvkw_XRRGetScreenResourcesCurrent(struct LVKW_Context_X11 *ctx,
                                                                     Display *dpy, Window window) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.xrandr.GetScreenResourcesCurrent(dpy, window);
 }
 static inline XRROutputInfo *lvkw_XRRGetOutputInfo(struct LVKW_Context_X11 *ctx, Display *dpy,
                                                    XRRScreenResources *resources, RROutput output) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.xrandr.GetOutputInfo(dpy, resources, output);
 }
 static inline XRRCrtcInfo *lvkw_XRRGetCrtcInfo(struct LVKW_Context_X11 *ctx, Display *dpy,
                                                XRRScreenResources *resources, RRCrtc crtc) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.xrandr.GetCrtcInfo(dpy, resources, crtc);
 }
 static inline void lvkw_XRRFreeScreenResources(struct LVKW_Context_X11 *ctx,
@@ -524,6 +734,7 @@ static inline void lvkw_XRRSelectInput(struct LVKW_Context_X11 *ctx, Display *dp
 }
 static inline RROutput lvkw_XRRGetOutputPrimary(struct LVKW_Context_X11 *ctx, Display *dpy,
                                                 Window window) {
+  LVKW_METRICS_ROUND_TRIP(&ctx->linux_base.base);
   return ctx->dlib.xrandr.GetOutputPrimary(dpy, window);
 }
 
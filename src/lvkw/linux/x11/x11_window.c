@@ -71,6 +71,8 @@ LVKW_Status lvkw_ctx_createWindow_X11(LVKW_Context *ctx_handle,
   _lvkw_x11_check_error(ctx);
   if (ctx->linux_base.base.pub.flags & LVKW_CONTEXT_STATE_LOST) return LVKW_ERROR_CONTEXT_LOST;
 
+  LVKW_METRICS_WINDOW_CREATE_BEGIN(&ctx->linux_base.base);
+
   LVKW_Window_X11 *window = (LVKW_Window_X11 *)_ctx_alloc(ctx, sizeof(LVKW_Window_X11));
   if (!window) return LVKW_ERROR;
   memset(window, 0, sizeof(*window));
@@ -122,9 +124,11 @@ LVKW_Status lvkw_ctx_createWindow_X11(LVKW_Context *ctx_handle,
   swa.colormap = window->colormap;
   swa.background_pixel = 0;
   swa.border_pixel = 0;
-  swa.event_mask = ExposureMask | KeyPressMask | KeyReleaseMask | PointerMotionMask |
-                   ButtonPressMask | ButtonReleaseMask | StructureNotifyMask | EnterWindowMask |
-                   LeaveWindowMask | FocusChangeMask | PropertyChangeMask;
+  swa.event_mask = ExposureMask | KeyPressMask | KeyReleaseMask | StructureNotifyMask |
+                   EnterWindowMask | LeaveWindowMask | FocusChangeMask | PropertyChangeMask;
+  // With XI2 pointer input, core pointer events would only duplicate it. The core handlers still
+  // serve the LOCKED cursor mode, whose core pointer grab reports in core events.
+  if (!ctx->xi_pointer) swa.event_mask |= PointerMotionMask | ButtonPressMask | ButtonReleaseMask;
 
   window->window = lvkw_XCreateWindow(
       ctx, ctx->display, RootWindow(ctx->display, screen), 0, 0, pixel_width, pixel_height, 0, depth,
@@ -138,6 +142,8 @@ LVKW_Status lvkw_ctx_createWindow_X11(LVKW_Context *ctx_handle,
     return LVKW_ERROR;
   }
 
+  _lvkw_x11_xi_select_window(ctx, window->window);
+
   lvkw_XStoreName(ctx, ctx->display, window->window,
                   create_info->attributes.title ? create_info->attributes.title : "Lvkw");
 
@@ -151,14 +157,25 @@ LVKW_Status lvkw_ctx_createWindow_X11(LVKW_Context *ctx_handle,
     }
   }
 
-  Atom protocols[] = {ctx->wm_delete_window, ctx->wm_take_focus, ctx->net_wm_ping};
-  lvkw_XSetWMProtocols(ctx, ctx->display, window->window, protocols, 3);
+  Atom protocols[] = {ctx->wm_delete_window, ctx->wm_take_focus, ctx->net_wm_ping,
+                      ctx->net_wm_sync_request};
+  int protocol_count = 3;
+  if (ctx->sync_available) {
+    XSyncValue zero;
+    _XSyncIntsToValue(&zero, 0, 0);
+    window->sync_counter = lvkw_XSyncCreateCounter(ctx, ctx->display, zero);
+    if (window->sync_counter != None) {
+      long counter = (long)window->sync_counter;
+      lvkw_XChangeProperty(ctx, ctx->display, window->window, ctx->net_wm_sync_request_counter,
+                           XA_CARDINAL, 32, PropModeReplace, (unsigned char *)&counter, 1);
+      protocol_count = 4;
+    }
+  }
+  lvkw_XSetWMProtocols(ctx, ctx->display, window->window, protocols, protocol_count);
   _lvkw_wnd_apply_size_hints_X11(window);
   _lvkw_wnd_apply_motif_hints_X11(window);
   _lvkw_wnd_apply_dnd_awareness_X11(window);
 
-  lvkw_XSaveContext(ctx, ctx->display, window->window, ctx->window_context, (XPointer)window);
-
   LVKW_Status status = _lvkw_wnd_setCursor_X11((LVKW_Window *)window, window->cursor);
   if (status != LVKW_SUCCESS) goto fail_window_create;
   status = _lvkw_wnd_setCursorMode_X11((LVKW_Window *)window, create_info->attributes.cursor_mode);
@@ -186,13 +203,18 @@ LVKW_Status lvkw_ctx_createWindow_X11(LVKW_Context *ctx_handle,
   }
 
   // Add to context window list
-  _lvkw_window_list_add(&ctx->linux_base.base, &window->base);
+  if (!_lvkw_window_list_add(&ctx->linux_base.base, &window->base, (uintptr_t)window->window)) {
+    status = LVKW_ERROR;
+    goto fail_window_create;
+  }
+
+  LVKW_METRICS_WINDOW_CREATE_END(&ctx->linux_base.base, &window->base);
 
   *out_window_handle = (LVKW_Window *)window;
   return LVKW_SUCCESS;
 
 fail_window_create:
-  lvkw_XDeleteContext(ctx, ctx->display, window->window, ctx->window_context);
+  if (window->sync_counter != None) lvkw_XSyncDestroyCounter(ctx, ctx->display, window->sync_counter);
   lvkw_XDestroyWindow(ctx, ctx->display, window->window);
   lvkw_XFreeColormap(ctx, ctx->display, window->colormap);
   _ctx_free(ctx, window);
@@ -212,8 +234,10 @@ LVKW_Status lvkw_wnd_destroy_X11(LVKW_Window *window_handle) {
     ctx->locked_window = NULL;
     lvkw_XUngrabPointer(ctx, ctx->display, CurrentTime);
   }
+  if (ctx->pending_motion.window == window) ctx->pending_motion.window = NULL;
+  _lvkw_x11_cancel_transfers(ctx, window);
 
-  lvkw_XDeleteContext(ctx, ctx->display, window->window, ctx->window_context);
+  if (window->sync_counter != None) lvkw_XSyncDestroyCounter(ctx, ctx->display, window->sync_counter);
   lvkw_XDestroyWindow(ctx, ctx->display, window->window);
   lvkw_XFreeColormap(ctx, ctx->display, window->colormap);
   _ctx_free(ctx, window);
@@ -661,6 +685,21 @@ LVKW_Status _lvkw_wnd_setCursor_X11(LVKW_Window *window_handle, LVKW_Cursor *cur
   return LVKW_SUCCESS;
 }
 
+LVKW_Status lvkw_wnd_ackResize_X11(LVKW_Window *window_handle) {
+  LVKW_API_VALIDATE(wnd_ackResize, window_handle);
+  LVKW_Window_X11 *window = (LVKW_Window_X11 *)window_handle;
+
+  LVKW_Context_X11 *ctx = (LVKW_Context_X11 *)window->base.prv.ctx_base;
+
+  if (ctx->linux_base.base.pub.flags & LVKW_CONTEXT_STATE_LOST) return LVKW_ERROR_CONTEXT_LOST;
+  if (!window->sync_pending) return LVKW_SUCCESS;
+
+  _lvkw_x11_ack_sync_request(ctx, window);
+  // The app may not pump again for a while: the WM is waiting on this now.
+  lvkw_XFlush(ctx, ctx->display);
+  return LVKW_SUCCESS;
+}
+
 LVKW_Status lvkw_wnd_requestFocus_X11(LVKW_Window *window_handle) {
   LVKW_API_VALIDATE(wnd_requestFocus, window_handle);
   LVKW_Window_X11 *window = (LVKW_Window_X11 *)window_handle;
@@ -718,7 +757,7 @@ static void _clipboard_clear_owned_data(LVKW_Context_X11 *ctx) {
 static bool _clipboard_ensure_read_cache_capacity(LVKW_Context_X11 *ctx, size_t capacity) {
   if (capacity <= ctx->clipboard_read_cache_capacity) return true;
   uint8_t *next =
-      lvkw_context_realloc(&ctx->linux_base.base, ctx->clipboard_read_cache,
+      lvkw_context_realloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, ctx->clipboard_read_cache,
                            ctx->clipboard_read_cache_capacity, capacity);
   if (!next) return false;
   ctx->clipboard_read_cache = next;
@@ -762,53 +801,310 @@ static LVKW_X11ClipboardMime *_clipboard_find_owned_mime_by_type(LVKW_Context_X1
   return NULL;
 }
 
-static bool _clipboard_request_target(LVKW_Window_X11 *window, Atom target, Atom *out_type,
-                                      int *out_format, uint8_t **out_data, size_t *out_size) {
-  LVKW_Context_X11 *ctx = (LVKW_Context_X11 *)window->base.prv.ctx_base;
+// Owners that never answer, or stall halfway through an INCR stream, fail the transfer after this.
+#define LVKW_X11_TRANSFER_TIMEOUT_MS 1000u
+// Property reads are split into requests of this many 32-bit units (256 KiB).
+#define LVKW_X11_TRANSFER_CHUNK_LONGS 65536L
+// An INCR owner announces a lower bound on the size. It is trusted for preallocation up to this.
+#define LVKW_X11_TRANSFER_MAX_HINT (64u * 1024u * 1024u)
+
+static bool _transfer_reserve(LVKW_Context_X11 *ctx, LVKW_X11Transfer *transfer, size_t capacity) {
+  if (capacity <= transfer->capacity) return true;
+  size_t next_cap = transfer->capacity == 0 ? 4096 : transfer->capacity * 2;
+  while (next_cap < capacity) next_cap *= 2;
+  uint8_t *next = lvkw_context_realloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_TRANSFERS,
+                                              transfer->buffer, transfer->capacity, next_cap);
+  if (!next) return false;
+  transfer->buffer = next;
+  transfer->capacity = next_cap;
+  return true;
+}
 
-  lvkw_XDeleteProperty(ctx, ctx->display, window->window, ctx->clipboard_property);
-  lvkw_XConvertSelection(ctx, ctx->display, ctx->clipboard, target, ctx->clipboard_property,
-                         window->window, CurrentTime);
-  lvkw_XSync(ctx, ctx->display, False);
+static void _transfer_convert(LVKW_Context_X11 *ctx, LVKW_X11Transfer *transfer) {
+  lvkw_XDeleteProperty(ctx, ctx->display, transfer->window->window, ctx->clipboard_property);
+  lvkw_XConvertSelection(ctx, ctx->display, ctx->clipboard, transfer->target, ctx->clipboard_property,
+                         transfer->window->window, CurrentTime);
+  lvkw_XFlush(ctx, ctx->display);
+  transfer->converting = true;
+  transfer->deadline_ms = _lvkw_get_timestamp_ms() + LVKW_X11_TRANSFER_TIMEOUT_MS;
+}
+
+static void _transfer_unlink(LVKW_Context_X11 *ctx, LVKW_X11Transfer *transfer) {
+  for (LVKW_X11Transfer **curr = &ctx->transfers; *curr; curr = &(*curr)->next) {
+    if (*curr == transfer) {
+      *curr = transfer->next;
+      break;
+    }
+  }
+  transfer->next = NULL;
+}
+
+static void _transfer_start_next(LVKW_Context_X11 *ctx) {
+  if (ctx->transfers && !ctx->transfers->converting) _transfer_convert(ctx, ctx->transfers);
+}
 
-  const uint32_t timeout_ms = 1000;
-  uint64_t start = _lvkw_get_timestamp_ms();
-  while ((_lvkw_get_timestamp_ms() - start) < timeout_ms) {
-    if (lvkw_ctx_pumpEvents_X11((LVKW_Context *)ctx, 10) != LVKW_SUCCESS) return false;
+static void _transfer_enqueue(LVKW_Context_X11 *ctx, LVKW_X11Transfer *transfer) {
+  LVKW_X11Transfer **tail = &ctx->transfers;
+  while (*tail) tail = &(*tail)->next;
+  *tail = transfer;
+  _transfer_start_next(ctx);
+}
+
+static void _dispatch_data_ready(LVKW_Context_X11 *ctx, LVKW_Window_X11 *window, LVKW_Status status,
+                                 LVKW_DataExchangeTarget target, const char *mime_type, void *user_tag,
+                                 const void *data, size_t size) {
+  LVKW_Event evt = {0};
+  evt.data_ready.status = status;
+  evt.data_ready.user_tag = user_tag;
+  evt.data_ready.target = target;
+  evt.data_ready.mime_type = mime_type;
+  if (status == LVKW_SUCCESS && size > 0) {
+    evt.data_ready.data = data;
+    evt.data_ready.size = size;
+  }
+  _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_DATA_READY, (LVKW_Window *)window, &evt);
+
+  LVKW_Event sync_evt = {0};
+  _lvkw_dispatch_event(&ctx->linux_base.base, LVKW_EVENT_TYPE_SYNC, NULL, &sync_evt);
+}
+
+// Retires a transfer and hands the conversion slot to the next one. A blocking pull gets its
+// transfer back untouched; anyone else hears about it through DATA_READY.
+static void _transfer_finish(LVKW_Context_X11 *ctx, LVKW_X11Transfer *transfer, bool ok) {
+  _transfer_unlink(ctx, transfer);
+  _transfer_start_next(ctx);
+  transfer->done = true;
+  transfer->failed = !ok;
+  if (transfer->synchronous) return;
+
+  // DATA_READY carries bytes: anything the owner sent in another format is of no use to the app.
+  if (ok && transfer->size > 0 && transfer->format != 8) ok = false;
+  _dispatch_data_ready(ctx, transfer->window, ok ? LVKW_SUCCESS : LVKW_ERROR, transfer->exchange_target,
+                       transfer->mime_type, transfer->user_tag, transfer->buffer, transfer->size);
+
+  if (transfer->buffer) lvkw_context_free(&ctx->linux_base.base, transfer->buffer);
+  lvkw_context_free(&ctx->linux_base.base, transfer);
+}
+
+// Appends the whole of clipboard_property to the transfer, chunk by chunk. The last read deletes
+// the property, which is also what asks an INCR owner for its next chunk.
+static bool _transfer_read_property(LVKW_Context_X11 *ctx, LVKW_X11Transfer *transfer, size_t *out_read) {
+  long offset = 0;
+  *out_read = 0;
 
-    Atom actual_type = None;
-    int actual_format = 0;
+  for (;;) {
+    Atom type = None;
+    int format = 0;
     unsigned long nitems = 0;
     unsigned long bytes_after = 0;
-    unsigned char *probe = NULL;
-    if (lvkw_XGetWindowProperty(ctx, ctx->display, window->window, ctx->clipboard_property, 0, 0,
-                                False, AnyPropertyType, &actual_type, &actual_format, &nitems,
-                                &bytes_after, &probe) != Success) {
-      if (probe) lvkw_XFree(ctx, probe);
+    unsigned char *chunk = NULL;
+    if (lvkw_XGetWindowProperty(ctx, ctx->display, transfer->window->window, ctx->clipboard_property,
+                                offset, LVKW_X11_TRANSFER_CHUNK_LONGS, True, AnyPropertyType, &type,
+                                &format, &nitems, &bytes_after, &chunk) != Success) {
+      if (chunk) lvkw_XFree(ctx, chunk);
       return false;
     }
-    if (probe) lvkw_XFree(ctx, probe);
-    if (actual_type == None) continue;
-
-    unsigned char *payload = NULL;
-    if (lvkw_XGetWindowProperty(ctx, ctx->display, window->window, ctx->clipboard_property, 0,
-                                1024 * 1024, True, AnyPropertyType, &actual_type, &actual_format,
-                                &nitems, &bytes_after, &payload) != Success) {
-      if (payload) lvkw_XFree(ctx, payload);
-      return false;
+
+    if (type == ctx->incr && !transfer->incr) {
+      // The data follows in chunks. The property holds a lower bound on its size.
+      transfer->incr = true;
+      if (format == 32 && nitems > 0) {
+        const unsigned long hint = (unsigned long)((const long *)chunk)[0];
+        if (hint <= LVKW_X11_TRANSFER_MAX_HINT && !_transfer_reserve(ctx, transfer, (size_t)hint)) {
+          lvkw_XFree(ctx, chunk);
+          return false;
+        }
+      }
+      if (chunk) lvkw_XFree(ctx, chunk);
+      return true;
     }
 
-    *out_type = actual_type;
-    *out_format = actual_format;
-    *out_data = payload;
     // XGetWindowProperty reports 32-bit properties as an array of longs.
-    *out_size = (actual_format == 8) ? (size_t)nitems
-               : (actual_format == 16) ? (size_t)nitems * 2u
-                                       : (size_t)nitems * sizeof(long);
+    const size_t size = (format == 8) ? (size_t)nitems
+                       : (format == 16) ? (size_t)nitems * 2u
+                                        : (size_t)nitems * sizeof(long);
+    if (type != None) {
+      transfer->type = type;
+      transfer->format = format;
+    }
+    bool ok = _transfer_reserve(ctx, transfer, transfer->size + size);
+    if (ok && size > 0) {
+      memcpy(transfer->buffer + transfer->size, chunk, size);
+      transfer->size += size;
+    }
+    if (chunk) lvkw_XFree(ctx, chunk);
+    if (!ok) return false;
+
+    *out_read += size;
+    if (bytes_after == 0) return true;
+    offset += (long)(nitems * (unsigned long)format / 32u);
+  }
+}
+
+void _lvkw_x11_process_selection_notify(LVKW_Context_X11 *ctx, const xcb_selection_notify_event_t *sev) {
+  LVKW_X11Transfer *transfer = ctx->transfers;
+  if (!transfer || !transfer->converting || transfer->incr) return;
+  if (sev->requestor != (xcb_window_t)transfer->window->window ||
+      sev->selection != (xcb_atom_t)ctx->clipboard || sev->target != (xcb_atom_t)transfer->target) {
+    return;
+  }
+
+  if (sev->property == XCB_NONE) {
+    // Refused. Text requests get a second chance with a plainer target.
+    if (transfer->fallback == None) {
+      _transfer_finish(ctx, transfer, false);
+      return;
+    }
+    transfer->target = transfer->fallback;
+    transfer->fallback = None;
+    _transfer_convert(ctx, transfer);
+    return;
+  }
+
+  size_t read = 0;
+  if (!_transfer_read_property(ctx, transfer, &read)) {
+    _transfer_finish(ctx, transfer, false);
+    return;
+  }
+  if (transfer->incr) {
+    transfer->deadline_ms = _lvkw_get_timestamp_ms() + LVKW_X11_TRANSFER_TIMEOUT_MS;
+    return;
+  }
+  _transfer_finish(ctx, transfer, true);
+}
+
+bool _lvkw_x11_process_transfer_property(LVKW_Context_X11 *ctx, const xcb_property_notify_event_t *pev) {
+  if (pev->atom != (xcb_atom_t)ctx->clipboard_property) return false;
+
+  LVKW_X11Transfer *transfer = ctx->transfers;
+  if (!transfer || !transfer->incr || pev->state != XCB_PROPERTY_NEW_VALUE ||
+      pev->window != (xcb_window_t)transfer->window->window) {
+    return true;
+  }
+
+  size_t read = 0;
+  if (!_transfer_read_property(ctx, transfer, &read)) {
+    _transfer_finish(ctx, transfer, false);
     return true;
   }
+  // A zero-length chunk ends the stream.
+  if (read == 0) {
+    _transfer_finish(ctx, transfer, true);
+    return true;
+  }
+  transfer->deadline_ms = _lvkw_get_timestamp_ms() + LVKW_X11_TRANSFER_TIMEOUT_MS;
+  return true;
+}
+
+void _lvkw_x11_expire_transfers(LVKW_Context_X11 *ctx) {
+  LVKW_X11Transfer *transfer = ctx->transfers;
+  if (!transfer || !transfer->converting) return;
+  if (_lvkw_get_timestamp_ms() < transfer->deadline_ms) return;
+  _transfer_finish(ctx, transfer, false);
+}
+
+void _lvkw_x11_deliver_completed_transfers(LVKW_Context_X11 *ctx) {
+  // Pulls made from these callbacks wait for the next pump.
+  uint32_t count = 0;
+  for (const LVKW_X11Transfer *t = ctx->completed_transfers; t; t = t->next) count++;
+
+  while (count-- > 0 && ctx->completed_transfers) {
+    LVKW_X11Transfer *transfer = ctx->completed_transfers;
+    ctx->completed_transfers = transfer->next;
+    transfer->next = NULL;
+    _transfer_finish(ctx, transfer, true);
+  }
+}
+
+int _lvkw_x11_transfer_poll_timeout(const LVKW_Context_X11 *ctx, int poll_timeout) {
+  const LVKW_X11Transfer *transfer = ctx->transfers;
+  if (!transfer || !transfer->converting) return poll_timeout;
+
+  const uint64_t now = _lvkw_get_timestamp_ms();
+  const uint64_t remaining = (transfer->deadline_ms > now) ? transfer->deadline_ms - now : 0;
+  if (poll_timeout >= 0 && (uint64_t)poll_timeout <= remaining) return poll_timeout;
+  return (int)remaining;
+}
+
+// The window is going away: its transfers are dropped without DATA_READY.
+void _lvkw_x11_cancel_transfers(LVKW_Context_X11 *ctx, LVKW_Window_X11 *window) {
+  LVKW_X11Transfer *transfer = ctx->transfers;
+  while (transfer) {
+    LVKW_X11Transfer *next = transfer->next;
+    if (transfer->window == window) {
+      _transfer_unlink(ctx, transfer);
+      transfer->done = true;
+      transfer->failed = true;
+      if (!transfer->synchronous) {
+        if (transfer->buffer) lvkw_context_free(&ctx->linux_base.base, transfer->buffer);
+        lvkw_context_free(&ctx->linux_base.base, transfer);
+      }
+    }
+    transfer = next;
+  }
+  _transfer_start_next(ctx);
+
+  for (LVKW_X11Transfer **curr = &ctx->completed_transfers; *curr;) {
+    transfer = *curr;
+    if (transfer->window != window) {
+      curr = &transfer->next;
+      continue;
+    }
+    *curr = transfer->next;
+    if (transfer->buffer) lvkw_context_free(&ctx->linux_base.base, transfer->buffer);
+    lvkw_context_free(&ctx->linux_base.base, transfer);
+  }
+}
+
+// Converts the clipboard to target and waits for the result, which is left in out_transfer. The
+// caller frees out_transfer->buffer.
+static bool _clipboard_pull(LVKW_Window_X11 *window, Atom target, Atom fallback,
+                            LVKW_X11Transfer *out_transfer) {
+  LVKW_Context_X11 *ctx = (LVKW_Context_X11 *)window->base.prv.ctx_base;
+
+  memset(out_transfer, 0, sizeof(*out_transfer));
+  out_transfer->window = window;
+  out_transfer->target = target;
+  out_transfer->fallback = fallback;
+  out_transfer->synchronous = true;
+  _transfer_enqueue(ctx, out_transfer);
+
+  _lvkw_x11_wait_for_transfer(ctx, out_transfer);
+  if (!out_transfer->done) {
+    _transfer_unlink(ctx, out_transfer);
+    _transfer_start_next(ctx);
+    out_transfer->failed = true;
+  }
+  if (out_transfer->failed && out_transfer->buffer) {
+    lvkw_context_free(&ctx->linux_base.base, out_transfer->buffer);
+    out_transfer->buffer = NULL;
+    out_transfer->size = 0;
+  }
+  return !out_transfer->failed;
+}
+
+static bool _clipboard_is_text_mime(const char *mime_type) {
+  return strcmp(mime_type, "text/plain") == 0 || strcmp(mime_type, "text/plain;charset=utf-8") == 0;
+}
+
+// Maps a MIME type to the target to convert to, plus the one to retry with if the owner refuses.
+static bool _clipboard_resolve_target(LVKW_Context_X11 *ctx, const char *mime_type, Atom *out_target,
+                                      Atom *out_fallback) {
+  const bool is_text_request = _clipboard_is_text_mime(mime_type);
+  Atom x_target = lvkw_XInternAtom(ctx, ctx->display, mime_type, True);
+  if (x_target == None && is_text_request) x_target = ctx->utf8_string;
+
+  *out_target = x_target;
+  *out_fallback = (is_text_request && x_target != XA_STRING) ? XA_STRING : None;
+  return x_target != None;
+}
 
-  return false;
+static LVKW_X11ClipboardMime *_clipboard_find_owned_mime(LVKW_Context_X11 *ctx, const char *mime_type) {
+  LVKW_X11ClipboardMime *mime = _clipboard_find_owned_mime_by_type(ctx, mime_type);
+  if (!mime && strcmp(mime_type, "text/plain") == 0) {
+    mime = _clipboard_find_owned_mime_by_type(ctx, "text/plain;charset=utf-8");
+  }
+  return mime;
 }
 
 LVKW_Status lvkw_wnd_setClipboardText_X11(LVKW_Window *window, LVKW_DataExchangeTarget target, const char *text) {
@@ -852,7 +1148,7 @@ LVKW_Status lvkw_wnd_setClipboardData_X11(LVKW_Window *window, LVKW_DataExchange
   ctx->clipboard_read_cache_size = 0;
 
   LVKW_X11ClipboardMime *owned =
-      (LVKW_X11ClipboardMime *)lvkw_context_alloc(&ctx->linux_base.base, sizeof(*owned) * count);
+      (LVKW_X11ClipboardMime *)lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, sizeof(*owned) * count);
   if (!owned) return LVKW_ERROR;
   memset(owned, 0, sizeof(*owned) * count);
 
@@ -862,7 +1158,7 @@ LVKW_Status lvkw_wnd_setClipboardData_X11(LVKW_Window *window, LVKW_DataExchange
     owned[i].atom = lvkw_XInternAtom(ctx, ctx->display, owned[i].mime_type, False);
     owned[i].size = data[i].size;
     if (data[i].size > 0) {
-      owned[i].bytes = lvkw_context_alloc(&ctx->linux_base.base, data[i].size);
+      owned[i].bytes = lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, data[i].size);
       if (!owned[i].bytes) {
         for (uint32_t j = 0; j < i; ++j) lvkw_context_free(&ctx->linux_base.base, owned[j].bytes);
         lvkw_context_free(&ctx->linux_base.base, owned);
@@ -895,10 +1191,7 @@ LVKW_Status lvkw_wnd_getClipboardData_X11(LVKW_Window *window, LVKW_DataExchange
   ctx->clipboard_read_cache_size = 0;
 
   if (ctx->clipboard_owner_window == x11_window->window) {
-    LVKW_X11ClipboardMime *mime = _clipboard_find_owned_mime_by_type(ctx, mime_type);
-    if (!mime && strcmp(mime_type, "text/plain") == 0) {
-      mime = _clipboard_find_owned_mime_by_type(ctx, "text/plain;charset=utf-8");
-    }
+    LVKW_X11ClipboardMime *mime = _clipboard_find_owned_mime(ctx, mime_type);
     if (!mime) {
       LVKW_REPORT_WIND_DIAGNOSTIC(&x11_window->base, LVKW_DIAGNOSTIC_RESOURCE_UNAVAILABLE,
                                   "Requested MIME type is not available");
@@ -910,42 +1203,29 @@ LVKW_Status lvkw_wnd_getClipboardData_X11(LVKW_Window *window, LVKW_DataExchange
     return LVKW_SUCCESS;
   }
 
-  Atom x_target = lvkw_XInternAtom(ctx, ctx->display, mime_type, True);
-
-  Atom type = None;
-  int format = 0;
-  uint8_t *payload = NULL;
-  size_t payload_size = 0;
-  const bool is_text_request =
-      strcmp(mime_type, "text/plain") == 0 || strcmp(mime_type, "text/plain;charset=utf-8") == 0;
-
-  if (x_target == None && is_text_request) {
-    x_target = ctx->utf8_string;
-  }
-  if (x_target == None) {
+  Atom x_target = None;
+  Atom fallback = None;
+  if (!_clipboard_resolve_target(ctx, mime_type, &x_target, &fallback)) {
     LVKW_REPORT_WIND_DIAGNOSTIC(&x11_window->base, LVKW_DIAGNOSTIC_RESOURCE_UNAVAILABLE,
                                 "Requested MIME type is not available");
     return LVKW_ERROR;
   }
 
-  bool requested = _clipboard_request_target(x11_window, x_target, &type, &format, &payload, &payload_size);
-  if (!requested && is_text_request && x_target != XA_STRING) {
-    requested = _clipboard_request_target(x11_window, XA_STRING, &type, &format, &payload, &payload_size);
-  }
-  if (!requested) {
+  LVKW_X11Transfer transfer;
+  if (!_clipboard_pull(x11_window, x_target, fallback, &transfer)) {
     LVKW_REPORT_WIND_DIAGNOSTIC(&x11_window->base, LVKW_DIAGNOSTIC_RESOURCE_UNAVAILABLE,
                                 "Clipboard transfer failed");
     return LVKW_ERROR;
   }
-  if (format != 8 || !payload) {
-    if (payload) lvkw_XFree(ctx, payload);
+  if (transfer.format != 8) {
+    if (transfer.buffer) lvkw_context_free(&ctx->linux_base.base, transfer.buffer);
     LVKW_REPORT_WIND_DIAGNOSTIC(&x11_window->base, LVKW_DIAGNOSTIC_RESOURCE_UNAVAILABLE,
                                 "Clipboard payload format unsupported");
     return LVKW_ERROR;
   }
 
-  bool ok = _clipboard_copy_into_read_cache(ctx, payload, payload_size, false);
-  lvkw_XFree(ctx, payload);
+  bool ok = _clipboard_copy_into_read_cache(ctx, transfer.buffer, transfer.size, false);
+  lvkw_context_free(&ctx->linux_base.base, transfer.buffer);
   if (!ok) return LVKW_ERROR;
   *out_data = ctx->clipboard_read_cache;
   *out_size = ctx->clipboard_read_cache_size;
@@ -968,7 +1248,7 @@ LVKW_Status lvkw_wnd_getClipboardMimeTypes_X11(LVKW_Window *window, LVKW_DataExc
       return LVKW_SUCCESS;
     }
 
-    const char **list = (const char **)lvkw_context_alloc(&ctx->linux_base.base, sizeof(char *) * n);
+    const char **list = (const char **)lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, sizeof(char *) * n);
     if (!list && n > 0) return LVKW_ERROR;
     for (uint32_t i = 0; i < n; ++i) list[i] = ctx->clipboard_owned_mimes[i].mime_type;
     ctx->clipboard_mime_query_ptr = list;
@@ -978,28 +1258,25 @@ LVKW_Status lvkw_wnd_getClipboardMimeTypes_X11(LVKW_Window *window, LVKW_DataExc
     return LVKW_SUCCESS;
   }
 
-  Atom type = None;
-  int format = 0;
-  uint8_t *payload = NULL;
-  size_t payload_size = 0;
-  if (!_clipboard_request_target(x11_window, ctx->targets, &type, &format, &payload, &payload_size)) {
+  LVKW_X11Transfer transfer;
+  if (!_clipboard_pull(x11_window, ctx->targets, None, &transfer)) {
     LVKW_REPORT_WIND_DIAGNOSTIC(&x11_window->base, LVKW_DIAGNOSTIC_RESOURCE_UNAVAILABLE,
                                 "Clipboard TARGETS query failed");
     return LVKW_ERROR;
   }
-  if (type != XA_ATOM || format != 32 || !payload || payload_size == 0) {
-    if (payload) lvkw_XFree(ctx, payload);
+  if (transfer.type != XA_ATOM || transfer.format != 32 || transfer.size == 0) {
+    if (transfer.buffer) lvkw_context_free(&ctx->linux_base.base, transfer.buffer);
     LVKW_REPORT_WIND_DIAGNOSTIC(&x11_window->base, LVKW_DIAGNOSTIC_RESOURCE_UNAVAILABLE,
                                 "Clipboard TARGETS payload invalid");
     return LVKW_ERROR;
   }
 
-  const uint32_t atom_count = (uint32_t)(payload_size / sizeof(Atom));
-  const Atom *atoms = (const Atom *)payload;
+  const uint32_t atom_count = (uint32_t)(transfer.size / sizeof(Atom));
+  const Atom *atoms = (const Atom *)transfer.buffer;
   const uint32_t capacity = atom_count + 2u; // text aliases can expand a single X atom into two API MIME names.
-  const char **list = (const char **)lvkw_context_alloc(&ctx->linux_base.base, sizeof(char *) * capacity);
+  const char **list = (const char **)lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_CLIPBOARD, sizeof(char *) * capacity);
   if (!list && atom_count > 0) {
-    lvkw_XFree(ctx, payload);
+    lvkw_context_free(&ctx->linux_base.base, transfer.buffer);
     return LVKW_ERROR;
   }
 
@@ -1008,7 +1285,7 @@ LVKW_Status lvkw_wnd_getClipboardMimeTypes_X11(LVKW_Window *window, LVKW_DataExc
     if (atoms[i] == ctx->targets) continue;
     if (atoms[i] == ctx->utf8_string) {
       if (!_clipboard_append_mime_unique(ctx, list, capacity, &out, "text/plain;charset=utf-8")) {
-        lvkw_XFree(ctx, payload);
+        lvkw_context_free(&ctx->linux_base.base, transfer.buffer);
         lvkw_context_free(&ctx->linux_base.base, (void *)list);
         return LVKW_ERROR;
       }
@@ -1016,7 +1293,7 @@ LVKW_Status lvkw_wnd_getClipboardMimeTypes_X11(LVKW_Window *window, LVKW_DataExc
     }
     if (atoms[i] == ctx->text_atom || atoms[i] == XA_STRING) {
       if (!_clipboard_append_mime_unique(ctx, list, capacity, &out, "text/plain")) {
-        lvkw_XFree(ctx, payload);
+        lvkw_context_free(&ctx->linux_base.base, transfer.buffer);
         lvkw_context_free(&ctx->linux_base.base, (void *)list);
         return LVKW_ERROR;
       }
@@ -1027,13 +1304,13 @@ LVKW_Status lvkw_wnd_getClipboardMimeTypes_X11(LVKW_Window *window, LVKW_DataExc
     if (!name) continue;
     if (!_clipboard_append_mime_unique(ctx, list, capacity, &out, name)) {
       lvkw_XFree(ctx, name);
-      lvkw_XFree(ctx, payload);
+      lvkw_context_free(&ctx->linux_base.base, transfer.buffer);
       lvkw_context_free(&ctx->linux_base.base, (void *)list);
       return LVKW_ERROR;
     }
     lvkw_XFree(ctx, name);
   }
-  lvkw_XFree(ctx, payload);
+  lvkw_context_free(&ctx->linux_base.base, transfer.buffer);
 
   if (!out_mime_types) {
     *count = out;
@@ -1048,6 +1325,63 @@ LVKW_Status lvkw_wnd_getClipboardMimeTypes_X11(LVKW_Window *window, LVKW_DataExc
   return LVKW_SUCCESS;
 }
 
+LVKW_Status lvkw_wnd_pullTextAsync_X11(LVKW_Window *window, LVKW_DataExchangeTarget target, void *user_tag) {
+  return lvkw_wnd_pullDataAsync_X11(window, target, "text/plain;charset=utf-8", user_tag);
+}
+
+LVKW_Status lvkw_wnd_pullDataAsync_X11(LVKW_Window *window, LVKW_DataExchangeTarget target, const char *mime_type,
+                                       void *user_tag) {
+  LVKW_API_VALIDATE(data_pullDataAsync, window, target, mime_type, user_tag);
+  LVKW_Window_X11 *x11_window = (LVKW_Window_X11 *)window;
+  LVKW_Context_X11 *ctx = (LVKW_Context_X11 *)x11_window->base.prv.ctx_base;
+  const char *interned =
+      _lvkw_string_cache_intern(&ctx->linux_base.base.prv.string_cache, &ctx->linux_base.base, mime_type);
+
+  // Our own data does not need a round trip through the server. It is copied now, as the app may
+  // replace the clipboard before the next pump delivers it.
+  const bool owned = ctx->clipboard_owner_window == x11_window->window;
+  LVKW_X11ClipboardMime *mime = NULL;
+  Atom x_target = None;
+  Atom fallback = None;
+  if (owned) {
+    mime = _clipboard_find_owned_mime(ctx, mime_type);
+    if (!mime) return LVKW_ERROR;
+  }
+  else if (!_clipboard_resolve_target(ctx, mime_type, &x_target, &fallback)) {
+    return LVKW_ERROR;
+  }
+
+  LVKW_X11Transfer *transfer =
+      lvkw_context_alloc_tagged(&ctx->linux_base.base, LVKW_MEMORY_TAG_TRANSFERS, sizeof(LVKW_X11Transfer));
+  if (!transfer) return LVKW_ERROR;
+
+  memset(transfer, 0, sizeof(*transfer));
+  transfer->window = x11_window;
+  transfer->target = x_target;
+  transfer->fallback = fallback;
+  transfer->exchange_target = target;
+  transfer->mime_type = interned;
+  transfer->user_tag = user_tag;
+
+  if (!owned) {
+    _transfer_enqueue(ctx, transfer);
+    return LVKW_SUCCESS;
+  }
+
+  if (!_transfer_reserve(ctx, transfer, mime->size)) {
+    lvkw_context_free(&ctx->linux_base.base, transfer);
+    return LVKW_ERROR;
+  }
+  if (mime->size > 0) memcpy(transfer->buffer, mime->bytes, mime->size);
+  transfer->size = mime->size;
+  transfer->format = 8;
+
+  LVKW_X11Transfer **tail = &ctx->completed_transfers;
+  while (*tail) tail = &(*tail)->next;
+  *tail = transfer;
+  return LVKW_SUCCESS;
+}
+
 LVKW_Status lvkw_ctx_getStandardCursor_X11(LVKW_Context *ctx_handle, LVKW_CursorShape shape,
                                            LVKW_Cursor **out_cursor) {
   LVKW_Context_X11 *ctx = (LVKW_Context_X11 *)ctx_handle;
@@ -1158,7 +1492,8 @@ LVKW_Status lvkw_ctx_createCursor_X11(LVKW_Context *ctx_handle, const LVKW_Curso
 
   if (cursor_id == None) return LVKW_ERROR;
 
-  LVKW_Cursor_Base *cursor = (LVKW_Cursor_Base *)_ctx_alloc(ctx, sizeof(LVKW_Cursor_Base));
+  LVKW_Cursor_Base *cursor = (LVKW_Cursor_Base *)lvkw_context_alloc_tagged(
+      &ctx->linux_base.base, LVKW_MEMORY_TAG_CURSORS, sizeof(LVKW_Cursor_Base));
   if (!cursor) {
     lvkw_XFreeCursor(ctx, ctx->display, cursor_id);
     return LVKW_ERROR;
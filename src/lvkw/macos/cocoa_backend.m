@@ -418,9 +418,19 @@ LVKW_Status lvkw_ctx_createWindow_Cocoa(LVKW_Context *ctx_handle, const LVKW_Win
   window->layer = (CAMetalLayer *)[window->view layer];
   
   [window->window setContentView:window->view];
-  [window->window makeKeyAndOrderFront:nil];
 
-  _lvkw_window_list_add(&ctx->base, &window->base);
+  if (!_lvkw_window_list_add(&ctx->base, &window->base, (uintptr_t)(__bridge void *)window->window)) {
+    [window->window setDelegate:nil];
+    [delegate release];
+    [window->window setContentView:nil];
+    [window->view release];
+    [window->window close];
+    [window->window release];
+    lvkw_context_free(&ctx->base, window);
+    return LVKW_ERROR;
+  }
+
+  [window->window makeKeyAndOrderFront:nil];
 
   window->base.pub.flags |= LVKW_WINDOW_STATE_READY;
   // Push Window Ready event
@@ -19,6 +19,14 @@ uint64_t _lvkw_get_timestamp_ms(void) {
   return (mach_absolute_time() * timebase.numer / timebase.denom) / 1000000;
 }
 
+uint64_t _lvkw_get_timestamp_ns(void) {
+  static mach_timebase_info_data_t timebase;
+  if (timebase.denom == 0) {
+    mach_timebase_info(&timebase);
+  }
+  return mach_absolute_time() * timebase.numer / timebase.denom;
+}
+
 LVKW_Status _lvkw_createContext_impl(const LVKW_ContextCreateInfo *create_info, LVKW_Context **out_ctx_handle) {
   if (create_info->backend != LVKW_BACKEND_AUTO && create_info->backend != LVKW_BACKEND_COCOA) {
     LVKW_REPORT_BOOTSTRAP_DIAGNOSTIC(create_info, LVKW_DIAGNOSTIC_BACKEND_UNAVAILABLE,
@@ -81,16 +89,7 @@ LVKW_Status lvkw_instrumentation_getMetrics(LVKW_Context *ctx, LVKW_MetricsCateg
 
 LVKW_Status lvkw_ctx_getMetrics_Cocoa(LVKW_Context *ctx, LVKW_MetricsCategory category, void *out_data,
                                          bool reset) {
-  (void)ctx;
-  (void)category;
-  (void)reset;
-
-  if (category == LVKW_METRICS_CATEGORY_EVENTS) {
-    memset(out_data, 0, sizeof(LVKW_EventMetrics));
-    return LVKW_SUCCESS;
-  }
-
-  return LVKW_ERROR;
+  return _lvkw_context_get_base_metrics((LVKW_Context_Base *)ctx, category, out_data, reset);
 }
 
 LVKW_Status lvkw_display_createWindow(LVKW_Context *ctx_handle, const LVKW_WindowCreateInfo *create_info,
@@ -124,6 +123,12 @@ LVKW_Status lvkw_display_requestWindowFocus(LVKW_Window *window_handle) {
   return lvkw_wnd_requestFocus_Cocoa(window_handle);
 }
 
+LVKW_Status lvkw_display_ackWindowResize(LVKW_Window *window_handle) {
+  LVKW_API_VALIDATE(wnd_ackResize, window_handle);
+  // AppKit drives live resizes from the app's own drawing.
+  return LVKW_SUCCESS;
+}
+
 LVKW_Status lvkw_data_setClipboardText(LVKW_Window *window, const char *text) {
   return lvkw_data_pushText(window, LVKW_DATA_EXCHANGE_TARGET_CLIPBOARD, text);
 }
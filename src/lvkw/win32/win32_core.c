@@ -9,6 +9,18 @@ uint64_t _lvkw_get_timestamp_ms(void) {
   return GetTickCount64();
 }
 
+uint64_t _lvkw_get_timestamp_ns(void) {
+  static LARGE_INTEGER frequency;
+  if (frequency.QuadPart == 0) {
+    QueryPerformanceFrequency(&frequency);
+  }
+  LARGE_INTEGER counter;
+  QueryPerformanceCounter(&counter);
+  uint64_t ticks = (uint64_t)counter.QuadPart;
+  uint64_t freq = (uint64_t)frequency.QuadPart;
+  return (ticks / freq) * 1000000000ull + ((ticks % freq) * 1000000000ull) / freq;
+}
+
 void lvkw_ctx_assertThread_Win32(LVKW_Context *ctx_handle) {
   (void)ctx_handle;
 }
@@ -73,16 +73,7 @@ LVKW_Status lvkw_instrumentation_getMetrics(LVKW_Context *ctx, LVKW_MetricsCateg
 
 LVKW_Status lvkw_ctx_getMetrics_Win32(LVKW_Context *ctx, LVKW_MetricsCategory category, void *out_data,
                                          bool reset) {
-  (void)ctx;
-  (void)category;
-  (void)reset;
-  
-  if (category == LVKW_METRICS_CATEGORY_EVENTS) {
-    memset(out_data, 0, sizeof(LVKW_EventMetrics));
-    return LVKW_SUCCESS;
-  }
-
-  return LVKW_ERROR;
+  return _lvkw_context_get_base_metrics((LVKW_Context_Base *)ctx, category, out_data, reset);
 }
 
 LVKW_Status lvkw_display_createWindow(LVKW_Context *ctx_handle, const LVKW_WindowCreateInfo *create_info,
@@ -117,6 +108,12 @@ LVKW_Status lvkw_display_requestWindowFocus(LVKW_Window *window_handle) {
   return lvkw_wnd_requestFocus_Win32(window_handle);
 }
 
+LVKW_Status lvkw_display_ackWindowResize(LVKW_Window *window_handle) {
+  LVKW_VALIDATE(wnd_ackResize, window_handle);
+  // The modal size-move loop already waits on WM_SIZE handling.
+  return LVKW_SUCCESS;
+}
+
 LVKW_Status lvkw_data_setClipboardText(LVKW_Window *window, const char *text) {
   return lvkw_data_pushText(window, LVKW_DATA_EXCHANGE_TARGET_CLIPBOARD, text);
 }
@@ -13,6 +13,7 @@ App::App(lvkw::Window &window, VkInstance instance, VkPhysicalDevice physical_de
   event_log_module_ = std::make_unique<EventLogModule>();
   clipboard_module_ = std::make_unique<ClipboardModule>();
   dnd_module_ = std::make_unique<DndModule>();
+  latency_module_ = std::make_unique<LatencyModule>();
   window_module_ = std::make_unique<WindowModule>(window, instance, physical_device, device, queue_family, queue, descriptor_pool);
 }
 
@@ -198,6 +199,7 @@ void App::onEvent(LVKW_EventType type, LVKW_Window* window, const LVKW_Event& ev
     clipboard_module_->onEvent(type, window, event);
     dnd_module_->onEvent(type, window, event);
     window_module_->onEvent(type, window, event);
+    latency_module_->onEvent(type, window, event);
     event_log_module_->onEvent(type, window, event, event_module_->getBaseMask());
 }
 
@@ -227,10 +229,12 @@ AppStatus App::update(lvkw::Context &ctx, lvkw::Window &window, ImGuiIO &io) {
   clipboard_module_->update(ctx, window);
   dnd_module_->update(ctx, window);
   window_module_->update(ctx, window);
+  latency_module_->update(ctx, window);
 
   updateCursor(ctx, window, io);
   
   if (metrics_module_->consumeRecreationRequest(recreate_info_)) {
+      latency_module_->onContextDestroying();
       return AppStatus::RECREATE_CONTEXT;
   }
 
@@ -255,6 +259,7 @@ void App::renderUi(lvkw::Context &ctx, lvkw::Window &window, const ImGuiIO &io)
     ImGui::Checkbox(clipboard_module_->getName(), &clipboard_module_->getEnabled());
     ImGui::Checkbox(dnd_module_->getName(), &dnd_module_->getEnabled());
     ImGui::Checkbox(window_module_->getName(), &window_module_->getEnabled());
+    ImGui::Checkbox(latency_module_->getName(), &latency_module_->getEnabled());
 
     ImGui::End();
   }
@@ -269,6 +274,11 @@ void App::renderUi(lvkw::Context &ctx, lvkw::Window &window, const ImGuiIO &io)
   if (clipboard_module_->getEnabled()) clipboard_module_->render(ctx, window);
   if (dnd_module_->getEnabled()) dnd_module_->render(ctx, window);
   if (window_module_->getEnabled()) window_module_->render(ctx, window);
+  if (latency_module_->getEnabled()) latency_module_->render(ctx, window);
+}
+
+void App::onFramePresented(uint64_t present_ns) {
+  latency_module_->onFramePresented(present_ns);
 }
 
 void App::onContextRecreated(lvkw::Context &ctx, lvkw::Window &window) {
@@ -283,6 +293,7 @@ void App::onContextRecreated(lvkw::Context &ctx, lvkw::Window &window) {
   clipboard_module_->onContextRecreated(ctx, window);
   dnd_module_->onContextRecreated(ctx, window);
   window_module_->onContextRecreated(ctx, window);
+  latency_module_->onContextRecreated(ctx, window);
 
   current_cursor_mode_ = LVKW_CURSOR_NORMAL;
   current_cursor_ = nullptr;
@@ -13,6 +13,7 @@
 #include "modules/event_log_module.hpp"
 #include "modules/clipboard_module.hpp"
 #include "modules/dnd_module.hpp"
+#include "modules/latency_module.hpp"
 #include <vector>
 #include <memory>
 #include <vulkan/vulkan.h>
@@ -31,6 +32,7 @@ public:
   void onContextRecreated(lvkw::Context &ctx, lvkw::Window &window);
 
   void onEvent(LVKW_EventType type, LVKW_Window* window, const LVKW_Event& event);
+  void onFramePresented(uint64_t present_ns);
 
   ImVec4 getClearColor() const { return clear_color_; }
   const ContextRecreateInfo& getRecreateInfo() const { return recreate_info_; }
@@ -48,6 +50,7 @@ private:
   std::unique_ptr<EventLogModule> event_log_module_;
   std::unique_ptr<ClipboardModule> clipboard_module_;
   std::unique_ptr<DndModule> dnd_module_;
+  std::unique_ptr<LatencyModule> latency_module_;
 
   ContextRecreateInfo recreate_info_;
 
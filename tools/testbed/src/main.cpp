@@ -367,9 +367,10 @@ static void FrameRender(ImGui_ImplVulkanH_Window *wd, ImDrawData *draw_data) {
   }
 }
 
-static void FramePresent(ImGui_ImplVulkanH_Window *wd) {
+// Returns true if the frame was handed to the presentation engine.
+static bool FramePresent(ImGui_ImplVulkanH_Window *wd) {
   if (g_SwapChainRebuild)
-    return;
+    return false;
   VkSemaphore render_complete_semaphore =
       wd->FrameSemaphores[wd->FrameIndex].RenderCompleteSemaphore;
   VkPresentInfoKHR info = {};
@@ -383,12 +384,13 @@ static void FramePresent(ImGui_ImplVulkanH_Window *wd) {
   if (err == VK_ERROR_OUT_OF_DATE_KHR || err == VK_SUBOPTIMAL_KHR)
     g_SwapChainRebuild = true;
   if (err == VK_ERROR_OUT_OF_DATE_KHR)
-    return;
+    return false;
   if (err != VK_SUBOPTIMAL_KHR)
     check_vk_result(err);
   wd->SemaphoreIndex =
       (wd->SemaphoreIndex + 1) %
       wd->SemaphoreCount; // Now we can use the next set of semaphores
+  return true;
 }
 
 // Main code
@@ -595,7 +597,10 @@ int main(int, char **) {
       wd->ClearValue.color.float32[2] = clear_color.z * clear_color.w;
       wd->ClearValue.color.float32[3] = clear_color.w;
       FrameRender(wd, draw_data);
-      FramePresent(wd);
+      if (FramePresent(wd)) {
+        app.onFramePresented(lvkw_instrumentation_getTimestamp());
+        window.ackResize();
+      }
     }
   }
 
@@ -41,6 +41,7 @@ void EventLogModule::onEvent(LVKW_EventType type, LVKW_Window* win, const LVKW_E
         case LVKW_EVENT_TYPE_KEY:
             ss << "Key: " << (int)e.key.key << " State: " << (e.key.state == LVKW_BUTTON_STATE_PRESSED ? "PR" : "RE")
                 << " Mods: " << formatModifiers(e.key.modifiers);
+            if (e.key.repeat) ss << " (repeat)";
             break;
         case LVKW_EVENT_TYPE_MOUSE_MOTION:
             ss << "Pos: (" << e.mouse_motion.position.x << "," << e.mouse_motion.position.y << ")"
@@ -52,10 +53,15 @@ void EventLogModule::onEvent(LVKW_EventType type, LVKW_Window* win, const LVKW_E
                 << " Mods: " << formatModifiers(e.mouse_button.modifiers);
             break;
         case LVKW_EVENT_TYPE_MOUSE_SCROLL:
-            ss << "Delta: (" << e.mouse_scroll.delta.x << "," << e.mouse_scroll.delta.y << ")";
+            ss << "Delta: (" << e.mouse_scroll.delta.x << "," << e.mouse_scroll.delta.y << ")"
+                << " v120: (" << e.mouse_scroll.value120.x << "," << e.mouse_scroll.value120.y << ")"
+                << " Src: " << (int)e.mouse_scroll.source;
+            if (e.mouse_scroll.flags & LVKW_SCROLL_STOP_X) ss << " (stop x)";
+            if (e.mouse_scroll.flags & LVKW_SCROLL_STOP_Y) ss << " (stop y)";
             break;
         case LVKW_EVENT_TYPE_TEXT_INPUT:
             ss << "Text: '" << (e.text_input.text ? e.text_input.text : "") << "' Len: " << e.text_input.length;
+            if (e.text_input.repeat) ss << " (repeat)";
             break;
         case LVKW_EVENT_TYPE_TEXT_COMPOSITION:
             ss << "Preedit: '" << (e.text_composition.text ? e.text_composition.text : "") << "' Cursor: " << e.text_composition.cursor_index;
@@ -66,6 +72,40 @@ void EventLogModule::onEvent(LVKW_EventType type, LVKW_Window* win, const LVKW_E
         case LVKW_EVENT_TYPE_WINDOW_MAXIMIZED:
             ss << "Maximized: " << (e.maximized.maximized ? "YES" : "NO");
             break;
+        case LVKW_EVENT_TYPE_FRAME:
+            ss << "Frame time: " << e.frame.timestamp_ns << " ns";
+            break;
+        case LVKW_EVENT_TYPE_PRESENTATION:
+            if (e.presentation.flags & LVKW_PRESENTATION_DISCARDED) {
+                ss << "Discarded";
+            } else {
+                ss << "Presented: " << e.presentation.present_ns << " ns Seq: " << e.presentation.sequence
+                   << " Refresh: " << e.presentation.refresh_ns << " ns"
+                   << ((e.presentation.flags & LVKW_PRESENTATION_VSYNC) ? " vsync" : "")
+                   << ((e.presentation.flags & LVKW_PRESENTATION_HW_CLOCK) ? " hw-clock" : "")
+                   << ((e.presentation.flags & LVKW_PRESENTATION_HW_COMPLETION) ? " hw-completion" : "")
+                   << ((e.presentation.flags & LVKW_PRESENTATION_ZERO_COPY) ? " zero-copy" : "");
+            }
+            break;
+        case LVKW_EVENT_TYPE_TOUCH:
+            ss << "Contacts: " << e.touch.contact_count;
+            for (uint32_t i = 0; i < e.touch.contact_count; ++i) {
+                static const char* kStates[] = {"down", "move", "up", "cancel"};
+                const LVKW_TouchContact& c = e.touch.contacts[i];
+                ss << " [" << c.id << " " << kStates[c.state & 3] << " (" << c.position.x << "," << c.position.y << ")]";
+            }
+            break;
+        case LVKW_EVENT_TYPE_PEN:
+            ss << "Tool: " << e.pen.tool << " Samples: " << e.pen.sample_count;
+            if (e.pen.sample_count > 0) {
+                const LVKW_PenSample& s = e.pen.samples[e.pen.sample_count - 1];
+                ss << " Last: (" << s.position.x << "," << s.position.y << ") P: " << s.pressure
+                   << " Tilt: (" << s.tilt.x << "," << s.tilt.y << ") Btn: " << s.buttons
+                   << ((s.flags & LVKW_PEN_SAMPLE_DOWN) ? " down" : "")
+                   << ((s.flags & LVKW_PEN_SAMPLE_PROXIMITY_IN) ? " in" : "")
+                   << ((s.flags & LVKW_PEN_SAMPLE_PROXIMITY_OUT) ? " out" : "");
+            }
+            break;
         case LVKW_EVENT_TYPE_MONITOR_CONNECTION:
             ss << "Monitor: " << (void*)e.monitor_connection.monitor_ref << " Connected: " << (e.monitor_connection.connected ? "YES" : "NO");
             break;
@@ -207,6 +247,10 @@ const char* EventLogModule::typeToString(LVKW_EventType type) {
         case LVKW_EVENT_TYPE_DND_LEAVE: return "DND_LEAVE";
         case LVKW_EVENT_TYPE_DND_DROP: return "DND_DROP";
         case LVKW_EVENT_TYPE_TEXT_COMPOSITION: return "TEXT_COMPOSITION";
+        case LVKW_EVENT_TYPE_FRAME: return "FRAME";
+        case LVKW_EVENT_TYPE_PRESENTATION: return "PRESENTATION";
+        case LVKW_EVENT_TYPE_TOUCH: return "TOUCH";
+        case LVKW_EVENT_TYPE_PEN: return "PEN";
 #ifdef LVKW_ENABLE_CONTROLLER
         case LVKW_EVENT_TYPE_CONTROLLER_CONNECTION: return "CONTROLLER_CONNECTION";
 #endif
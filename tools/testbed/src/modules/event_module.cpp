@@ -29,6 +29,10 @@ static const char *getShortName(LVKW_EventType type) {
   case LVKW_EVENT_TYPE_DND_LEAVE: return "DnD Leav";
   case LVKW_EVENT_TYPE_DND_DROP: return "DnD Drop";
   case LVKW_EVENT_TYPE_TEXT_COMPOSITION: return "Compose";
+  case LVKW_EVENT_TYPE_FRAME: return "Frame";
+  case LVKW_EVENT_TYPE_PRESENTATION: return "Present";
+  case LVKW_EVENT_TYPE_TOUCH: return "Touch";
+  case LVKW_EVENT_TYPE_PEN: return "Pen";
 #ifdef LVKW_ENABLE_CONTROLLER
   case LVKW_EVENT_TYPE_CONTROLLER_CONNECTION: return "CtrlConn";
 #endif
@@ -59,6 +63,10 @@ EventModule::EventModule() {
       {LVKW_EVENT_TYPE_DND_LEAVE, true},
       {LVKW_EVENT_TYPE_DND_DROP, true},
       {LVKW_EVENT_TYPE_TEXT_COMPOSITION, true},
+      {LVKW_EVENT_TYPE_FRAME, true},
+      {LVKW_EVENT_TYPE_PRESENTATION, true},
+      {LVKW_EVENT_TYPE_TOUCH, true},
+      {LVKW_EVENT_TYPE_PEN, true},
 #ifdef LVKW_ENABLE_CONTROLLER
       {LVKW_EVENT_TYPE_CONTROLLER_CONNECTION, true},
 #endif
@@ -148,7 +156,9 @@ void EventModule::render(lvkw::Context &ctx, lvkw::Window &window) {
             LVKW_EVENT_TYPE_WINDOW_RESIZED,
             LVKW_EVENT_TYPE_WINDOW_READY,
             LVKW_EVENT_TYPE_WINDOW_MAXIMIZED,
-            LVKW_EVENT_TYPE_FOCUS
+            LVKW_EVENT_TYPE_FOCUS,
+            LVKW_EVENT_TYPE_FRAME,
+            LVKW_EVENT_TYPE_PRESENTATION
         }},
         {"Keyboard", {
             LVKW_EVENT_TYPE_KEY,
@@ -158,7 +168,9 @@ void EventModule::render(lvkw::Context &ctx, lvkw::Window &window) {
         {"Mouse", {
             LVKW_EVENT_TYPE_MOUSE_MOTION,
             LVKW_EVENT_TYPE_MOUSE_BUTTON,
-            LVKW_EVENT_TYPE_MOUSE_SCROLL
+            LVKW_EVENT_TYPE_MOUSE_SCROLL,
+            LVKW_EVENT_TYPE_TOUCH,
+            LVKW_EVENT_TYPE_PEN
         }},
         {"Monitor & Sys", {
             LVKW_EVENT_TYPE_MONITOR_CONNECTION,
@@ -0,0 +1,386 @@
+#include "latency_module.hpp"
+#include "imgui.h"
+#include "lvkw/c/instrumentation.h"
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cstdio>
+
+static float nsToMs(uint64_t ns) { return static_cast<float>(static_cast<double>(ns) / 1.0e6); }
+
+static bool isInputEvent(LVKW_EventType type, bool include_motion) {
+    switch (type) {
+      case LVKW_EVENT_TYPE_KEY:
+      case LVKW_EVENT_TYPE_MOUSE_BUTTON:
+      case LVKW_EVENT_TYPE_MOUSE_SCROLL:
+        return true;
+      case LVKW_EVENT_TYPE_MOUSE_MOTION:
+        return include_motion;
+      default:
+        return false;
+    }
+}
+
+/* --- LatencyHistogram --- */
+
+void LatencyHistogram::add(float ms) {
+    samples_.push_back(ms);
+    if (samples_.size() > kMaxSamples) {
+        samples_.pop_front();
+    }
+}
+
+void LatencyHistogram::clear() { samples_.clear(); }
+
+float LatencyHistogram::percentile(float p) const {
+    if (samples_.empty()) return 0.0f;
+    std::vector<float> sorted(samples_.begin(), samples_.end());
+    size_t idx = static_cast<size_t>(p * static_cast<float>(sorted.size() - 1));
+    std::nth_element(sorted.begin(), sorted.begin() + idx, sorted.end());
+    return sorted[idx];
+}
+
+float LatencyHistogram::max() const {
+    if (samples_.empty()) return 0.0f;
+    return *std::max_element(samples_.begin(), samples_.end());
+}
+
+const std::vector<float> &LatencyHistogram::bins(float range_ms, int bin_count) {
+    bins_.assign(static_cast<size_t>(bin_count), 0.0f);
+    const float bin_width = range_ms / static_cast<float>(bin_count);
+    for (float ms : samples_) {
+        int bin = static_cast<int>(ms / bin_width);
+        if (bin < 0) bin = 0;
+        if (bin >= bin_count) bin = bin_count - 1;
+        bins_[static_cast<size_t>(bin)] += 1.0f;
+    }
+    return bins_;
+}
+
+/* --- LatencyModule --- */
+
+LatencyModule::~LatencyModule() { stopStorm(); }
+
+void LatencyModule::onEvent(LVKW_EventType type, LVKW_Window *window, const LVKW_Event &event) {
+    (void)window;
+    (void)event;
+    if (!enabled_ || !ctx_handle_) return;
+
+    const uint64_t event_ns = ctx_handle_->event_timestamp_ns;
+    const uint64_t now_ns = lvkw_instrumentation_getTimestamp();
+
+    if (type == LVKW_EVENT_TYPE_PRESENTATION) {
+        onPresentation(event.presentation);
+        return;
+    }
+
+    if (type == kStormEventType) {
+        storm_received_++;
+        if (event_ns != 0 && now_ns >= event_ns) {
+            storm_at_callback_.add(nsToMs(now_ns - event_ns));
+        }
+        return;
+    }
+
+    if (!isInputEvent(type, include_motion_)) return;
+
+    if (event_ns == 0 || now_ns < event_ns) {
+        untimed_inputs_++;
+        return;
+    }
+
+    at_callback_.add(nsToMs(now_ns - event_ns));
+    pending_inputs_.push_back(event_ns);
+}
+
+void LatencyModule::onFramePresented(uint64_t present_ns) {
+    if (last_present_ns_ != 0 && enabled_) {
+        present_interval_.add(nsToMs(present_ns - last_present_ns_));
+    }
+    last_present_ns_ = present_ns;
+
+    for (uint64_t event_ns : pending_inputs_) {
+        if (present_ns >= event_ns) {
+            at_present_.add(nsToMs(present_ns - event_ns));
+        }
+    }
+
+    if (enabled_) {
+        in_flight_.push_back({present_ns, std::move(pending_inputs_)});
+        if (in_flight_.size() > kMaxInFlightFrames) {
+            in_flight_.pop_front();
+        }
+    }
+    pending_inputs_.clear();
+}
+
+void LatencyModule::onPresentation(const LVKW_PresentationEvent &presentation) {
+    if (presentation.flags & LVKW_PRESENTATION_DISCARDED) {
+        discarded_frames_++;
+        if (!in_flight_.empty()) in_flight_.pop_front();
+        return;
+    }
+    presented_frames_++;
+
+    // Feedback isn't requested for every present. Attribute the report to the latest
+    // frame submitted before it, and drop the older, unreported ones.
+    const InFlightFrame *shown = nullptr;
+    size_t consumed = 0;
+    for (const InFlightFrame &frame : in_flight_) {
+        if (frame.present_call_ns > presentation.present_ns) break;
+        shown = &frame;
+        consumed++;
+    }
+    if (!shown) return;
+
+    present_to_photon_.add(nsToMs(presentation.present_ns - shown->present_call_ns));
+    for (uint64_t event_ns : shown->inputs) {
+        at_photon_.add(nsToMs(presentation.present_ns - event_ns));
+    }
+    in_flight_.erase(in_flight_.begin(), in_flight_.begin() + static_cast<std::ptrdiff_t>(consumed));
+}
+
+void LatencyModule::update(lvkw::Context &ctx, lvkw::Window &window) {
+    (void)window;
+    ctx_handle_ = ctx.get();
+
+    if (!enabled_) {
+        stopStorm();
+        pending_inputs_.clear();
+        in_flight_.clear();
+        return;
+    }
+
+    storm_rate_shared_.store(storm_rate_hz_, std::memory_order_relaxed);
+    storm_burst_shared_.store(storm_burst_, std::memory_order_relaxed);
+
+    try {
+        event_metrics_ = ctx.getMetrics<LVKW_EventMetrics>();
+        event_metrics_valid_ = true;
+    } catch (const lvkw::Exception &) {
+        event_metrics_valid_ = false;
+    }
+
+    try {
+        presentation_metrics_ = ctx.getMetrics<LVKW_PresentationMetrics>();
+        presentation_metrics_valid_ = true;
+    } catch (const lvkw::Exception &) {
+        presentation_metrics_valid_ = false;
+    }
+}
+
+void LatencyModule::onContextRecreated(lvkw::Context &ctx, lvkw::Window &window) {
+    (void)window;
+    ctx_handle_ = ctx.get();
+    pending_inputs_.clear();
+    in_flight_.clear();
+    last_present_ns_ = 0;
+}
+
+void LatencyModule::onContextDestroying() {
+    stopStorm();
+    ctx_handle_ = nullptr;
+}
+
+void LatencyModule::startStorm() {
+    if (storm_running_ || !ctx_handle_) return;
+    storm_posted_ = 0;
+    storm_rejected_ = 0;
+    storm_received_ = 0;
+    storm_at_callback_.clear();
+    storm_running_ = true;
+    storm_thread_ = std::thread(&LatencyModule::stormLoop, this, ctx_handle_);
+}
+
+void LatencyModule::stopStorm() {
+    storm_running_ = false;
+    if (storm_thread_.joinable()) {
+        storm_thread_.join();
+    }
+}
+
+void LatencyModule::stormLoop(LVKW_Context *ctx) {
+    using clock = std::chrono::steady_clock;
+    auto next = clock::now();
+
+    while (storm_running_.load(std::memory_order_relaxed)) {
+        const int rate = std::max(1, storm_rate_shared_.load(std::memory_order_relaxed));
+        const int burst = std::max(1, storm_burst_shared_.load(std::memory_order_relaxed));
+
+        for (int i = 0; i < burst; ++i) {
+            if (lvkw_events_post(ctx, kStormEventType, nullptr, nullptr) == LVKW_SUCCESS) {
+                storm_posted_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                storm_rejected_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        next += std::chrono::nanoseconds(1000000000ll * burst / rate);
+        const auto now = clock::now();
+        if (next < now) {
+            next = now;  // Falling behind: don't try to catch up with a giant burst.
+        }
+        std::this_thread::sleep_until(next);
+    }
+}
+
+void LatencyModule::render(lvkw::Context &ctx, lvkw::Window &window) {
+    (void)window;
+    if (!enabled_) return;
+
+    ImGui::SetNextWindowSize(ImVec2(640, 720), ImGuiCond_FirstUseEver);
+    if (!ImGui::Begin("Latency", &enabled_)) {
+        ImGui::End();
+        return;
+    }
+
+    if (ImGui::BeginTabBar("LatencyTabs")) {
+        if (ImGui::BeginTabItem("Input")) {
+            renderInputLatency();
+            ImGui::EndTabItem();
+        }
+        if (ImGui::BeginTabItem("Photon")) {
+            renderPhoton();
+            ImGui::EndTabItem();
+        }
+        if (ImGui::BeginTabItem("Event Storm")) {
+            renderStorm(ctx);
+            ImGui::EndTabItem();
+        }
+        ImGui::EndTabBar();
+    }
+
+    ImGui::End();
+}
+
+void LatencyModule::renderHistogram(const char *label, LatencyHistogram &histogram) {
+    constexpr int kBinCount = 100;
+
+    ImGui::Text("%s", label);
+    if (histogram.count() == 0) {
+        ImGui::TextDisabled("No samples yet.");
+        return;
+    }
+
+    char overlay[128];
+    std::snprintf(overlay, sizeof(overlay), "n=%zu  p50 %.2f  p95 %.2f  p99 %.2f  max %.2f ms",
+                  histogram.count(), histogram.percentile(0.50f), histogram.percentile(0.95f),
+                  histogram.percentile(0.99f), histogram.max());
+
+    const std::vector<float> &bins = histogram.bins(range_ms_, kBinCount);
+    ImGui::PushID(label);
+    ImGui::PlotHistogram("##hist", bins.data(), kBinCount, 0, overlay, 0.0f, FLT_MAX,
+                         ImVec2(-1.0f, 120.0f));
+    ImGui::PopID();
+}
+
+void LatencyModule::renderInputLatency() {
+    ImGui::TextWrapped("Input age is measured from the OS timestamp of each event "
+                       "(LVKW_Context::event_timestamp_ns).");
+
+    ImGui::Checkbox("Include mouse motion", &include_motion_);
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(200.0f);
+    ImGui::SliderFloat("Range (ms)", &range_ms_, 5.0f, 200.0f, "%.0f");
+    ImGui::SameLine();
+    if (ImGui::Button("Reset")) {
+        at_callback_.clear();
+        at_present_.clear();
+        present_interval_.clear();
+        untimed_inputs_ = 0;
+    }
+
+    if (untimed_inputs_ > 0) {
+        ImGui::TextDisabled("%llu input events carried no OS timestamp.",
+                            static_cast<unsigned long long>(untimed_inputs_));
+    }
+
+    ImGui::Separator();
+    renderHistogram("Input age at callback (ms)", at_callback_);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("OS timestamp -> event callback. Includes compositor, socket and pump delays.");
+    }
+
+    ImGui::Separator();
+    renderHistogram("Input age at present (ms)", at_present_);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("OS timestamp -> vkQueuePresentKHR() of the first frame that saw the event.");
+    }
+
+    ImGui::Separator();
+    renderHistogram("Present interval (ms)", present_interval_);
+}
+
+void LatencyModule::renderPhoton() {
+    ImGui::TextWrapped("Matches presents against LVKW_EVENT_TYPE_PRESENTATION feedback. Enable "
+                       "\"Presentation Feedback\" on the window in the Window module.");
+
+    if (ImGui::Button("Reset##photon")) {
+        at_photon_.clear();
+        present_to_photon_.clear();
+        presented_frames_ = 0;
+        discarded_frames_ = 0;
+    }
+    ImGui::SameLine();
+    ImGui::Text("Presented: %llu  Discarded: %llu", static_cast<unsigned long long>(presented_frames_),
+                static_cast<unsigned long long>(discarded_frames_));
+
+    if (presentation_metrics_valid_) {
+        const LVKW_PresentationMetrics &m = presentation_metrics_;
+        ImGui::Text("Refresh: %.2f ms  Interval: %.2f ms  Missed: %llu", nsToMs(m.refresh_ns),
+                    nsToMs(m.last_interval_ns), static_cast<unsigned long long>(m.missed_frames));
+        ImGui::Text("Jitter mean: %.3f ms  max: %.3f ms", nsToMs(m.mean_jitter_ns),
+                    nsToMs(m.max_jitter_ns));
+    } else {
+        ImGui::TextDisabled("Presentation metrics unavailable (LVKW_GATHER_METRICS off?)");
+    }
+
+    ImGui::Separator();
+    renderHistogram("Input to photon (ms)", at_photon_);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("OS timestamp -> compositor-reported presentation of the first frame that saw the event.");
+    }
+
+    ImGui::Separator();
+    renderHistogram("Present to photon (ms)", present_to_photon_);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("vkQueuePresentKHR() -> compositor-reported presentation.");
+    }
+}
+
+void LatencyModule::renderStorm(lvkw::Context &ctx) {
+    (void)ctx;
+    ImGui::TextWrapped("Posts USER_1 events from a background thread through lvkw_events_post() "
+                       "to stress the notification ring while you interact with the window.");
+
+    ImGui::SliderInt("Rate (events/s)", &storm_rate_hz_, 100, 1000000, "%d",
+                     ImGuiSliderFlags_Logarithmic);
+    ImGui::SliderInt("Burst size", &storm_burst_, 1, 1024, "%d", ImGuiSliderFlags_Logarithmic);
+
+    if (!storm_running_) {
+        if (ImGui::Button("Start Storm")) startStorm();
+    } else {
+        if (ImGui::Button("Stop Storm")) stopStorm();
+    }
+
+    const uint64_t posted = storm_posted_.load(std::memory_order_relaxed);
+    const uint64_t rejected = storm_rejected_.load(std::memory_order_relaxed);
+    const uint64_t attempts = posted + rejected;
+
+    ImGui::Separator();
+    ImGui::Text("Posted: %llu  Rejected: %llu (%.2f%%)  Received: %llu",
+                static_cast<unsigned long long>(posted), static_cast<unsigned long long>(rejected),
+                attempts ? 100.0 * static_cast<double>(rejected) / static_cast<double>(attempts) : 0.0,
+                static_cast<unsigned long long>(storm_received_));
+
+    if (event_metrics_valid_) {
+        ImGui::Text("Ring capacity: %u  Peak: %u  Drops: %u  Largest frame: %u",
+                    event_metrics_.current_capacity, event_metrics_.peak_count,
+                    event_metrics_.drop_count, event_metrics_.peak_frame_size);
+    } else {
+        ImGui::TextDisabled("Event metrics unavailable (LVKW_GATHER_METRICS off?)");
+    }
+
+    ImGui::Separator();
+    renderHistogram("Post -> callback (ms)", storm_at_callback_);
+}
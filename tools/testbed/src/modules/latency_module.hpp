@@ -0,0 +1,108 @@
+#pragma once
+
+#include "../feature_module.hpp"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <thread>
+#include <vector>
+
+// Rolling window of latency samples, in milliseconds.
+class LatencyHistogram {
+public:
+  void add(float ms);
+  void clear();
+
+  size_t count() const { return samples_.size(); }
+  float percentile(float p) const;
+  float max() const;
+
+  // Rebuilds the bin counts over [0, range_ms]. The last bin collects overflow.
+  const std::vector<float> &bins(float range_ms, int bin_count);
+
+private:
+  static constexpr size_t kMaxSamples = 8192;
+
+  std::deque<float> samples_;
+  std::vector<float> bins_;
+};
+
+class LatencyModule : public FeatureModule {
+public:
+  LatencyModule() = default;
+  virtual ~LatencyModule();
+
+  void update(lvkw::Context &ctx, lvkw::Window &window) override;
+  void render(lvkw::Context &ctx, lvkw::Window &window) override;
+  void onContextRecreated(lvkw::Context &ctx, lvkw::Window &window) override;
+
+  const char *getName() const override { return "Latency"; }
+  bool &getEnabled() override { return enabled_; }
+
+  void onEvent(LVKW_EventType type, LVKW_Window *window, const LVKW_Event &event);
+
+  // Called right after vkQueuePresentKHR() returned, with a timestamp from
+  // lvkw_instrumentation_getTimestamp().
+  void onFramePresented(uint64_t present_ns);
+
+  // The context is about to be destroyed: stop touching it.
+  void onContextDestroying();
+
+private:
+  static constexpr LVKW_EventType kStormEventType = LVKW_EVENT_TYPE_USER_1;
+
+  bool enabled_ = false;
+  LVKW_Context *ctx_handle_ = nullptr;
+
+  // Input latency
+  bool include_motion_ = true;
+  float range_ms_ = 50.0f;
+  LatencyHistogram at_callback_;
+  LatencyHistogram at_present_;
+  std::vector<uint64_t> pending_inputs_;  // OS timestamps of inputs not yet presented.
+  uint64_t untimed_inputs_ = 0;
+
+  // Present timing
+  uint64_t last_present_ns_ = 0;
+  LatencyHistogram present_interval_;
+
+  // Input-to-photon, matched against LVKW_EVENT_TYPE_PRESENTATION feedback.
+  struct InFlightFrame {
+    uint64_t present_call_ns;
+    std::vector<uint64_t> inputs;
+  };
+  static constexpr size_t kMaxInFlightFrames = 16;
+  std::deque<InFlightFrame> in_flight_;
+  LatencyHistogram at_photon_;
+  LatencyHistogram present_to_photon_;
+  uint64_t presented_frames_ = 0;
+  uint64_t discarded_frames_ = 0;
+  LVKW_PresentationMetrics presentation_metrics_ = {};
+  bool presentation_metrics_valid_ = false;
+
+  // Event storm
+  int storm_rate_hz_ = 10000;
+  int storm_burst_ = 16;
+  std::thread storm_thread_;
+  std::atomic<bool> storm_running_{false};
+  std::atomic<int> storm_rate_shared_{10000};
+  std::atomic<int> storm_burst_shared_{16};
+  std::atomic<uint64_t> storm_posted_{0};
+  std::atomic<uint64_t> storm_rejected_{0};
+  uint64_t storm_received_ = 0;
+  LatencyHistogram storm_at_callback_;
+
+  LVKW_EventMetrics event_metrics_ = {};
+  bool event_metrics_valid_ = false;
+
+  void startStorm();
+  void stopStorm();
+  void stormLoop(LVKW_Context *ctx);
+
+  void onPresentation(const LVKW_PresentationEvent &presentation);
+
+  void renderInputLatency();
+  void renderPhoton();
+  void renderStorm(lvkw::Context &ctx);
+  void renderHistogram(const char *label, LatencyHistogram &histogram);
+};
@@ -89,6 +89,10 @@ void MetricsModule::render(lvkw::Context &ctx, lvkw::Window &window) {
             renderTuning();
             ImGui::EndTabItem();
         }
+        if (ImGui::BeginTabItem("Memory Usage")) {
+            renderMemUsage(ctx);
+            ImGui::EndTabItem();
+        }
         if (ImGui::BeginTabItem("Memory Log")) {
             renderMemLog();
             ImGui::EndTabItem();
@@ -183,6 +187,55 @@ void MetricsModule::renderTuning() {
     }
 }
 
+void MetricsModule::renderMemUsage(lvkw::Context &ctx) {
+    static const char *kTagNames[LVKW_MEMORY_TAG_COUNT] = {
+        "Core", "Clipboard", "Drag & Drop", "Transfers", "Controllers", "Monitors", "Cursors", "String Cache",
+    };
+
+    bool reset = ImGui::Button("Reset Peaks & Counters");
+
+    LVKW_MemoryMetrics mem = {};
+    try {
+        mem = ctx.getMetrics<LVKW_MemoryMetrics>(reset);
+    } catch (const lvkw::Exception &) {
+        ImGui::TextDisabled("Memory metrics unavailable.");
+        return;
+    }
+
+    if (mem.total.alloc_count == 0 && mem.total.live_bytes == 0) {
+        ImGui::TextDisabled("No data (LVKW_GATHER_METRICS off?)");
+        return;
+    }
+
+    auto row = [](const char *name, const LVKW_MemoryUsage &usage) {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(name);
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", (unsigned long long)usage.live_bytes);
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", (unsigned long long)usage.peak_bytes);
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", (unsigned long long)usage.alloc_count);
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", (unsigned long long)usage.free_count);
+    };
+
+    if (ImGui::BeginTable("MemUsage", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("Subsystem");
+        ImGui::TableSetupColumn("Live (bytes)");
+        ImGui::TableSetupColumn("Peak (bytes)");
+        ImGui::TableSetupColumn("Allocs");
+        ImGui::TableSetupColumn("Frees");
+        ImGui::TableHeadersRow();
+        for (int i = 0; i < LVKW_MEMORY_TAG_COUNT; ++i) {
+            row(kTagNames[i], mem.tags[i]);
+        }
+        row("Total", mem.total);
+        ImGui::EndTable();
+    }
+}
+
 void MetricsModule::renderMemLog() {
     if (ImGui::Button("Clear Log##Mem")) {
         std::lock_guard<std::mutex> lock(mem_ops_mutex_);
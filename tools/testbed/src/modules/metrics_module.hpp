@@ -71,6 +71,7 @@ private:
   void renderMetrics(lvkw::Context &ctx);
   void renderCreateInfo();
   void renderTuning();
+  void renderMemUsage(lvkw::Context &ctx);
   void renderMemLog();
   void renderDiagLog();
 
@@ -113,6 +113,12 @@ void WindowModule::render(lvkw::Context &ctx, lvkw::Window &window) {
               attrs.primary_selection = primary_is_primary_selection_;
               primary_window_.update(LVKW_WINDOW_ATTR_PRIMARY_SELECTION, attrs);
           }
+          ImGui::SameLine();
+          if (ImGui::Checkbox("Frame Events", &primary_frame_events_)) primary_window_.setFrameEvents(primary_frame_events_);
+          ImGui::SameLine();
+          if (ImGui::Checkbox("Presentation Feedback", &primary_presentation_feedback_)) {
+              primary_window_.setPresentationFeedback(primary_presentation_feedback_);
+          }
 
 #ifdef LVKW_USE_FLOAT
           ImGuiDataType scalar_type = ImGuiDataType_Float;
@@ -183,6 +189,12 @@ void WindowModule::render(lvkw::Context &ctx, lvkw::Window &window) {
               attrs.primary_selection = sw.primary_selection;
               sw.window->update(LVKW_WINDOW_ATTR_PRIMARY_SELECTION, attrs);
           }
+          ImGui::SameLine();
+          if (ImGui::Checkbox("Frame Events", &sw.frame_events)) sw.window->setFrameEvents(sw.frame_events);
+          ImGui::SameLine();
+          if (ImGui::Checkbox("Presentation Feedback", &sw.presentation_feedback)) {
+              sw.window->setPresentationFeedback(sw.presentation_feedback);
+          }
 
 #ifdef LVKW_USE_FLOAT
           ImGuiDataType scalar_type = ImGuiDataType_Float;
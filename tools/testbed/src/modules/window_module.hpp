@@ -42,6 +42,8 @@ private:
     bool is_resizable = true;
     bool mouse_passthrough = false;
     bool primary_selection = false;
+    bool frame_events = false;
+    bool presentation_feedback = false;
     LVKW_LogicalVec min_size = {0, 0};
     LVKW_LogicalVec max_size = {0, 0};
     LVKW_Fraction aspect_ratio = {0, 0};
@@ -52,6 +54,8 @@ private:
   
   bool primary_is_decorated_ = true;
   bool primary_is_primary_selection_ = false;
+  bool primary_frame_events_ = false;
+  bool primary_presentation_feedback_ = false;
 
   void createSecondaryWindow(lvkw::Context &ctx);
   void renderSecondaryWindow(SecondaryWindow &sw);